@@ -109,7 +109,7 @@ void iox_pub_deinit(iox_pub_t const self)
 {
     iox::cxx::Expects(self != nullptr);
 
-    self->m_portData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    PublisherPortUser(self->m_portData).destroy();
     delete self;
 }
 
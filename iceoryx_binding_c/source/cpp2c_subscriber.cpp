@@ -38,6 +38,9 @@ void cpp2c_Subscriber::enableEvent(iox::popo::TriggerHandle&& triggerHandle,
         iox::popo::SubscriberPortUser(m_portData)
             .setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
         break;
+    case SubscriberEvent::DEADLINE_MISSED:
+        // the C binding does not provide a deadline and therefore does not translate this event
+        break;
     }
 }
 
@@ -48,6 +51,8 @@ void cpp2c_Subscriber::disableEvent(const SubscriberEvent subscriberEvent) noexc
     case SubscriberEvent::DATA_RECEIVED:
         m_trigger.reset();
         break;
+    case SubscriberEvent::DEADLINE_MISSED:
+        break;
     }
 }
 
@@ -33,6 +33,13 @@ enum class Technology
     UNIX_DOMAIN_SOCKET
 };
 
+enum class WaitMode
+{
+    BUSY_POLLING,
+    HYBRID,
+    BLOCKING
+};
+
 enum class RunFlag
 {
     STOP,
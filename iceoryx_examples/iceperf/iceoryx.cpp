@@ -18,12 +18,37 @@
 #include "iceoryx.hpp"
 
 #include <chrono>
+#include <cstdlib>
+#include <iostream>
 #include <thread>
 
-Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
+Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName,
+                 const iox::capro::IdString_t& subscriberName,
+                 const WaitMode waitMode) noexcept
     : m_publisher({"IcePerf", publisherName, "C++-API"}, iox::popo::PublisherOptions{1U})
     , m_subscriber({"IcePerf", subscriberName, "C++-API"}, iox::popo::SubscriberOptions{1U, 1U})
 {
+    // the spin and yield repetitions of the hybrid mode cover roughly the time of a round trip with small payloads
+    constexpr iox::popo::WaitOptions HYBRID_WAIT_OPTIONS{10000U, 100U};
+    switch (waitMode)
+    {
+    case WaitMode::BUSY_POLLING:
+        break;
+    case WaitMode::HYBRID:
+        m_waitSet.emplace(HYBRID_WAIT_OPTIONS);
+        break;
+    case WaitMode::BLOCKING:
+        m_waitSet.emplace();
+        break;
+    }
+
+    if (m_waitSet)
+    {
+        m_waitSet->attachState(m_subscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
+            std::cerr << "failed to attach subscriber" << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
+    }
 }
 
 void Iceoryx::initLeader() noexcept
@@ -57,7 +82,7 @@ void Iceoryx::shutdown() noexcept
     m_subscriber.unsubscribe();
 
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!m_publisher.hasSubscribers())
+    while (m_subscriber.getSubscriptionState() != iox::SubscribeState::NOT_SUBSCRIBED)
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -86,6 +111,11 @@ PerfTopic Iceoryx::receivePerfTopic() noexcept
 
     do
     {
+        if (m_waitSet)
+        {
+            m_waitSet->wait();
+        }
+
         m_subscriber.take().and_then([&](const void* data) {
             receivedSample = *(static_cast<const PerfTopic*>(data));
             hasReceivedSample = true;
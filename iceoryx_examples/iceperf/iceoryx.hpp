@@ -18,14 +18,18 @@
 #define IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
 
 #include "base.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/popo/untyped_publisher.hpp"
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
 
 class Iceoryx : public IcePerfBase
 {
   public:
-    Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+    Iceoryx(const iox::capro::IdString_t& publisherName,
+            const iox::capro::IdString_t& subscriberName,
+            const WaitMode waitMode = WaitMode::BUSY_POLLING) noexcept;
     void initLeader() noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
@@ -37,6 +41,7 @@ class Iceoryx : public IcePerfBase
 
     iox::popo::UntypedPublisher m_publisher;
     iox::popo::UntypedSubscriber m_subscriber;
+    iox::cxx::optional<iox::popo::WaitSet<1U>> m_waitSet;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
@@ -73,7 +73,7 @@ void IceoryxC::shutdown() noexcept
     iox_sub_unsubscribe(m_subscriber);
 
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!iox_pub_has_subscribers(m_publisher))
+    while (iox_sub_get_subscription_state(m_subscriber) != SubscribeState_NOT_SUBSCRIBED)
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
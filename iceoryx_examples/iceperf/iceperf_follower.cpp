@@ -109,7 +109,7 @@ int IcePerfFollower::run() noexcept
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
-        Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
+        Iceoryx iceoryx(PUBLISHER, SUBSCRIBER, m_settings.waitMode);
         doMeasurement(iceoryx);
     }
 
@@ -33,10 +33,11 @@ int main(int argc, char* argv[])
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
                                       {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"wait-mode", required_argument, nullptr, 'w'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:w:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -60,6 +61,10 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-w, --wait-mode <MODE>            Selects how the iceoryx C++ API waits for samples"
+                      << std::endl;
+            std::cout << "                                  <MODE> {busy-polling, hybrid, blocking}" << std::endl;
+            std::cout << "                                  default = 'busy-polling'" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -117,6 +122,25 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 'w':
+            if (strcmp(optarg, "busy-polling") == 0)
+            {
+                settings.waitMode = WaitMode::BUSY_POLLING;
+            }
+            else if (strcmp(optarg, "hybrid") == 0)
+            {
+                settings.waitMode = WaitMode::HYBRID;
+            }
+            else if (strcmp(optarg, "blocking") == 0)
+            {
+                settings.waitMode = WaitMode::BLOCKING;
+            }
+            else
+            {
+                std::cerr << "Options for 'wait-mode' are 'busy-polling', 'hybrid' and 'blocking'!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
         default:
             return EXIT_FAILURE;
         };
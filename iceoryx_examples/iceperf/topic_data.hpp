@@ -27,6 +27,7 @@ struct PerfSettings
     Benchmark benchmark{Benchmark::ALL};
     Technology technology{Technology::ALL};
     uint64_t numberOfSamples{10000U};
+    WaitMode waitMode{WaitMode::BUSY_POLLING};
 };
 
 struct PerfTopic
@@ -122,15 +122,17 @@ int main()
 
     //! [roudi]
     constexpr bool TERMINATE_APP_IN_ROUDI_DTOR_FLAG = false;
-    iox::roudi::RouDi roudi(
-        roudiComponents.rouDiMemoryManager,
-        roudiComponents.portManager,
-        iox::roudi::RouDi::RoudiStartupParameters{iox::roudi::MonitoringMode::OFF, TERMINATE_APP_IN_ROUDI_DTOR_FLAG});
+    iox::roudi::RouDi roudi(roudiComponents.rouDiMemoryManager,
+                            roudiComponents.portManager,
+                            iox::roudi::RouDi::RoudiStartupParameters{
+                                iox::roudi::MonitoringMode::OFF,
+                                TERMINATE_APP_IN_ROUDI_DTOR_FLAG,
+                                iox::roudi::RouDi::RuntimeMessagesThreadStart::NONE});
     //! [roudi]
 
     // create a single process runtime for inter thread communication
     //! [runtime]
-    iox::runtime::PoshRuntimeSingleProcess runtime("singleProcessDemo");
+    iox::runtime::PoshRuntimeSingleProcess runtime("singleProcessDemo", roudi);
     //! [runtime]
 
     //! [run]
@@ -16,12 +16,12 @@
 
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/popo/timer_trigger.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "topic_data.hpp"
 
-#include <chrono>
 #include <iostream>
 
 iox::popo::UserTrigger shutdownTrigger;
@@ -35,7 +35,7 @@ static void sigHandler(int f_sig IOX_MAYBE_UNUSED)
 class SomeClass
 {
   public:
-    static void cyclicRun(iox::popo::UserTrigger*)
+    static void cyclicRun(iox::popo::TimerTrigger*)
     {
         std::cout << "activation callback\n";
     }
@@ -63,27 +63,16 @@ int main()
     });
     //! [create waitset]
 
-    // create and attach the cyclicTrigger with a callback to
+    // create and attach the cyclicTrigger which triggers every second with a callback to
     // SomeClass::cyclicRun
     //! [create trigger]
-    iox::popo::UserTrigger cyclicTrigger;
+    iox::popo::TimerTrigger cyclicTrigger{iox::units::Duration::fromSeconds(1U)};
     waitset.attachEvent(cyclicTrigger, 0U, createNotificationCallback(SomeClass::cyclicRun)).or_else([](auto) {
         std::cerr << "failed to attach cyclic trigger" << std::endl;
         std::exit(EXIT_FAILURE);
     });
     //! [create trigger]
 
-    // start a thread which triggers cyclicTrigger every second
-    //! [cyclic thread]
-    std::thread cyclicTriggerThread([&] {
-        while (keepRunning.load())
-        {
-            cyclicTrigger.trigger();
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-        }
-    });
-    //! [cyclic thread]
-
     //! [event loop]
     while (keepRunning.load())
     {
@@ -111,6 +100,5 @@ int main()
     }
     //! [event loop]
 
-    cyclicTriggerThread.join();
     return (EXIT_SUCCESS);
 }
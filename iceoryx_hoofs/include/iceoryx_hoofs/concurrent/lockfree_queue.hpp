@@ -23,6 +23,7 @@
 #include "iox/uninitialized_array.hpp"
 
 #include <atomic>
+#include <type_traits>
 
 
 namespace iox
@@ -100,6 +101,14 @@ class LockFreeQueue
     /// @note threadsafe, lockfree
     uint64_t size() const noexcept;
 
+    /// @brief calls the callable with every storage slot of the queue, also with the slots which currently do not hold
+    ///        a value. The slots can be stale or concurrently modified, therefore this is only meant for a
+    ///        conservative inspection, e.g. to find out which resources might still be referenced.
+    /// @param[in] callable of type void(const ElementType& slot)
+    /// @note threadsafe, lockfree
+    template <typename Callable>
+    void forEachStorageSlot(const Callable& callable) const noexcept;
+
   protected:
     using Queue = IndexQueue<Capacity>;
 
@@ -70,6 +70,7 @@ class ResizeableLockFreeQueue : protected LockFreeQueue<ElementType, MaxCapacity
     static constexpr uint64_t maxCapacity() noexcept;
 
     using Base::empty;
+    using Base::forEachStorageSlot;
     using Base::pop;
     using Base::size;
     using Base::tryPush;
@@ -0,0 +1,128 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_SHARDED_LOCKFREE_QUEUE_HPP
+#define IOX_HOOFS_CONCURRENT_SHARDED_LOCKFREE_QUEUE_HPP
+
+#include "iceoryx_hoofs/concurrent/resizeable_lockfree_queue.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief implements a multi producer single consumer queue which is split into NumberOfLanes independent
+/// lock free lanes. Every producer provides an id which selects its lane, therefore producers with different
+/// lanes never contend on the same indices and the elements of one producer are always popped in FIFO order.
+/// The consumer pops the lanes in a round robin fashion so that no producer can starve the others.
+/// There is no FIFO order between elements of different lanes.
+///
+/// The capacity is distributed over the lanes, i.e. a single producer can only use the capacity of its lane. When
+/// the capacity is not a multiple of NumberOfLanes the first lanes hold one element more and when it is smaller
+/// than NumberOfLanes only as many lanes as elements are used, which are then shared by the producers.
+///
+/// @code
+///     concurrent::ShardedLockFreeQueue<int, 16, 4> queue;
+///     queue.tryPush(producerId, 42);
+///     auto value = queue.pop();
+/// @endcode
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+class ShardedLockFreeQueue
+{
+  public:
+    static_assert(NumberOfLanes > 0U, "the queue requires at least one lane");
+
+    using element_t = ElementType;
+    static constexpr uint64_t NUMBER_OF_LANES = NumberOfLanes;
+    static constexpr uint64_t MAX_CAPACITY_PER_LANE = (MaxCapacity + NumberOfLanes - 1U) / NumberOfLanes;
+
+    /// @brief creates a queue with a capacity of MaxCapacity
+    ShardedLockFreeQueue() noexcept;
+    ~ShardedLockFreeQueue() noexcept = default;
+
+    ShardedLockFreeQueue(const ShardedLockFreeQueue&) = delete;
+    ShardedLockFreeQueue(ShardedLockFreeQueue&&) = delete;
+    ShardedLockFreeQueue& operator=(const ShardedLockFreeQueue&) = delete;
+    ShardedLockFreeQueue& operator=(ShardedLockFreeQueue&&) = delete;
+
+    /// @brief tries to insert value into the lane of the producer
+    /// @param[in] producerId id of the producer, selects the lane
+    /// @param[in] value to be inserted
+    /// @return true if the value could be inserted, false if the lane of the producer was full
+    /// @note threadsafe, lockfree
+    bool tryPush(const uint64_t producerId, const ElementType& value) noexcept;
+
+    /// @brief inserts value into the lane of the producer, always succeeds by removing the oldest value of this
+    /// lane when the lane is detected to be full (overflow)
+    /// @param[in] producerId id of the producer, selects the lane
+    /// @param[in] value to be inserted
+    /// @return removed value if an overflow occured, empty optional otherwise
+    /// @note threadsafe, lockfree
+    cxx::optional<ElementType> push(const uint64_t producerId, const ElementType& value) noexcept;
+
+    /// @brief pops an element from the next non empty lane in round robin order
+    /// @return the element if the queue did contain one, empty optional otherwise
+    /// @note lockfree, only one thread is allowed to pop concurrently
+    cxx::optional<ElementType> pop() noexcept;
+
+    /// @brief returns true if all lanes are empty
+    /// @note threadsafe, lockfree but the result may already be outdated when it is returned
+    bool empty() const noexcept;
+
+    /// @brief returns the accumulated number of elements in all lanes
+    /// @note threadsafe, lockfree but the result may already be outdated when it is returned
+    uint64_t size() const noexcept;
+
+    /// @brief returns the accumulated capacity of all lanes
+    /// @note threadsafe, lockfree
+    uint64_t capacity() const noexcept;
+
+    /// @brief distributes newCapacity over the lanes, the accumulated capacity of the lanes is exactly newCapacity
+    /// @param[in] newCapacity the new capacity of the queue, must not be larger than MaxCapacity
+    /// @return true if the capacity of every lane could be set, false otherwise
+    /// @note if the capacity is reduced the oldest elements of a lane are discarded, the lane of a producer can
+    ///       change, therefore the capacity should not be changed while producers push concurrently
+    bool setCapacity(const uint64_t newCapacity) noexcept;
+
+    /// @brief calls the callable with every storage slot of all lanes, also with the slots which currently do not hold
+    ///        a value. The slots can be stale or concurrently modified, therefore this is only meant for a
+    ///        conservative inspection, e.g. to find out which resources might still be referenced.
+    /// @param[in] callable of type void(const ElementType& slot)
+    /// @note threadsafe, lockfree
+    template <typename Callable>
+    void forEachStorageSlot(const Callable& callable) const noexcept;
+
+  private:
+    using Lane_t = ResizeableLockFreeQueue<ElementType, MAX_CAPACITY_PER_LANE>;
+
+    uint64_t laneIndex(const uint64_t producerId) const noexcept;
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) the lanes are neither copyable nor movable
+    Lane_t m_lanes[NumberOfLanes];
+    std::atomic<uint64_t> m_numberOfUsedLanes{NumberOfLanes};
+    // only accessed by the single consumer
+    uint64_t m_nextLaneToPop{0U};
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iceoryx_hoofs/internal/concurrent/lockfree_queue/sharded_lockfree_queue.inl"
+
+#endif // IOX_HOOFS_CONCURRENT_SHARDED_LOCKFREE_QUEUE_HPP
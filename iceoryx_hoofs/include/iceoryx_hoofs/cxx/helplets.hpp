@@ -246,6 +246,28 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     return n && ((n & (n - 1U)) == 0U);
 }
 
+/// @brief Returns the number of consecutive zero bits starting from the least significant bit
+/// @param[in] value the value to inspect
+/// @return the number of trailing zero bits, 64 if the value is zero
+inline uint64_t countTrailingZeros(const uint64_t value) noexcept
+{
+    constexpr uint64_t NUMBER_OF_BITS{64U};
+    if (value == 0U)
+    {
+        return NUMBER_OF_BITS;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#else
+    uint64_t numberOfTrailingZeros{0U};
+    while (((value >> numberOfTrailingZeros) & 1U) == 0U)
+    {
+        ++numberOfTrailingZeros;
+    }
+    return numberOfTrailingZeros;
+#endif
+}
+
 enum class RelativePathComponents
 {
     REJECT,
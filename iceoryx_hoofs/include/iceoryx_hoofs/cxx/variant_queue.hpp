@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CXX_VARIANT_QUEUE_HPP
 
 #include "iceoryx_hoofs/concurrent/resizeable_lockfree_queue.hpp"
+#include "iceoryx_hoofs/concurrent/sharded_lockfree_queue.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/variant.hpp"
 #include "iceoryx_hoofs/internal/concurrent/fifo.hpp"
@@ -40,7 +41,9 @@ enum class VariantQueueTypes : uint64_t
     FiFo_SingleProducerSingleConsumer = 0,
     SoFi_SingleProducerSingleConsumer = 1,
     FiFo_MultiProducerSingleConsumer = 2,
-    SoFi_MultiProducerSingleConsumer = 3
+    SoFi_MultiProducerSingleConsumer = 3,
+    FiFo_ShardedMultiProducerSingleConsumer = 4,
+    SoFi_ShardedMultiProducerSingleConsumer = 5
 };
 
 // remark: we need to consider to support the non-resizable queue as well
@@ -69,10 +72,16 @@ template <typename ValueType, uint64_t Capacity>
 class VariantQueue
 {
   public:
+    /// @brief number of lanes of the FiFo_ShardedMultiProducerSingleConsumer and
+    ///        SoFi_ShardedMultiProducerSingleConsumer queues, the capacity is distributed over the lanes
+    static constexpr uint64_t NUMBER_OF_SHARDED_LANES{4U};
+
     using fifo_t = variant<concurrent::FiFo<ValueType, Capacity>,
                            concurrent::SoFi<ValueType, Capacity>,
                            concurrent::ResizeableLockFreeQueue<ValueType, Capacity>,
-                           concurrent::ResizeableLockFreeQueue<ValueType, Capacity>>;
+                           concurrent::ResizeableLockFreeQueue<ValueType, Capacity>,
+                           concurrent::ShardedLockFreeQueue<ValueType, Capacity, NUMBER_OF_SHARDED_LANES>,
+                           concurrent::ShardedLockFreeQueue<ValueType, Capacity, NUMBER_OF_SHARDED_LANES>>;
 
     /// @brief Constructor of a VariantQueue
     /// @param[in] type type of the underlying queue
@@ -80,10 +89,12 @@ class VariantQueue
 
     /// @brief pushs an element into the fifo
     /// @param[in] value value which should be added in the fifo
+    /// @param[in] producerId identifies the producer, the sharded queues push all values with the same
+    ///            producerId into the same lane; ignored by all other queue types
     /// @return if the underlying queue has an overflow the optional will contain
     ///         the value which was overridden (SOFI) or which was dropped (FIFO)
     ///         otherwise the optional contains nullopt_t
-    optional<ValueType> push(const ValueType& value) noexcept;
+    optional<ValueType> push(const ValueType& value, const uint64_t producerId = 0U) noexcept;
 
     /// @brief pops an element from the fifo
     /// @return if the fifo did contain an element it is returned inside the optional
@@ -105,6 +116,7 @@ class VariantQueue
     ///         this call
     /// @note depending on the internal queue used, concurrent pushes and pops are possible
     ///       (for FiFo_MultiProducerSingleConsumer and SoFi_MultiProducerSingleConsumer)
+    /// @note the sharded queues distribute newCapacity over their lanes, see concurrent::ShardedLockFreeQueue
     /// @concurrent not thread safe
     bool setCapacity(const uint64_t newCapacity) noexcept;
 
@@ -112,6 +124,13 @@ class VariantQueue
     /// @return queue size
     uint64_t capacity() const noexcept;
 
+    /// @brief calls the callable with every storage slot of the underlying queue, also with the slots which
+    ///        currently do not hold a value. The slots can be stale or concurrently modified, therefore this is only
+    ///        meant for a conservative inspection, e.g. to find out which resources might still be referenced.
+    /// @param[in] callable of type void(const ValueType& slot)
+    template <typename Callable>
+    void forEachStorageSlot(const Callable& callable) const noexcept;
+
     /// @brief returns reference to the underlying fifo
     /// @code
     ///    VariantQueueTypes<int, 10> myFifo(VariantQueueTypes::FiFo_SingleProducerSingleConsumer);
@@ -0,0 +1,44 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_CPU_RELAX_HPP
+#define IOX_HOOFS_CONCURRENT_CPU_RELAX_HPP
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Signals the CPU that the calling thread is in a busy loop. On x86 the pause instruction
+///        reduces the power consumption and avoids the memory order violation when the loop is left, on
+///        arm the yield instruction is used. On other architectures the call has no effect.
+inline void cpuRelax() noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    // NOLINTNEXTLINE(hicpp-no-assembler) there is no intrinsic for the yield instruction in all compilers
+    asm volatile("yield" ::: "memory");
+#endif
+}
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_CPU_RELAX_HPP
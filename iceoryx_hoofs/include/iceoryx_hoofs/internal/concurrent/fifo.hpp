@@ -21,6 +21,7 @@
 #include "iox/uninitialized_array.hpp"
 
 #include <atomic>
+#include <type_traits>
 
 namespace iox
 {
@@ -50,6 +51,13 @@ class FiFo
     /// @brief returns the capacity of the fifo
     static constexpr uint64_t capacity() noexcept;
 
+    /// @brief calls the callable with every storage slot of the fifo, also with the slots which currently do not hold
+    ///        a value. The slots can be stale or concurrently modified, therefore this is only meant for a
+    ///        conservative inspection, e.g. to find out which resources might still be referenced.
+    /// @param[in] callable of type void(const ValueType& slot)
+    template <typename Callable>
+    void forEachStorageSlot(const Callable& callable) const noexcept;
+
   private:
     bool is_full() const noexcept;
 
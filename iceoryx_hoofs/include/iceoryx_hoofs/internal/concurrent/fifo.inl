@@ -85,6 +85,17 @@ inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop() noexcept
     m_read_pos.store(currentReadPos + 1, std::memory_order_release);
     return out;
 }
+template <typename ValueType, uint64_t Capacity>
+template <typename Callable>
+inline void FiFo<ValueType, Capacity>::forEachStorageSlot(const Callable& callable) const noexcept
+{
+    static_assert(std::is_trivially_copyable<ValueType>::value, "only trivially copyable values can be inspected");
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        callable(m_data[i]);
+    }
+}
+
 } // namespace concurrent
 } // namespace iox
 
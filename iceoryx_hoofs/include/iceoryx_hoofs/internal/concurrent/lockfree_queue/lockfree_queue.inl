@@ -176,6 +176,17 @@ void LockFreeQueue<ElementType, Capacity>::writeBufferAt(const uint64_t& index,
     m_size.fetch_add(1U, std::memory_order_release);
 }
 
+template <typename ElementType, uint64_t Capacity>
+template <typename Callable>
+void LockFreeQueue<ElementType, Capacity>::forEachStorageSlot(const Callable& callable) const noexcept
+{
+    static_assert(std::is_trivially_copyable<ElementType>::value, "only trivially copyable values can be inspected");
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        callable(m_buffer[i]);
+    }
+}
+
 } // namespace concurrent
 } // namespace iox
 
@@ -0,0 +1,162 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_LOCKFREE_QUEUE_SHARDED_LOCKFREE_QUEUE_INL
+#define IOX_HOOFS_CONCURRENT_LOCKFREE_QUEUE_SHARDED_LOCKFREE_QUEUE_INL
+
+#include "iceoryx_hoofs/concurrent/sharded_lockfree_queue.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace concurrent
+{
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+constexpr uint64_t ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::MAX_CAPACITY_PER_LANE;
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::ShardedLockFreeQueue() noexcept
+{
+    // the lanes can hold MAX_CAPACITY_PER_LANE elements each, which exceeds MaxCapacity when it is not a multiple
+    // of NumberOfLanes
+    setCapacity(MaxCapacity);
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline uint64_t ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::laneIndex(
+    const uint64_t producerId) const noexcept
+{
+    return producerId % m_numberOfUsedLanes.load(std::memory_order_relaxed);
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline bool ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::tryPush(const uint64_t producerId,
+                                                                                   const ElementType& value) noexcept
+{
+    return m_lanes[laneIndex(producerId)].tryPush(value);
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline cxx::optional<ElementType>
+ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::push(const uint64_t producerId,
+                                                                    const ElementType& value) noexcept
+{
+    return m_lanes[laneIndex(producerId)].push(value);
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline cxx::optional<ElementType> ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::pop() noexcept
+{
+    for (uint64_t i = 0U; i < NumberOfLanes; ++i)
+    {
+        auto& lane = m_lanes[m_nextLaneToPop];
+        m_nextLaneToPop = (m_nextLaneToPop + 1U) % NumberOfLanes;
+
+        auto value = lane.pop();
+        if (value.has_value())
+        {
+            return value;
+        }
+    }
+
+    return cxx::nullopt;
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline bool ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::empty() const noexcept
+{
+    for (const auto& lane : m_lanes)
+    {
+        if (!lane.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline uint64_t ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::size() const noexcept
+{
+    uint64_t accumulatedSize{0U};
+    for (const auto& lane : m_lanes)
+    {
+        accumulatedSize += lane.size();
+    }
+    return accumulatedSize;
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline uint64_t ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::capacity() const noexcept
+{
+    uint64_t accumulatedCapacity{0U};
+    for (const auto& lane : m_lanes)
+    {
+        accumulatedCapacity += lane.capacity();
+    }
+    return accumulatedCapacity;
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+inline bool ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::setCapacity(
+    const uint64_t newCapacity) noexcept
+{
+    if (newCapacity > MaxCapacity)
+    {
+        return false;
+    }
+
+    // every used lane must be able to hold at least one element, the remainder of the division goes to the first
+    // lanes so that the lanes hold exactly newCapacity elements
+    const uint64_t numberOfUsedLanes = std::max(std::min(newCapacity, NumberOfLanes), static_cast<uint64_t>(1U));
+    const uint64_t minLaneCapacity = newCapacity / numberOfUsedLanes;
+    const uint64_t numberOfLanesWithOneMoreElement = newCapacity % numberOfUsedLanes;
+
+    bool hasSetAllCapacities{true};
+    for (uint64_t i = 0U; i < NumberOfLanes; ++i)
+    {
+        uint64_t newLaneCapacity{0U};
+        if (i < numberOfUsedLanes)
+        {
+            newLaneCapacity = (i < numberOfLanesWithOneMoreElement) ? minLaneCapacity + 1U : minLaneCapacity;
+        }
+
+        if (!m_lanes[i].setCapacity(newLaneCapacity))
+        {
+            hasSetAllCapacities = false;
+        }
+    }
+    m_numberOfUsedLanes.store(numberOfUsedLanes, std::memory_order_relaxed);
+
+    return hasSetAllCapacities;
+}
+
+template <typename ElementType, uint64_t MaxCapacity, uint64_t NumberOfLanes>
+template <typename Callable>
+inline void ShardedLockFreeQueue<ElementType, MaxCapacity, NumberOfLanes>::forEachStorageSlot(
+    const Callable& callable) const noexcept
+{
+    for (const auto& lane : m_lanes)
+    {
+        lane.forEachStorageSlot(callable);
+    }
+}
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_LOCKFREE_QUEUE_SHARDED_LOCKFREE_QUEUE_INL
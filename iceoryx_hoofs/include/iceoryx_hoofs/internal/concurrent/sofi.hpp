@@ -151,6 +151,14 @@ class SoFi
     /// @concurrent unrestricted thread safe
     uint64_t size() const noexcept;
 
+    /// @brief calls the callable with every storage slot of sofi, also with the slots which currently do not hold
+    ///        a value. The slots can be stale or concurrently modified, therefore this is only meant for a
+    ///        conservative inspection, e.g. to find out which resources might still be referenced.
+    /// @param[in] callable of type void(const ValueType& slot)
+    /// @concurrent unrestricted thread safe
+    template <typename Callable>
+    void forEachStorageSlot(const Callable& callable) const noexcept;
+
   private:
     UninitializedArray<ValueType, INTERNAL_SOFI_SIZE> m_data;
     uint64_t m_size = INTERNAL_SOFI_SIZE;
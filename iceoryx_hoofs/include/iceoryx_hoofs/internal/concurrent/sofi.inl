@@ -186,6 +186,16 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueIn, ValueType& v
     return !SOFI_OVERFLOW;
 }
 
+template <class ValueType, uint64_t CapacityValue>
+template <typename Callable>
+void SoFi<ValueType, CapacityValue>::forEachStorageSlot(const Callable& callable) const noexcept
+{
+    static_assert(std::is_trivially_copyable<ValueType>::value, "only trivially copyable values can be inspected");
+    for (uint64_t i = 0U; i < INTERNAL_SOFI_SIZE; ++i)
+    {
+        callable(m_data[i]);
+    }
+}
 
 } // namespace concurrent
 } // namespace iox
@@ -23,6 +23,9 @@ namespace iox
 {
 namespace cxx
 {
+template <typename ValueType, uint64_t Capacity>
+constexpr uint64_t VariantQueue<ValueType, Capacity>::NUMBER_OF_SHARDED_LANES;
+
 template <typename ValueType, uint64_t Capacity>
 inline VariantQueue<ValueType, Capacity>::VariantQueue(const VariantQueueTypes type) noexcept
     : m_type(type)
@@ -46,11 +49,19 @@ inline VariantQueue<ValueType, Capacity>::VariantQueue(const VariantQueueTypes t
         m_fifo.template emplace<concurrent::ResizeableLockFreeQueue<ValueType, Capacity>>();
         break;
     }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+        IOX_FALLTHROUGH;
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        m_fifo.template emplace<concurrent::ShardedLockFreeQueue<ValueType, Capacity, NUMBER_OF_SHARDED_LANES>>();
+        break;
+    }
     }
 }
 
 template <typename ValueType, uint64_t Capacity>
-optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& value) noexcept
+optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& value,
+                                                            const uint64_t producerId) noexcept
 {
     switch (m_type)
     {
@@ -85,6 +96,21 @@ optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& val
             .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
             ->push(value);
     }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+    {
+        auto hadSpace = m_fifo
+                            .template get_at_index<static_cast<uint64_t>(
+                                VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+                            ->tryPush(producerId, value);
+
+        return (hadSpace) ? cxx::nullopt : cxx::make_optional<ValueType>(value);
+    }
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        return m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+            ->push(producerId, value);
+    }
     }
 
     return cxx::nullopt;
@@ -117,6 +143,13 @@ inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
             .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
             ->pop();
     }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        return m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+            ->pop();
+    }
     }
 
     return cxx::nullopt;
@@ -146,6 +179,13 @@ inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
             .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
             ->empty();
     }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        return m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+            ->empty();
+    }
     }
 
     return true;
@@ -178,6 +218,14 @@ inline uint64_t VariantQueue<ValueType, Capacity>::size() noexcept
             ->size();
         break;
     }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        return m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+            ->size();
+        break;
+    }
     }
 
     return 0U;
@@ -209,6 +257,14 @@ inline bool VariantQueue<ValueType, Capacity>::setCapacity(const uint64_t newCap
             .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
             ->setCapacity(newCapacity);
     }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        // the capacity is distributed over the lanes, every lane may discard elements as described above
+        return m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+            ->setCapacity(newCapacity);
+    }
     }
     return false;
 }
@@ -240,11 +296,55 @@ inline uint64_t VariantQueue<ValueType, Capacity>::capacity() const noexcept
             ->capacity();
         break;
     }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        return m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+            ->capacity();
+        break;
+    }
     }
 
     return 0U;
 }
 
+template <typename ValueType, uint64_t Capacity>
+template <typename Callable>
+inline void VariantQueue<ValueType, Capacity>::forEachStorageSlot(const Callable& callable) const noexcept
+{
+    switch (m_type)
+    {
+    case VariantQueueTypes::FiFo_SingleProducerSingleConsumer:
+    {
+        m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>()
+            ->forEachStorageSlot(callable);
+        break;
+    }
+    case VariantQueueTypes::SoFi_SingleProducerSingleConsumer:
+    {
+        m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>()
+            ->forEachStorageSlot(callable);
+        break;
+    }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer:
+    {
+        m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
+            ->forEachStorageSlot(callable);
+        break;
+    }
+    case VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer:
+    {
+        m_fifo
+            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer)>()
+            ->forEachStorageSlot(callable);
+        break;
+    }
+    }
+}
+
 template <typename ValueType, uint64_t Capacity>
 inline typename VariantQueue<ValueType, Capacity>::fifo_t&
 VariantQueue<ValueType, Capacity>::getUnderlyingFiFo() noexcept
@@ -0,0 +1,119 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_POSIX_WRAPPER_BINARY_SEMAPHORE_HPP
+#define IOX_HOOFS_POSIX_WRAPPER_BINARY_SEMAPHORE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/design_pattern/builder.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/semaphore_interface.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief A semaphore which can only have the values zero and one and which can be stored in shared memory.
+///        The state is kept in an atomic with an additional flag which signals that a thread is blocked in one
+///        of the wait calls. Therefore post() is a single atomic operation without a syscall as long as no
+///        thread is blocked.
+///        On platforms which support futexes (see IOX_SUPPORT_FUTEX) the waiting thread blocks directly on
+///        the atomic via a futex, otherwise an unnamed posix semaphore is used to block the thread. Since a post
+///        has to wake up every blocked thread, the fallback counts the blocked threads and posts the unnamed
+///        semaphore once for each of them.
+/// @code
+///     iox::cxx::optional<iox::posix::BinarySemaphore> semaphore;
+///     iox::posix::BinarySemaphoreBuilder().isInterProcessCapable(true).create(semaphore).expect("Valid semaphore");
+///
+///     semaphore->post().expect("post succeeds");
+///     semaphore->wait().expect("wait succeeds");
+/// @endcode
+class BinarySemaphore
+{
+  public:
+    BinarySemaphore(const BinarySemaphore&) noexcept = delete;
+    BinarySemaphore(BinarySemaphore&&) noexcept = delete;
+    BinarySemaphore& operator=(const BinarySemaphore&) noexcept = delete;
+    BinarySemaphore& operator=(BinarySemaphore&&) noexcept = delete;
+    ~BinarySemaphore() noexcept = default;
+
+    /// @brief Sets the semaphore value to one and wakes up the blocked threads. If the value is already one
+    ///        the call has no effect.
+    /// @return Fails when the underlying wake up mechanism is corrupted
+    cxx::expected<SemaphoreError> post() noexcept;
+
+    /// @brief Sets the semaphore value from one to zero. When the semaphore value is zero it blocks until
+    ///        the semaphore value becomes one.
+    /// @return Fails when the underlying wait mechanism is corrupted
+    cxx::expected<SemaphoreError> wait() noexcept;
+
+    /// @brief Tries to set the semaphore value from one to zero.
+    /// @return true if the semaphore value was one, otherwise false
+    cxx::expected<bool, SemaphoreError> tryWait() noexcept;
+
+    /// @brief Sets the semaphore value from one to zero. When the semaphore value is zero it blocks until
+    ///        the semaphore value becomes one or the timeout has passed.
+    /// @return SemaphoreWaitState::NO_TIMEOUT if the semaphore value was set from one to zero,
+    ///         otherwise SemaphoreWaitState::TIMEOUT
+    cxx::expected<SemaphoreWaitState, SemaphoreError> timedWait(const units::Duration& timeout) noexcept;
+
+  private:
+    friend class BinarySemaphoreBuilder;
+    friend class iox::cxx::optional<BinarySemaphore>;
+
+    BinarySemaphore(const bool isInterProcessCapable, const bool useFutex) noexcept;
+
+    bool announceWaiter(uint32_t expectedState) noexcept;
+    cxx::expected<SemaphoreError> blockWhileWaiting() noexcept;
+    cxx::expected<SemaphoreError> blockWhileWaiting(const units::Duration& timeout) noexcept;
+    cxx::expected<SemaphoreError> wakeUpWaiters() noexcept;
+
+  private:
+    static constexpr uint32_t STATE_NOT_POSTED{0U};
+    static constexpr uint32_t STATE_POSTED{1U};
+    static constexpr uint32_t STATE_NOT_POSTED_WITH_WAITERS{2U};
+
+    std::atomic<uint32_t> m_state{STATE_NOT_POSTED};
+    bool m_isInterProcessCapable{true};
+    bool m_useFutex{true};
+    /// @note the following members are only used when no futex is used
+    std::atomic<uint32_t> m_numberOfFallbackWaiters{0U};
+    cxx::optional<UnnamedSemaphore> m_fallbackSemaphore;
+};
+
+class BinarySemaphoreBuilder
+{
+    /// @brief Set if the binary semaphore can be stored in the shared memory
+    ///        for inter process usage
+    IOX_BUILDER_PARAMETER(bool, isInterProcessCapable, true)
+
+    /// @brief Block the waiting threads with an unnamed posix semaphore even when the platform supports futexes.
+    ///        On platforms without futex support the unnamed semaphore is always used.
+    IOX_BUILDER_PARAMETER(bool, useFallbackSemaphore, false)
+
+  public:
+    /// @brief create a binary semaphore with the initial value zero
+    /// @param[in] uninitializedSemaphore since the semaphore is not movable the user has to provide
+    ///            memory to store the semaphore into - packed in an optional
+    /// @return an error describing the failure or success
+    cxx::expected<SemaphoreError> create(cxx::optional<BinarySemaphore>& uninitializedSemaphore) const noexcept;
+};
+} // namespace posix
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_WRAPPER_BINARY_SEMAPHORE_HPP
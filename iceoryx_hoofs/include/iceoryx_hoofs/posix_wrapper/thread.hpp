@@ -18,9 +18,11 @@
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/design_pattern/builder.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_hoofs/posix_wrapper/scheduler.hpp"
 #include "iceoryx_platform/pthread.hpp"
 
 #include <atomic>
@@ -77,7 +79,13 @@ class Thread
     friend class cxx::optional<Thread>;
 
   private:
-    Thread(const ThreadName_t& name, const callable_t& callable) noexcept;
+    Thread(const ThreadName_t& name,
+           const callable_t& callable,
+           const uint64_t cpuAffinityMask,
+           const cxx::optional<Scheduler>& scheduler,
+           const int32_t schedulerPriority) noexcept;
+
+    void applySchedulingSettings() noexcept;
 
     static ThreadError errnoToEnum(const int errnoValue) noexcept;
 
@@ -87,6 +95,9 @@ class Thread
     callable_t m_callable;
     bool m_isThreadConstructed{false};
     ThreadName_t m_threadName;
+    uint64_t m_cpuAffinityMask{0U};
+    cxx::optional<Scheduler> m_scheduler;
+    int32_t m_schedulerPriority{0};
 };
 
 class ThreadBuilder
@@ -94,6 +105,21 @@ class ThreadBuilder
     /// @brief Set the name of the thread
     IOX_BUILDER_PARAMETER(ThreadName_t, name, "")
 
+    /// @brief Set the cpu cores the thread is allowed to run on, bit n of the mask represents core n. With the
+    ///        default value 0 the affinity of the thread is not restricted.
+    /// @note The affinity is not supported on every platform, a failure is logged but does not prevent the thread
+    ///       from being started.
+    IOX_BUILDER_PARAMETER(uint64_t, cpuAffinityMask, 0U)
+
+    /// @brief Set the scheduling policy of the thread, if no scheduler is set the one of the creating thread is used
+    /// @note Setting a real time policy requires the corresponding privileges, a failure is logged but does not
+    ///       prevent the thread from being started.
+    IOX_BUILDER_PARAMETER(cxx::optional<Scheduler>, scheduler, cxx::nullopt)
+
+    /// @brief Set the priority of the thread for the scheduler, it must be in the range of
+    ///        getSchedulerPriorityMinimum and getSchedulerPriorityMaximum. It is ignored when no scheduler is set.
+    IOX_BUILDER_PARAMETER(int32_t, schedulerPriority, 0)
+
   public:
     /// @brief Creates a thread
     /// @param[in] uninitializedThread is an iox::cxx::optional where the thread is stored
@@ -0,0 +1,260 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/posix_wrapper/binary_semaphore.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
+#include "iceoryx_hoofs/log/logging.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/futex.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+
+#include <climits>
+
+namespace iox
+{
+namespace posix
+{
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "the futex syscall requires that the atomic has the same layout as uint32_t");
+
+constexpr uint32_t BinarySemaphore::STATE_NOT_POSTED;
+constexpr uint32_t BinarySemaphore::STATE_POSTED;
+constexpr uint32_t BinarySemaphore::STATE_NOT_POSTED_WITH_WAITERS;
+
+cxx::expected<SemaphoreError>
+BinarySemaphoreBuilder::create(cxx::optional<BinarySemaphore>& uninitializedSemaphore) const noexcept
+{
+    const bool useFutex = platform::IOX_SUPPORT_FUTEX && !m_useFallbackSemaphore;
+    uninitializedSemaphore.emplace(m_isInterProcessCapable, useFutex);
+
+    if (useFutex)
+    {
+        return cxx::success<>();
+    }
+
+    auto result = UnnamedSemaphoreBuilder()
+                      .initialValue(0U)
+                      .isInterProcessCapable(m_isInterProcessCapable)
+                      .create(uninitializedSemaphore->m_fallbackSemaphore);
+    if (result.has_error())
+    {
+        IOX_LOG(ERROR) << "Unable to create the semaphore which is required as fallback for the binary semaphore";
+        uninitializedSemaphore.reset();
+        return cxx::error<SemaphoreError>(result.get_error());
+    }
+
+    return cxx::success<>();
+}
+
+BinarySemaphore::BinarySemaphore(const bool isInterProcessCapable, const bool useFutex) noexcept
+    : m_isInterProcessCapable(isInterProcessCapable)
+    , m_useFutex(useFutex)
+{
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::post() noexcept
+{
+    // the common case: nobody is blocked, therefore no syscall is required
+    // sequentially consistent since the fallback reads the number of waiters afterwards, see announceWaiter
+    if (m_state.exchange(STATE_POSTED, std::memory_order_seq_cst) != STATE_NOT_POSTED_WITH_WAITERS)
+    {
+        return cxx::success<>();
+    }
+
+    return wakeUpWaiters();
+}
+
+cxx::expected<bool, SemaphoreError> BinarySemaphore::tryWait() noexcept
+{
+    uint32_t expectedState = STATE_POSTED;
+    return cxx::success<bool>(
+        m_state.compare_exchange_strong(expectedState, STATE_NOT_POSTED, std::memory_order_acquire));
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::wait() noexcept
+{
+    while (true)
+    {
+        uint32_t expectedState = STATE_POSTED;
+        if (m_state.compare_exchange_strong(expectedState, STATE_NOT_POSTED, std::memory_order_acquire))
+        {
+            return cxx::success<>();
+        }
+
+        // announce the waiter, when this fails the semaphore was posted in the meantime
+        if (!announceWaiter(expectedState))
+        {
+            continue;
+        }
+
+        auto result = blockWhileWaiting();
+        if (result.has_error())
+        {
+            return result;
+        }
+    }
+}
+
+cxx::expected<SemaphoreWaitState, SemaphoreError> BinarySemaphore::timedWait(const units::Duration& timeout) noexcept
+{
+    cxx::DeadlineTimer deadline(timeout);
+    while (true)
+    {
+        uint32_t expectedState = STATE_POSTED;
+        if (m_state.compare_exchange_strong(expectedState, STATE_NOT_POSTED, std::memory_order_acquire))
+        {
+            return cxx::success<SemaphoreWaitState>(SemaphoreWaitState::NO_TIMEOUT);
+        }
+
+        if (deadline.hasExpired())
+        {
+            // the waiter flag is not reset since other threads may still be blocked, a stale flag
+            // only costs one unnecessary wake up in the next post
+            return cxx::success<SemaphoreWaitState>(SemaphoreWaitState::TIMEOUT);
+        }
+
+        if (!announceWaiter(expectedState))
+        {
+            continue;
+        }
+
+        auto result = blockWhileWaiting(deadline.remainingTime());
+        if (result.has_error())
+        {
+            return cxx::error<SemaphoreError>(result.get_error());
+        }
+    }
+}
+
+bool BinarySemaphore::announceWaiter(uint32_t expectedState) noexcept
+{
+    if (m_useFutex)
+    {
+        return expectedState == STATE_NOT_POSTED_WITH_WAITERS
+               || m_state.compare_exchange_strong(
+                   expectedState, STATE_NOT_POSTED_WITH_WAITERS, std::memory_order_relaxed);
+    }
+
+    // The fallback semaphore is posted once for every counted waiter. Therefore the waiter is counted before the
+    // state is loaded again. Either a concurrent post reads a number of waiters which contains this waiter or
+    // this waiter sees the posted state and does not block.
+    m_numberOfFallbackWaiters.fetch_add(1U, std::memory_order_seq_cst);
+    expectedState = m_state.load(std::memory_order_seq_cst);
+    while (expectedState != STATE_NOT_POSTED_WITH_WAITERS)
+    {
+        if (expectedState == STATE_POSTED)
+        {
+            m_numberOfFallbackWaiters.fetch_sub(1U, std::memory_order_relaxed);
+            return false;
+        }
+        if (m_state.compare_exchange_weak(expectedState, STATE_NOT_POSTED_WITH_WAITERS, std::memory_order_seq_cst))
+        {
+            break;
+        }
+    }
+    return true;
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::blockWhileWaiting() noexcept
+{
+    if (m_useFutex)
+    {
+        // EAGAIN: the state was already changed by post before we were able to block
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) required by the futex syscall
+        auto result = posixCall(iox_futex_wait)(reinterpret_cast<uint32_t*>(&m_state),
+                                                STATE_NOT_POSTED_WITH_WAITERS,
+                                                nullptr,
+                                                m_isInterProcessCapable)
+                          .failureReturnValue(-1)
+                          .ignoreErrnos(EAGAIN)
+                          .evaluate();
+        if (result.has_error())
+        {
+            IOX_LOG(ERROR) << "Unable to wait on the futex of the binary semaphore";
+            return cxx::error<SemaphoreError>(SemaphoreError::INVALID_SEMAPHORE_HANDLE);
+        }
+        return cxx::success<>();
+    }
+
+    // a post may have counted this waiter although it never blocked, the superfluous post of the fallback
+    // semaphore only causes one spurious wake up since the wait loop checks the state again
+    auto result = m_fallbackSemaphore->wait();
+    m_numberOfFallbackWaiters.fetch_sub(1U, std::memory_order_relaxed);
+    return result;
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::blockWhileWaiting(const units::Duration& timeout) noexcept
+{
+    if (m_useFutex)
+    {
+        const timespec relativeTimeout = timeout.timespec(units::TimeSpecReference::None);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) required by the futex syscall
+        auto result = posixCall(iox_futex_wait)(reinterpret_cast<uint32_t*>(&m_state),
+                                                STATE_NOT_POSTED_WITH_WAITERS,
+                                                &relativeTimeout,
+                                                m_isInterProcessCapable)
+                          .failureReturnValue(-1)
+                          .ignoreErrnos(EAGAIN, ETIMEDOUT)
+                          .evaluate();
+        if (result.has_error())
+        {
+            IOX_LOG(ERROR) << "Unable to wait on the futex of the binary semaphore";
+            return cxx::error<SemaphoreError>(SemaphoreError::INVALID_SEMAPHORE_HANDLE);
+        }
+        return cxx::success<>();
+    }
+
+    auto result = m_fallbackSemaphore->timedWait(timeout);
+    m_numberOfFallbackWaiters.fetch_sub(1U, std::memory_order_relaxed);
+    if (result.has_error())
+    {
+        return cxx::error<SemaphoreError>(result.get_error());
+    }
+    return cxx::success<>();
+}
+
+cxx::expected<SemaphoreError> BinarySemaphore::wakeUpWaiters() noexcept
+{
+    if (m_useFutex)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) required by the futex syscall
+        auto result =
+            posixCall(iox_futex_wake)(reinterpret_cast<uint32_t*>(&m_state), INT_MAX, m_isInterProcessCapable)
+                .failureReturnValue(-1)
+                .evaluate();
+        if (result.has_error())
+        {
+            IOX_LOG(ERROR) << "Unable to wake up the waiters of the binary semaphore";
+            return cxx::error<SemaphoreError>(SemaphoreError::INVALID_SEMAPHORE_HANDLE);
+        }
+        return cxx::success<>();
+    }
+
+    // every blocked waiter has to be woken up, the one which wins the state takes the post and the others
+    // announce themselves again
+    const uint32_t numberOfWaiters = m_numberOfFallbackWaiters.load(std::memory_order_seq_cst);
+    for (uint32_t i = 0U; i < numberOfWaiters; ++i)
+    {
+        auto result = m_fallbackSemaphore->post();
+        if (result.has_error())
+        {
+            return result;
+        }
+    }
+    return cxx::success<>();
+}
+} // namespace posix
+} // namespace iox
@@ -54,7 +54,7 @@ ThreadName_t getThreadName(iox_pthread_t thread) noexcept
 cxx::expected<ThreadError> ThreadBuilder::create(cxx::optional<Thread>& uninitializedThread,
                                                  const Thread::callable_t& callable) noexcept
 {
-    uninitializedThread.emplace(m_name, callable);
+    uninitializedThread.emplace(m_name, callable, m_cpuAffinityMask, m_scheduler, m_schedulerPriority);
 
     const iox_pthread_attr_t* threadAttributes = nullptr;
 
@@ -73,11 +73,18 @@ cxx::expected<ThreadError> ThreadBuilder::create(cxx::optional<Thread>& uninitia
     return cxx::success<>();
 }
 
-Thread::Thread(const ThreadName_t& name, const callable_t& callable) noexcept
+Thread::Thread(const ThreadName_t& name,
+               const callable_t& callable,
+               const uint64_t cpuAffinityMask,
+               const cxx::optional<Scheduler>& scheduler,
+               const int32_t schedulerPriority) noexcept
     : m_threadHandle{}
     , m_callable{callable}
     , m_isThreadConstructed{false}
     , m_threadName{name}
+    , m_cpuAffinityMask{cpuAffinityMask}
+    , m_scheduler{scheduler}
+    , m_schedulerPriority{schedulerPriority}
 {
 }
 
@@ -130,6 +137,32 @@ ThreadError Thread::errnoToEnum(const int errnoValue) noexcept
     }
 }
 
+void Thread::applySchedulingSettings() noexcept
+{
+    auto threadHandle = iox_pthread_self();
+
+    if (m_cpuAffinityMask != 0U)
+    {
+        posixCall(iox_pthread_setaffinity_np)(threadHandle, m_cpuAffinityMask)
+            .successReturnValue(0)
+            .evaluate()
+            .or_else([this](auto& r) {
+                IOX_LOG(WARN) << "failed to set the cpu affinity of thread " << m_threadName << ": "
+                              << r.getHumanReadableErrnum();
+            });
+    }
+
+    m_scheduler.and_then([&](auto& scheduler) {
+        posixCall(iox_pthread_setschedparam)(threadHandle, static_cast<int>(scheduler), m_schedulerPriority)
+            .successReturnValue(0)
+            .evaluate()
+            .or_else([this](auto& r) {
+                IOX_LOG(WARN) << "failed to set the scheduler of thread " << m_threadName << ": "
+                              << r.getHumanReadableErrnum();
+            });
+    });
+}
+
 void* Thread::startRoutine(void* callable)
 {
     auto* self = static_cast<Thread*>(callable);
@@ -143,6 +176,8 @@ void* Thread::startRoutine(void* callable)
             self->m_threadName.clear();
         });
 
+    self->applySchedulingSettings();
+
     self->m_callable();
     return nullptr;
 }
@@ -0,0 +1,225 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "test.hpp"
+
+#include "iceoryx_hoofs/concurrent/sharded_lockfree_queue.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+class ShardedLockFreeQueue_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{16U};
+    static constexpr uint64_t NUMBER_OF_LANES{4U};
+    using Queue_t = iox::concurrent::ShardedLockFreeQueue<uint64_t, CAPACITY, NUMBER_OF_LANES>;
+
+    Queue_t sut;
+};
+
+constexpr uint64_t ShardedLockFreeQueue_test::CAPACITY;
+constexpr uint64_t ShardedLockFreeQueue_test::NUMBER_OF_LANES;
+
+TEST_F(ShardedLockFreeQueue_test, IsEmptyWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c8e7a1b-7f49-4b6a-a0a4-3e91f9cf7d1e");
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.capacity(), Eq(CAPACITY));
+}
+
+TEST_F(ShardedLockFreeQueue_test, CapacityIsMaxCapacityWhenItIsNoMultipleOfLanes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5e57b2e-8e1a-45a4-9d6e-1c7ac1d86d2a");
+    iox::concurrent::ShardedLockFreeQueue<uint64_t, 5U, 4U> smallSut;
+    EXPECT_THAT(smallSut.capacity(), Eq(5U));
+
+    uint64_t numberOfPushedElements{0U};
+    for (uint64_t producer = 0U; producer < NUMBER_OF_LANES; ++producer)
+    {
+        while (smallSut.tryPush(producer, producer))
+        {
+            ++numberOfPushedElements;
+        }
+    }
+    EXPECT_THAT(numberOfPushedElements, Eq(5U));
+}
+
+TEST_F(ShardedLockFreeQueue_test, ElementsOfOneProducerArePoppedInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ad5b2a0-0d1a-4f5e-9c1b-2b6a3e52a5c4");
+    constexpr uint64_t PRODUCER_ID{7U};
+    for (uint64_t i = 0U; i < CAPACITY / NUMBER_OF_LANES; ++i)
+    {
+        EXPECT_TRUE(sut.tryPush(PRODUCER_ID, i));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY / NUMBER_OF_LANES; ++i)
+    {
+        auto element = sut.pop();
+        ASSERT_TRUE(element.has_value());
+        EXPECT_THAT(element.value(), Eq(i));
+    }
+    EXPECT_FALSE(sut.pop().has_value());
+}
+
+TEST_F(ShardedLockFreeQueue_test, LanesArePoppedRoundRobin)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a0f0f4c-9e3b-4d3f-8b2d-6d1c7b3f2e90");
+    constexpr uint64_t ELEMENTS_PER_PRODUCER{3U};
+    for (uint64_t producer = 0U; producer < NUMBER_OF_LANES; ++producer)
+    {
+        for (uint64_t i = 0U; i < ELEMENTS_PER_PRODUCER; ++i)
+        {
+            EXPECT_TRUE(sut.tryPush(producer, producer));
+        }
+    }
+    EXPECT_THAT(sut.size(), Eq(NUMBER_OF_LANES * ELEMENTS_PER_PRODUCER));
+
+    for (uint64_t i = 0U; i < ELEMENTS_PER_PRODUCER; ++i)
+    {
+        for (uint64_t producer = 0U; producer < NUMBER_OF_LANES; ++producer)
+        {
+            auto element = sut.pop();
+            ASSERT_TRUE(element.has_value());
+            EXPECT_THAT(element.value(), Eq(producer));
+        }
+    }
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_F(ShardedLockFreeQueue_test, TryPushFailsOnlyForFullLane)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b3f1b5f-8f0c-4a3e-bc58-3c3d21d8e2b7");
+    for (uint64_t i = 0U; i < CAPACITY / NUMBER_OF_LANES; ++i)
+    {
+        EXPECT_TRUE(sut.tryPush(0U, i));
+    }
+    EXPECT_FALSE(sut.tryPush(0U, 42U));
+    EXPECT_FALSE(sut.tryPush(NUMBER_OF_LANES, 42U));
+    EXPECT_TRUE(sut.tryPush(1U, 42U));
+}
+
+TEST_F(ShardedLockFreeQueue_test, PushOnFullLaneReturnsOldestElementOfThisLane)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b5d2f6c-1d7b-4bc1-9d3b-f47c0a8e6a13");
+    for (uint64_t i = 0U; i < CAPACITY / NUMBER_OF_LANES; ++i)
+    {
+        EXPECT_FALSE(sut.push(2U, i).has_value());
+    }
+
+    auto overflow = sut.push(2U, 42U);
+    ASSERT_TRUE(overflow.has_value());
+    EXPECT_THAT(overflow.value(), Eq(0U));
+}
+
+TEST_F(ShardedLockFreeQueue_test, SetCapacityDistributesCapacityOverLanes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0cbf3a8-6a5f-4d19-9bd4-3c7fbd70a51c");
+    EXPECT_TRUE(sut.setCapacity(6U));
+    EXPECT_THAT(sut.capacity(), Eq(6U));
+
+    // the first two lanes hold the remainder of 6 / 4
+    const std::vector<uint64_t> expectedLaneCapacities{2U, 2U, 1U, 1U};
+    for (uint64_t producer = 0U; producer < NUMBER_OF_LANES; ++producer)
+    {
+        uint64_t laneCapacity{0U};
+        while (sut.tryPush(producer, producer))
+        {
+            ++laneCapacity;
+        }
+        EXPECT_THAT(laneCapacity, Eq(expectedLaneCapacities[producer]));
+    }
+    EXPECT_THAT(sut.size(), Eq(6U));
+}
+
+TEST_F(ShardedLockFreeQueue_test, SetCapacitySmallerThanNumberOfLanesLetsProducersShareTheLanes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f9c1e7a-5b2d-4a86-9c4e-7d0b8a1f6e25");
+    EXPECT_TRUE(sut.setCapacity(1U));
+    EXPECT_THAT(sut.capacity(), Eq(1U));
+
+    EXPECT_TRUE(sut.tryPush(1U, 42U));
+    for (uint64_t producer = 0U; producer < NUMBER_OF_LANES; ++producer)
+    {
+        EXPECT_FALSE(sut.tryPush(producer, 73U));
+    }
+    EXPECT_THAT(sut.size(), Eq(1U));
+
+    auto overflow = sut.push(3U, 73U);
+    ASSERT_TRUE(overflow.has_value());
+    EXPECT_THAT(overflow.value(), Eq(42U));
+}
+
+TEST_F(ShardedLockFreeQueue_test, SetCapacityLargerThanMaxCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a2de0c2-4c9b-4bb3-a9d5-9b1e1c3fd3aa");
+    EXPECT_FALSE(sut.setCapacity(CAPACITY + 1U));
+    EXPECT_THAT(sut.capacity(), Eq(CAPACITY));
+}
+
+TEST_F(ShardedLockFreeQueue_test, ConcurrentProducersDoNotLoseElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e8b4d1f-2a6c-4f0e-b7a9-1d3c5e7f9b02");
+    constexpr uint64_t NUMBER_OF_PRODUCERS{NUMBER_OF_LANES};
+    constexpr uint64_t ELEMENTS_PER_PRODUCER{10000U};
+
+    std::atomic<uint64_t> finishedProducers{0U};
+    std::vector<std::thread> producers;
+    for (uint64_t producer = 0U; producer < NUMBER_OF_PRODUCERS; ++producer)
+    {
+        producers.emplace_back([&, producer] {
+            for (uint64_t i = 0U; i < ELEMENTS_PER_PRODUCER; ++i)
+            {
+                while (!sut.tryPush(producer, producer * ELEMENTS_PER_PRODUCER + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+            ++finishedProducers;
+        });
+    }
+
+    std::vector<uint64_t> nextExpected(NUMBER_OF_PRODUCERS, 0U);
+    uint64_t numberOfPoppedElements{0U};
+    while (numberOfPoppedElements < NUMBER_OF_PRODUCERS * ELEMENTS_PER_PRODUCER)
+    {
+        auto element = sut.pop();
+        if (!element.has_value())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const uint64_t producer = element.value() / ELEMENTS_PER_PRODUCER;
+        EXPECT_THAT(element.value() % ELEMENTS_PER_PRODUCER, Eq(nextExpected[producer]));
+        ++nextExpected[producer];
+        ++numberOfPoppedElements;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_THAT(finishedProducers.load(), Eq(NUMBER_OF_PRODUCERS));
+    EXPECT_TRUE(sut.empty());
+}
+} // namespace
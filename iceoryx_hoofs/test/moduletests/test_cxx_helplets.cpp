@@ -270,6 +270,29 @@ TYPED_TEST(Helplets_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
 
+TEST(Helplets_test_countTrailingZeros, ZeroHasSixtyFourTrailingZeros)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b6f1c3e-8d2a-4e7b-9f5c-1a4d7e0b3c6f");
+    EXPECT_THAT(iox::cxx::countTrailingZeros(0U), Eq(64U));
+}
+
+TEST(Helplets_test_countTrailingZeros, SingleBitValuesReturnBitPosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e2a9d7c-3b1f-4c8e-a6d0-7f4b2e9c1a5d");
+    for (uint64_t bit = 0U; bit < 64U; ++bit)
+    {
+        EXPECT_THAT(iox::cxx::countTrailingZeros(1ULL << bit), Eq(bit));
+    }
+}
+
+TEST(Helplets_test_countTrailingZeros, LowestSetBitDefinesResult)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9d4b2e7-1f6a-4d3c-8e5b-0a7f3c9e2d4b");
+    EXPECT_THAT(iox::cxx::countTrailingZeros(0xF0U), Eq(4U));
+    EXPECT_THAT(iox::cxx::countTrailingZeros(std::numeric_limits<uint64_t>::max()), Eq(0U));
+    EXPECT_THAT(iox::cxx::countTrailingZeros(0x8000000000000100ULL), Eq(8U));
+}
+
 TEST(Helplets_test_isValidFileName, CorrectInternalAsciiAliases)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e729a0a1-e3c4-4d97-a948-d88017f6ac1e");
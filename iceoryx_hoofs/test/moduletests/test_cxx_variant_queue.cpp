@@ -18,6 +18,9 @@
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -44,7 +47,11 @@ class VariantQueue_test : public Test
     }
 
     // if a new fifo type is added this variable has to be adjusted
+    // the sharded queue types are tested separately since their capacity is distributed over multiple lanes
     uint64_t numberOfQueueTypes = 4U;
+
+    const std::vector<VariantQueueTypes> shardedQueueTypes{VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer,
+                                                           VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer};
 };
 
 TEST_F(VariantQueue_test, isEmptyWhenCreated)
@@ -140,6 +147,109 @@ TEST_F(VariantQueue_test, noPopWhenEmpty)
     });
 }
 
+TEST_F(VariantQueue_test, shardedQueuePopsElementsOfOneProducerInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e0b8f51-7cd4-4b55-a1e0-51f0c2f3a7a2");
+    constexpr uint64_t PRODUCER_ID{3U};
+    for (auto queueType : shardedQueueTypes)
+    {
+        VariantQueue<int, 16> sut(queueType);
+        sut.push(14123, PRODUCER_ID);
+        sut.push(24123, PRODUCER_ID);
+        sut.push(34123, PRODUCER_ID);
+
+        EXPECT_THAT(sut.size(), Eq(3U));
+        EXPECT_THAT(sut.pop().value(), Eq(14123));
+        EXPECT_THAT(sut.pop().value(), Eq(24123));
+        EXPECT_THAT(sut.pop().value(), Eq(34123));
+        EXPECT_THAT(sut.pop().has_value(), Eq(false));
+        EXPECT_THAT(sut.empty(), Eq(true));
+    }
+}
+
+TEST_F(VariantQueue_test, shardedQueuePopsElementsOfAllProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5a3e0d6-5f7e-4d0e-8ad3-0a2b6f0c9c61");
+    for (auto queueType : shardedQueueTypes)
+    {
+        VariantQueue<int, 16> sut(queueType);
+        for (int i = 0; i < 4; ++i)
+        {
+            sut.push(i, static_cast<uint64_t>(i));
+        }
+
+        std::vector<int> popped;
+        while (auto element = sut.pop())
+        {
+            popped.push_back(element.value());
+        }
+        std::sort(popped.begin(), popped.end());
+        EXPECT_THAT(popped, ElementsAre(0, 1, 2, 3));
+    }
+}
+
+TEST_F(VariantQueue_test, shardedQueueOverflowIsLimitedToTheLaneOfTheProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d77c4f6-5b65-4f2f-9f3a-7b7f1b2f6d54");
+    constexpr uint64_t CAPACITY{8U};
+    constexpr uint64_t CAPACITY_PER_LANE{CAPACITY / VariantQueue<int, CAPACITY>::NUMBER_OF_SHARDED_LANES};
+    for (auto queueType : shardedQueueTypes)
+    {
+        VariantQueue<int, CAPACITY> sut(queueType);
+        for (uint64_t i = 0U; i < CAPACITY_PER_LANE; ++i)
+        {
+            EXPECT_THAT(sut.push(static_cast<int>(i), 0U).has_value(), Eq(false));
+        }
+
+        EXPECT_THAT(sut.push(1337, 0U).has_value(), Eq(true));
+        EXPECT_THAT(sut.push(1337, 1U).has_value(), Eq(false));
+    }
+}
+
+TEST_F(VariantQueue_test, shardedQueueDistributesCapacityOverLanes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6d6c5b8-2e3c-4c2b-9e6d-3a1f6b0f4e27");
+    for (auto queueType : shardedQueueTypes)
+    {
+        VariantQueue<int, 16> sut(queueType);
+        EXPECT_THAT(sut.capacity(), Eq(16U));
+
+        EXPECT_TRUE(sut.setCapacity(8U));
+        EXPECT_THAT(sut.capacity(), Eq(8U));
+
+        EXPECT_TRUE(sut.setCapacity(6U));
+        EXPECT_THAT(sut.capacity(), Eq(6U));
+
+        EXPECT_TRUE(sut.setCapacity(1U));
+        EXPECT_THAT(sut.capacity(), Eq(1U));
+
+        EXPECT_FALSE(sut.setCapacity(17U));
+    }
+}
+
+TEST_F(VariantQueue_test, forEachStorageSlotVisitsAllStoredElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4e57c37-0194-403d-967e-92553ca60cb3");
+    std::vector<VariantQueueTypes> queueTypes = shardedQueueTypes;
+    PerformTestForQueueTypes([&](uint64_t typeID) { queueTypes.push_back(static_cast<VariantQueueTypes>(typeID)); });
+
+    for (auto queueType : queueTypes)
+    {
+        VariantQueue<int, 8> sut(queueType);
+        sut.push(7, 0U);
+        sut.push(13, 1U);
+        sut.push(42, 2U);
+        sut.pop();
+
+        std::vector<int> slots;
+        sut.forEachStorageSlot([&](const int& slot) { slots.emplace_back(slot); });
+
+        EXPECT_THAT(slots.size(), Ge(8U));
+        EXPECT_THAT(slots, Contains(13));
+        EXPECT_THAT(slots, Contains(42));
+    }
+}
+
 TEST_F(VariantQueue_test, underlyingTypeIsEmptyWhenCreated)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1b8618f8-b0cf-4ef8-bc6d-9bdc330ca09f");
@@ -0,0 +1,287 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_hoofs/posix_wrapper/binary_semaphore.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+
+class BinarySemaphore_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+        ASSERT_FALSE(iox::posix::BinarySemaphoreBuilder().isInterProcessCapable(false).create(sut).has_error());
+    }
+
+    void allBlockedWaitersAreWokenUpByConsecutivePosts(iox::posix::BinarySemaphore& semaphore)
+    {
+        constexpr uint64_t NUMBER_OF_WAITERS{4U};
+        std::atomic<uint64_t> wokenUpWaiters{0U};
+
+        std::vector<std::thread> waiters;
+        for (uint64_t i = 0U; i < NUMBER_OF_WAITERS; ++i)
+        {
+            waiters.emplace_back([&] {
+                ASSERT_FALSE(semaphore.wait().has_error());
+                ++wokenUpWaiters;
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(TIMING_TEST_WAIT_TIME.toNanoseconds()));
+
+        // a lost wake up leaves a waiter blocked forever, the watchdog terminates the test in that case
+        for (uint64_t i = 1U; i <= NUMBER_OF_WAITERS; ++i)
+        {
+            ASSERT_FALSE(semaphore.post().has_error());
+            while (wokenUpWaiters.load() < i)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto& waiter : waiters)
+        {
+            waiter.join();
+        }
+        EXPECT_THAT(wokenUpWaiters.load(), Eq(NUMBER_OF_WAITERS));
+    }
+
+    iox::cxx::optional<iox::posix::BinarySemaphore> sut;
+
+    static constexpr iox::units::Duration WATCHDOG_TIMEOUT = 5_s;
+    static constexpr iox::units::Duration TIMING_TEST_WAIT_TIME = 100_ms;
+    Watchdog deadlockWatchdog{WATCHDOG_TIMEOUT};
+};
+constexpr iox::units::Duration BinarySemaphore_test::WATCHDOG_TIMEOUT;
+constexpr iox::units::Duration BinarySemaphore_test::TIMING_TEST_WAIT_TIME;
+
+TEST_F(BinarySemaphore_test, CreateInterProcessCapableSemaphoreWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d7a5a6c-5d8c-4f2e-9c2a-5f3a1b0e8d41");
+    iox::cxx::optional<iox::posix::BinarySemaphore> semaphore;
+    ASSERT_FALSE(iox::posix::BinarySemaphoreBuilder().isInterProcessCapable(true).create(semaphore).has_error());
+    EXPECT_TRUE(semaphore.has_value());
+}
+
+TEST_F(BinarySemaphore_test, TryWaitFailsWhenNotPosted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b3d2f4e-6a1c-4b8e-8f0d-2c7e9a4b1d63");
+    auto result = sut->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(*result);
+}
+
+TEST_F(BinarySemaphore_test, TryWaitSucceedsOnceAfterPost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4e1c7b2-3f5d-4d9a-b6e8-7c2f1a0d5e94");
+    ASSERT_FALSE(sut->post().has_error());
+
+    auto result = sut->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(*result);
+
+    result = sut->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(*result);
+}
+
+TEST_F(BinarySemaphore_test, MultiplePostsResultInSingleSuccessfulTryWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8f2a6d4-1b7c-4e3f-9a5d-0c6b8e2f4a17");
+    constexpr uint64_t NUMBER_OF_POSTS{10U};
+    for (uint64_t i = 0U; i < NUMBER_OF_POSTS; ++i)
+    {
+        ASSERT_FALSE(sut->post().has_error());
+    }
+
+    auto result = sut->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(*result);
+
+    result = sut->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(*result);
+}
+
+TEST_F(BinarySemaphore_test, WaitAfterPostIsNonBlocking)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c9e7b1a-4d2f-4a6e-8b0c-5f1d7e3a9c28");
+    ASSERT_FALSE(sut->post().has_error());
+    EXPECT_FALSE(sut->wait().has_error());
+}
+
+TEST_F(BinarySemaphore_test, TimedWaitAfterPostIsNonBlocking)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a1f5c3e-9b4d-4c2a-a8e6-1d0b3f7c5e92");
+    ASSERT_FALSE(sut->post().has_error());
+
+    auto result = sut->timedWait(TIMING_TEST_WAIT_TIME);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(*result, Eq(iox::posix::SemaphoreWaitState::NO_TIMEOUT));
+}
+
+TEST_F(BinarySemaphore_test, WaitBlocksUntilPost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6d0e4a8-2c7f-4f1b-9e3d-8a5c1f6b0d47");
+
+    std::chrono::steady_clock::time_point start;
+    std::thread t1([&] {
+        start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::nanoseconds(TIMING_TEST_WAIT_TIME.toNanoseconds()));
+        ASSERT_FALSE(sut->post().has_error());
+    });
+
+    ASSERT_FALSE(sut->wait().has_error());
+    auto end = std::chrono::steady_clock::now();
+
+    t1.join();
+    EXPECT_THAT(std::chrono::nanoseconds(end - start).count(), Ge(TIMING_TEST_WAIT_TIME.toNanoseconds()));
+}
+
+TEST_F(BinarySemaphore_test, TimedWaitBlocksAtLeastTimeoutAndSignalsTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e4b8d2c-6f0a-4a7e-b3c9-5d2f8e1a6c03");
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = sut->timedWait(TIMING_TEST_WAIT_TIME);
+    auto end = std::chrono::steady_clock::now();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(*result, Eq(iox::posix::SemaphoreWaitState::TIMEOUT));
+    EXPECT_THAT(std::chrono::nanoseconds(end - start).count(), Ge(TIMING_TEST_WAIT_TIME.toNanoseconds()));
+}
+
+TEST_F(BinarySemaphore_test, PostAfterTimedOutWaitWakesUpNextWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d3a6f0e-8c1b-4e5d-a2f7-4b0c9e6d3a18");
+
+    auto result = sut->timedWait(1_ms);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(*result, Eq(iox::posix::SemaphoreWaitState::TIMEOUT));
+
+    ASSERT_FALSE(sut->post().has_error());
+    EXPECT_FALSE(sut->wait().has_error());
+}
+
+TEST_F(BinarySemaphore_test, ConcurrentPostAndWaitDoesNotLoseWakeUps)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2c8a4e6-0b9d-4d3f-8e1a-6c7b2d5f9e30");
+    constexpr uint64_t NUMBER_OF_ITERATIONS{10000U};
+
+    iox::cxx::optional<iox::posix::BinarySemaphore> acknowledge;
+    ASSERT_FALSE(iox::posix::BinarySemaphoreBuilder().isInterProcessCapable(false).create(acknowledge).has_error());
+
+    std::thread waiter([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+        {
+            ASSERT_FALSE(sut->wait().has_error());
+            ASSERT_FALSE(acknowledge->post().has_error());
+        }
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        ASSERT_FALSE(sut->post().has_error());
+        ASSERT_FALSE(acknowledge->wait().has_error());
+    }
+
+    waiter.join();
+}
+
+TEST_F(BinarySemaphore_test, AllBlockedWaitersAreWokenUpByConsecutivePosts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e0b3c9a-2f4d-4a81-b7c5-9d1e8f3a0c52");
+    allBlockedWaitersAreWokenUpByConsecutivePosts(*sut);
+}
+
+TEST_F(BinarySemaphore_test, AllBlockedWaitersAreWokenUpByConsecutivePostsWithFallbackSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3a7f1d8-5b2e-4c96-8e0a-4d6b2f9c1e73");
+    iox::cxx::optional<iox::posix::BinarySemaphore> semaphore;
+    ASSERT_FALSE(iox::posix::BinarySemaphoreBuilder()
+                     .isInterProcessCapable(false)
+                     .useFallbackSemaphore(true)
+                     .create(semaphore)
+                     .has_error());
+    allBlockedWaitersAreWokenUpByConsecutivePosts(*semaphore);
+}
+
+TEST_F(BinarySemaphore_test, TimedOutWaiterDoesNotBlockNextWaiterWithFallbackSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b1d4e7f-0a3c-4f52-9c6e-2e5a7b0d9f14");
+    iox::cxx::optional<iox::posix::BinarySemaphore> semaphore;
+    ASSERT_FALSE(iox::posix::BinarySemaphoreBuilder()
+                     .isInterProcessCapable(false)
+                     .useFallbackSemaphore(true)
+                     .create(semaphore)
+                     .has_error());
+
+    auto result = semaphore->timedWait(TIMING_TEST_WAIT_TIME);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(*result, Eq(iox::posix::SemaphoreWaitState::TIMEOUT));
+
+    std::thread waiter([&] { ASSERT_FALSE(semaphore->wait().has_error()); });
+    std::this_thread::sleep_for(std::chrono::nanoseconds(TIMING_TEST_WAIT_TIME.toNanoseconds()));
+    ASSERT_FALSE(semaphore->post().has_error());
+    waiter.join();
+}
+
+TEST_F(BinarySemaphore_test, ConcurrentPostAndWaitDoesNotLoseWakeUpsWithFallbackSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f9c2a6e-7d1b-4e38-a5f0-1c8e3b6d2a97");
+    constexpr uint64_t NUMBER_OF_ITERATIONS{10000U};
+
+    iox::cxx::optional<iox::posix::BinarySemaphore> semaphore;
+    iox::cxx::optional<iox::posix::BinarySemaphore> acknowledge;
+    ASSERT_FALSE(iox::posix::BinarySemaphoreBuilder()
+                     .isInterProcessCapable(false)
+                     .useFallbackSemaphore(true)
+                     .create(semaphore)
+                     .has_error());
+    ASSERT_FALSE(iox::posix::BinarySemaphoreBuilder()
+                     .isInterProcessCapable(false)
+                     .useFallbackSemaphore(true)
+                     .create(acknowledge)
+                     .has_error());
+
+    std::thread waiter([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+        {
+            ASSERT_FALSE(semaphore->wait().has_error());
+            ASSERT_FALSE(acknowledge->post().has_error());
+        }
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        ASSERT_FALSE(semaphore->post().has_error());
+        ASSERT_FALSE(acknowledge->wait().has_error());
+    }
+
+    waiter.join();
+}
+} // namespace
@@ -21,6 +21,10 @@
 
 #include <thread>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 namespace
 {
 using namespace ::testing;
@@ -111,4 +115,35 @@ TEST_F(Thread_test, SetAndGetSmallStringIsWorking)
 
     EXPECT_THAT(getResult, StrEq(stringShorterThanThreadNameCapacitiy));
 }
+#if defined(__linux__)
+TEST_F(Thread_test, ThreadRunsOnlyOnTheCpuCoresOfTheAffinityMask)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f8c2a1e-7d3b-4e6a-9c5f-1b0d8e2a7c64");
+    constexpr uint64_t FIRST_CPU_CORE_ONLY{1U};
+    int cpuCore{-1};
+    ASSERT_FALSE(ThreadBuilder()
+                     .cpuAffinityMask(FIRST_CPU_CORE_ONLY)
+                     .create(sut, [&] { cpuCore = sched_getcpu(); })
+                     .has_error());
+    sut.reset();
+
+    EXPECT_THAT(cpuCore, Eq(0));
+}
+#endif
+
+TEST_F(Thread_test, ThreadIsStartedEvenWhenSchedulerCouldNotBeApplied)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2e7d4a9-3c1f-4b8e-a6d0-5f9c2e1b7a38");
+    bool callableWasCalled = false;
+    // without the required privileges setting the FIFO scheduler fails, with them it succeeds, in both cases the
+    // callable must be executed
+    ASSERT_FALSE(ThreadBuilder()
+                     .scheduler(Scheduler::FIFO)
+                     .schedulerPriority(getSchedulerPriorityMinimum(Scheduler::FIFO))
+                     .create(sut, [&] { callableWasCalled = true; })
+                     .has_error());
+    sut.reset();
+
+    EXPECT_TRUE(callableWasCalled);
+}
 } // namespace
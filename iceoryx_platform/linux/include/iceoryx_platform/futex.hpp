@@ -0,0 +1,45 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
+#define IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
+
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/// @brief blocks until the value at address is no longer expectedValue or a wake up occurred
+/// @param[in] relativeTimeout the maximum time to block, nullptr blocks without a timeout
+/// @param[in] isInterProcessCapable false if the address is only shared between threads of this process
+inline int iox_futex_wait(uint32_t* address,
+                          const uint32_t expectedValue,
+                          const struct timespec* relativeTimeout,
+                          const bool isInterProcessCapable)
+{
+    const int operation = (isInterProcessCapable) ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE;
+    return static_cast<int>(syscall(SYS_futex, address, operation, expectedValue, relativeTimeout, nullptr, 0));
+}
+
+/// @brief wakes up to numberOfWaiters threads blocked in iox_futex_wait on address
+/// @return the number of woken up threads or -1 on failure
+inline int iox_futex_wake(uint32_t* address, const int numberOfWaiters, const bool isInterProcessCapable)
+{
+    const int operation = (isInterProcessCapable) ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE;
+    return static_cast<int>(syscall(SYS_futex, address, operation, numberOfWaiters, nullptr, nullptr, 0));
+}
+
+#endif // IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
@@ -0,0 +1,80 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LINUX_PLATFORM_PIDFD_HPP
+#define IOX_HOOFS_LINUX_PLATFORM_PIDFD_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+/// @brief opens a file descriptor which refers to the process and becomes readable when the process terminates
+/// @return the file descriptor or -1 on failure, errno is ENOSYS when the kernel does not support pidfds
+inline int iox_pidfd_open(const uint32_t pid)
+{
+#if defined(SYS_pidfd_open)
+    return static_cast<int>(syscall(SYS_pidfd_open, static_cast<pid_t>(pid), 0U));
+#else
+    static_cast<void>(pid);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+/// @brief creates a set of pidfds on which one can wait for the termination of any of the processes
+/// @return the file descriptor of the set or -1 on failure
+inline int iox_pidfd_set_create()
+{
+    return epoll_create1(EPOLL_CLOEXEC);
+}
+
+/// @brief adds a pidfd to the set, the pidfd is removed automatically when it is closed
+inline int iox_pidfd_set_add(const int pidfdSet, const int pidfd)
+{
+    struct epoll_event event
+    {
+    };
+    event.events = EPOLLIN;
+    event.data.fd = pidfd;
+    return epoll_ctl(pidfdSet, EPOLL_CTL_ADD, pidfd, &event);
+}
+
+/// @brief blocks until a process of the set terminated or the timeout passed
+/// @return a value greater than zero if a process terminated, 0 on timeout or -1 on failure
+inline int iox_pidfd_set_wait(const int pidfdSet, const int timeoutInMilliseconds)
+{
+    struct epoll_event event
+    {
+    };
+    return epoll_wait(pidfdSet, &event, 1, timeoutInMilliseconds);
+}
+
+/// @brief checks without blocking whether the process of the pidfd terminated
+/// @return 1 if the process terminated, 0 if it is still running or -1 on failure
+inline int iox_pidfd_has_terminated(const int pidfd)
+{
+    struct pollfd pollFd
+    {
+    };
+    pollFd.fd = pidfd;
+    pollFd.events = POLLIN;
+    return poll(&pollFd, 1U, 0);
+}
+
+#endif // IOX_HOOFS_LINUX_PLATFORM_PIDFD_HPP
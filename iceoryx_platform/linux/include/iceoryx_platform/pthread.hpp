@@ -17,7 +17,9 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 
+#include <cstdint>
 #include <pthread.h>
+#include <sched.h>
 
 using iox_pthread_t = pthread_t;
 using iox_pthread_attr_t = pthread_attr_t;
@@ -48,4 +50,25 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+inline int iox_pthread_setaffinity_np(iox_pthread_t thread, uint64_t cpuMask)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint64_t cpu = 0U; cpu < 64U; ++cpu)
+    {
+        if ((cpuMask & (static_cast<uint64_t>(1U) << cpu)) != 0U)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+}
+
+inline int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    struct sched_param parameter = {};
+    parameter.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &parameter);
+}
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
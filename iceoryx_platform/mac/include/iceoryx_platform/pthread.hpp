@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 
+#include <cstdint>
 #include <pthread.h>
 
 #define PTHREAD_MUTEX_STALLED 1
@@ -34,6 +35,10 @@ int iox_pthread_create(iox_pthread_t* thread, const iox_pthread_attr_t* attr, vo
 int iox_pthread_join(iox_pthread_t thread, void** retval);
 
 iox_pthread_t iox_pthread_self();
+
+int iox_pthread_setaffinity_np(iox_pthread_t thread, uint64_t cpuMask);
+
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority);
 int pthread_mutexattr_setrobust(pthread_mutexattr_t*, int);
 
 
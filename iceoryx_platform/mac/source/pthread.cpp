@@ -16,7 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/pthread.hpp"
-
+#include <cerrno>
 #include <map>
 #include <mutex>
 #include <string>
@@ -71,6 +71,19 @@ iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+int iox_pthread_setaffinity_np(iox_pthread_t, uint64_t)
+{
+    // macOS provides only affinity tags as a hint for the scheduler but no binding to a cpu core
+    return ENOSYS;
+}
+
+int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    struct sched_param parameter = {};
+    parameter.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &parameter);
+}
+
 int pthread_mutexattr_setrobust(pthread_mutexattr_t*, int)
 {
     return 0;
@@ -0,0 +1,54 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_QNX_PLATFORM_PIDFD_HPP
+#define IOX_HOOFS_QNX_PLATFORM_PIDFD_HPP
+
+#include <cerrno>
+#include <cstdint>
+
+/// pidfds are not available on this platform, see IOX_SUPPORT_PIDFD in platform_settings.hpp
+
+inline int iox_pidfd_open(const uint32_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_pidfd_set_create()
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_pidfd_set_add(const int, const int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_pidfd_set_wait(const int, const int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_pidfd_has_terminated(const int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+#endif // IOX_HOOFS_QNX_PLATFORM_PIDFD_HPP
@@ -17,7 +17,10 @@
 #ifndef IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
+#include <sched.h>
 
 #define PTHREAD_MUTEX_RECURSIVE_NP PTHREAD_MUTEX_RECURSIVE
 #define PTHREAD_MUTEX_FAST_NP PTHREAD_MUTEX_NORMAL
@@ -51,4 +54,17 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+/// @brief the thread affinity is not supported on this platform
+inline int iox_pthread_setaffinity_np(iox_pthread_t, uint64_t)
+{
+    return ENOSYS;
+}
+
+inline int iox_pthread_setschedparam(iox_pthread_t thread, int policy, int priority)
+{
+    struct sched_param parameter = {};
+    parameter.sched_priority = priority;
+    return pthread_setschedparam(thread, policy, &parameter);
+}
+
 #endif // IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
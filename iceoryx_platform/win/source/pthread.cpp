@@ -92,6 +92,17 @@ iox_pthread_t iox_pthread_self()
     return GetCurrentThread();
 }
 
+int iox_pthread_setaffinity_np(iox_pthread_t thread, uint64_t cpuMask)
+{
+    return Win32Call(SetThreadAffinityMask, thread, static_cast<DWORD_PTR>(cpuMask)).error;
+}
+
+int iox_pthread_setschedparam(iox_pthread_t thread, int, int)
+{
+    // windows has no fifo scheduler, the closest equivalent is the highest thread priority
+    return Win32Call(SetThreadPriority, thread, THREAD_PRIORITY_TIME_CRITICAL).error;
+}
+
 int pthread_mutexattr_destroy(pthread_mutexattr_t* attr)
 {
     return 0;
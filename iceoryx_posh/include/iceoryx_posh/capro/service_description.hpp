@@ -151,6 +151,10 @@ class ServiceDescription
     /// @brief Returns the interface form where the service is coming from.
     Interfaces getSourceInterface() const noexcept;
 
+    /// @brief Returns a hash of the service, instance and event string, service descriptions which compare equal
+    ///        have the same hash
+    uint64_t hash() const noexcept;
+
   private:
     /// @brief string representation of the service
     IdString_t m_serviceString;
@@ -72,6 +72,7 @@ namespace iox
     error(POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW) \
     error(POSH__INTERFACEPORT_CAPRO_MESSAGE_DISMISSED) \
     error(POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_EVENT_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED) \
+    error(POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_EVENT_SINCE_DEADLINE_MISSED_ALREADY_ATTACHED) \
     error(POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_STATE_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_CLIENT_OVERRIDING_WITH_EVENT_SINCE_HAS_RESPONSE_OR_RESPONSE_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_CLIENT_OVERRIDING_WITH_STATE_SINCE_HAS_RESPONSE_OR_RESPONSE_RECEIVED_ALREADY_ATTACHED) \
@@ -100,8 +101,12 @@ namespace iox
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT) \
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET) \
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
+    error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_ADD_TIMER) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE) \
+    error(POPO__LISTENER_FAILED_TO_CREATE_WORKER_THREAD) \
+    error(POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED) \
     error(POPO__NOTIFICATION_INFO_TYPE_INCONSISTENCY_IN_GET_ORIGIN) \
     error(POPO__TYPED_UNIQUE_ID_ROUDI_HAS_ALREADY_DEFINED_CUSTOM_UNIQUE_ID) \
     error(POPO__TYPED_UNIQUE_ID_OVERFLOW) \
@@ -127,6 +132,8 @@ namespace iox
     error(PORT_POOL__INTERFACELIST_OVERFLOW) \
     error(PORT_POOL__NODELIST_OVERFLOW) \
     error(PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW) \
+    error(PORT_POOL__HEARTBEAT_LIST_OVERFLOW) \
+    error(PORT_POOL__COMMAND_CHANNEL_LIST_OVERFLOW) \
     error(PORT_MANAGER__PORT_POOL_UNAVAILABLE) \
     error(PORT_MANAGER__INTROSPECTION_MEMORY_MANAGER_UNAVAILABLE) \
     error(PORT_MANAGER__HANDLE_PUBLISHER_PORTS_INVALID_CAPRO_MESSAGE) \
@@ -150,6 +157,7 @@ namespace iox
     error(IPC_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_CHANNEL) \
     error(IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS) \
     error(IPC_INTERFACE__REG_ACK_NO_RESPONSE) \
+    error(IPC_INTERFACE__COMMAND_CHANNEL_FAILED_TO_CREATE_SEMAPHORE) \
     error(IPC_INTERFACE__APP_WITH_SAME_NAME_STILL_RUNNING) \
     error(IPC_INTERFACE__COULD_NOT_ACQUIRE_FILE_LOCK)
 
@@ -69,8 +69,11 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// 1x publisherPort runtime message introspection
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
+// 1x publisherPort service registry
+// 1x publisherPort service registry changes
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -106,6 +109,7 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_LISTENER_WORKERS = 16U;
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -136,6 +140,10 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_CHANGE_EVENT_NAME[] = "ServiceRegistryChange";
+/// @brief the number of changes a ServiceDiscovery can receive between two searches before it has to copy the
+///        complete service registry
+constexpr uint32_t SERVICE_REGISTRY_CHANGE_QUEUE_CAPACITY = 64U;
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = 1000U;
@@ -223,11 +231,24 @@ constexpr const char SHM_NAME[] = "iceoryx_mgmt";
 // this is used by the UniquePortId
 constexpr uint16_t DEFAULT_UNIQUE_ROUDI_ID{0U};
 
+/// @brief the number of threads which process the messages of the runtimes, with more than one thread the
+///        registration and the port requests of different runtimes are processed concurrently
+constexpr uint32_t DEFAULT_RUNTIME_MESSAGES_THREAD_COUNT{1U};
+constexpr uint32_t MAX_RUNTIME_MESSAGES_THREAD_COUNT{16U};
+
+/// @brief the maximum number of connections of the static topology in the RouDi config and the maximum number of
+///        subscribers of one connection
+constexpr uint32_t MAX_STATIC_CONNECTIONS{64U};
+constexpr uint32_t MAX_SUBSCRIBERS_PER_STATIC_CONNECTION{8U};
+
 // Timeout
 using namespace units::duration_literals;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+/// @brief minimal time between two searches for chunks which were leaked by terminated processes, a search is repeated
+/// when it was discarded since a port transferred a chunk in the meantime
+constexpr units::Duration CHUNK_GARBAGE_COLLECTION_INTERVAL = 1_s;
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
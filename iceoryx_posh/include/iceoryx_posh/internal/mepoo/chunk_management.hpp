@@ -38,13 +38,21 @@ struct ChunkManagement
 
     ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                     const cxx::not_null<MemPool*> mempool,
-                    const cxx::not_null<MemPool*> chunkManagementPool) noexcept;
+                    const cxx::not_null<MemPool*> chunkManagementPool,
+                    const uint64_t obtainedInCollection = 0U) noexcept;
 
     iox::memory::RelativePointer<base_t> m_chunkHeader;
-    referenceCounter_t m_referenceCounter{1U};
+    /// @brief is set to one by the constructor after all other members are initialized
+    referenceCounter_t m_referenceCounter{0U};
 
     iox::memory::RelativePointer<MemPool> m_mempool;
     iox::memory::RelativePointer<MemPool> m_chunkManagementPool;
+
+    /// @brief the last collection of the ChunkGarbageCollector in RouDi which found a reference to the chunk
+    std::atomic<uint64_t> m_referencedInCollection{0U};
+    /// @brief the last collection of the ChunkGarbageCollector in RouDi which was started when the chunk was obtained,
+    /// this collection must not reclaim the chunk
+    std::atomic<uint64_t> m_obtainedInCollection{0U};
 };
 } // namespace mepoo
 } // namespace iox
@@ -18,6 +18,7 @@
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
@@ -36,12 +37,14 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint32_t reclaimedChunks = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    uint32_t m_reclaimedChunks{0};
 };
 
 class MemPool
@@ -69,6 +72,23 @@ class MemPool
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Returns the chunk with the given index, independent of whether it is used or free
+    /// @param[in] index of the chunk, must be smaller than getChunkCount()
+    /// @return pointer to the chunk
+    void* getChunkByIndex(const uint32_t index) const noexcept;
+
+    /// @brief Looks up the index of the chunk which begins at the given address
+    /// @param[in] chunk the address to look up, it is not accessed
+    /// @return the index of the chunk or nullopt if the address is not the beginning of a chunk of this MemPool
+    cxx::optional<uint32_t> getChunkIndex(const void* chunk) const noexcept;
+
+    /// @brief Frees a chunk which was leaked by a terminated process and counts it as reclaimed
+    /// @param[in] chunk to free, it must not be referenced anymore
+    void reclaimChunk(const void* chunk) noexcept;
+
+    /// @brief returns the number of chunks which were reclaimed since the creation of the MemPool
+    uint32_t getReclaimedChunks() const noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
@@ -82,6 +102,7 @@ class MemPool
 
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
+    std::atomic<uint32_t> m_reclaimedChunks{0U};
 
     freeList_t m_freeIndices;
 };
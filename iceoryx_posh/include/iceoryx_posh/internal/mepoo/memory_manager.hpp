@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -73,6 +74,28 @@ class MemoryManager
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief calls the callable with every ChunkManagement which is or was in use, the ChunkManagements of
+    ///        already released chunks have a reference counter of zero
+    /// @param[in] callable which is called with a ChunkManagement&
+    template <typename Callable>
+    void forEachChunkManagement(const Callable& callable) noexcept;
+
+    /// @brief Looks up the ChunkManagement of this MemoryManager at the given address
+    /// @param[in] address to look up, it is not accessed when it does not belong to this MemoryManager
+    /// @return the ChunkManagement at the address or nullptr if the address is not a ChunkManagement of this
+    /// MemoryManager
+    ChunkManagement* findChunkManagement(const void* const address) noexcept;
+
+    /// @brief Releases a chunk which is still in use but not referenced anymore, e.g. because the process which
+    ///        held it terminated abnormally, the chunk is counted as reclaimed in its mempool
+    /// @param[in] chunkManagement of the chunk to release
+    void reclaimChunk(ChunkManagement& chunkManagement) noexcept;
+
+    /// @brief Stores the collection of the ChunkGarbageCollector in RouDi which is started, every chunk which is
+    ///        obtained afterwards is stamped with it and is not reclaimed by this collection
+    /// @param[in] collection the number of the started collection
+    void startGarbageCollection(const uint64_t collection) noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
@@ -93,6 +116,7 @@ class MemoryManager
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+    std::atomic<uint64_t> m_lastStartedGarbageCollection{0U};
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
@@ -21,6 +21,26 @@ namespace iox
 {
 namespace mepoo
 {
+template <typename Callable>
+inline void MemoryManager::forEachChunkManagement(const Callable& callable) noexcept
+{
+    if (m_chunkManagementPool.empty())
+    {
+        return;
+    }
+
+    auto& chunkManagementPool = m_chunkManagementPool.front();
+    for (uint32_t i = 0U; i < chunkManagementPool.getChunkCount(); ++i)
+    {
+        auto chunkManagement = static_cast<ChunkManagement*>(chunkManagementPool.getChunkByIndex(i));
+        // a ChunkManagement which was never constructed does not point back to its pool
+        if (chunkManagement->m_chunkManagementPool.get() == &chunkManagementPool)
+        {
+            callable(*chunkManagement);
+        }
+    }
+}
+
 inline constexpr const char* asStringLiteral(const MemoryManager::Error value) noexcept
 {
     switch (value)
@@ -131,6 +131,16 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
     return segmentInfo;
 }
 
+template <typename SegmentType>
+template <typename Callable>
+inline void SegmentManager<SegmentType>::forEachMemoryManager(const Callable& callable) noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        callable(segment.getMemoryManager());
+    }
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
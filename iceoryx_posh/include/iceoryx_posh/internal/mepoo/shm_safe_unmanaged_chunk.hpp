@@ -59,6 +59,10 @@ class ShmSafeUnmanagedChunk
     /// @return true if neither logically a nullptr nor other owner chunk owners present, otherwise false
     bool isNotLogicalNullptrAndHasNoOtherOwners() const noexcept;
 
+    /// @brief Computes the address of the ChunkManagement of the underlying chunk without accessing it
+    /// @return the address of the ChunkManagement or nullptr if isLogicalNullptr would return true
+    const ChunkManagement* getChunkManagementAddress() const noexcept;
+
   private:
     memory::RelativePointerData m_chunkManagement;
 };
@@ -40,7 +40,10 @@ using uid_t = UniquePortId;
 
 enum class SubscriberEvent : EventEnumIdentifier
 {
-    DATA_RECEIVED
+    DATA_RECEIVED,
+    /// @brief no sample arrived within the deadline of the SubscriberOptions, it is monitored by the thread which
+    ///        waits on the WaitSet/Listener and can be attached in addition to DATA_RECEIVED
+    DEADLINE_MISSED
 };
 
 enum class SubscriberState : StateEnumIdentifier
@@ -163,6 +166,8 @@ class BaseSubscriber
   protected:
     port_t m_port{nullptr};
     TriggerHandle m_trigger;
+    TriggerHandle m_deadlineTrigger;
+    units::Duration m_deadline{units::Duration::zero()};
 };
 
 } // namespace popo
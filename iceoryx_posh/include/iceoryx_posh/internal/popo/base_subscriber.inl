@@ -35,6 +35,7 @@ template <typename port_t>
 inline BaseSubscriber<port_t>::BaseSubscriber(const capro::ServiceDescription& service,
                                               const SubscriberOptions& subscriberOptions) noexcept
     : m_port(iox::runtime::PoshRuntime::getInstance().getMiddlewareSubscriber(service, subscriberOptions))
+    , m_deadline(subscriberOptions.deadline)
 {
 }
 
@@ -106,6 +107,10 @@ inline void BaseSubscriber<port_t>::invalidateTrigger(const uint64_t uniqueTrigg
         m_port.unsetConditionVariable();
         m_trigger.invalidate();
     }
+    else if (m_deadlineTrigger.getUniqueId() == uniqueTriggerId)
+    {
+        m_deadlineTrigger.invalidate();
+    }
 }
 
 template <typename port_t>
@@ -179,6 +184,23 @@ inline void BaseSubscriber<port_t>::enableEvent(iox::popo::TriggerHandle&& trigg
         m_trigger = std::move(triggerHandle);
         m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
         break;
+    case SubscriberEvent::DEADLINE_MISSED:
+        if (m_deadlineTrigger)
+        {
+            LogWarn() << "The subscriber is already attached with SubscriberEvent::DEADLINE_MISSED to a "
+                         "WaitSet/Listener. Detaching it from previous one and attaching it to the new one with "
+                         "SubscriberEvent::DEADLINE_MISSED. Best practice is to call detach first.";
+            errorHandler(PoshError::POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_EVENT_SINCE_DEADLINE_MISSED_ALREADY_ATTACHED,
+                         ErrorLevel::MODERATE);
+        }
+        m_deadlineTrigger = std::move(triggerHandle);
+        // the timer of the WaitSet/Listener observes the received chunks, no notification is required per sample
+        if (!m_deadlineTrigger.enableTimer(m_deadline, &m_port.getNumberOfReceivedChunks()))
+        {
+            LogWarn() << "The SubscriberEvent::DEADLINE_MISSED is never triggered since no deadline is set in the "
+                         "SubscriberOptions.";
+        }
+        break;
     }
 }
 
@@ -191,6 +213,9 @@ inline void BaseSubscriber<port_t>::disableEvent(const SubscriberEvent subscribe
         m_trigger.reset();
         m_port.unsetConditionVariable();
         break;
+    case SubscriberEvent::DEADLINE_MISSED:
+        m_deadlineTrigger.reset();
+        break;
     }
 }
 
@@ -45,6 +45,8 @@ struct ChunkQueueData : public LockingPolicy
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
+    /// @brief counts every chunk which was pushed, it is used to detect that no chunk arrived within a period
+    std::atomic<uint64_t> m_numberOfPushedChunks{0U};
 
     memory::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
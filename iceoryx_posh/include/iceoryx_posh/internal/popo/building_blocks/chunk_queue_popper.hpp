@@ -54,6 +54,9 @@ class ChunkQueuePopper
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
 
+    /// @brief returns the counter which is incremented whenever a chunk is pushed into the queue
+    const std::atomic<uint64_t>& getNumberOfPushedChunks() const noexcept;
+
     /// @brief pop a chunk from the chunk queue
     /// @return if the queue is empty return true, otherwise false
     bool empty() const noexcept;
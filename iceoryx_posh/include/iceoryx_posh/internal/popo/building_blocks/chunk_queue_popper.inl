@@ -72,6 +72,12 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     }
 }
 
+template <typename ChunkQueueDataType>
+inline const std::atomic<uint64_t>& ChunkQueuePopper<ChunkQueueDataType>::getNumberOfPushedChunks() const noexcept
+{
+    return getMembers()->m_numberOfPushedChunks;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
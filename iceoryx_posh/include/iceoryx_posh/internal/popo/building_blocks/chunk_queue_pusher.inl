@@ -46,7 +46,12 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
 {
-    auto pushRet = getMembers()->m_queue.push(chunk);
+    // the origin id selects the lane of the sharded queues, all other queue types ignore it; an empty chunk has no
+    // origin and uses the first lane
+    const auto chunkHeader = chunk.getChunkHeader();
+    const uint64_t origin = (chunkHeader != nullptr) ? static_cast<uint64_t>(chunkHeader->originId()) : 0U;
+    auto pushRet = getMembers()->m_queue.push(chunk, origin);
+    getMembers()->m_numberOfPushedChunks.fetch_add(1U, std::memory_order_relaxed);
     bool hasQueueOverflow = false;
 
     // drop the chunk if one is returned by an overflow
@@ -74,6 +74,7 @@ template <typename ChunkReceiverDataType>
 inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
 ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
 {
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
     auto popRet = this->tryPop();
 
     if (popRet.has_value())
@@ -99,6 +100,7 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
     mepoo::SharedChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
     if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
@@ -107,6 +109,13 @@ inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHead
     }
 }
 
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::clear() noexcept
+{
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
+    Base_t::clear();
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
@@ -103,6 +103,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
                                               const uint32_t userHeaderSize,
                                               const uint32_t userHeaderAlignment) noexcept
 {
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
     // use the chunk stored in m_lastChunkUnmanaged if:
     //   - there is a valid chunk
     //   - there is no other owner
@@ -139,7 +140,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
     else
     {
-        // BEGIN of critical section, chunk will be lost if the process terminates in this section
+        // BEGIN of critical section, only RouDi can reclaim the chunk if the process terminates in this section
         // get a new chunk
         auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
 
@@ -172,6 +173,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
     mepoo::SharedChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
     if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
@@ -183,9 +185,10 @@ inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader*
 template <typename ChunkSenderDataType>
 inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
     uint64_t numberOfReceiverTheChunkWasDelivered{0};
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // BEGIN of critical section, only RouDi can reclaim the chunk if the process terminates in this section
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(chunk);
@@ -203,8 +206,9 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
                                                           const cxx::UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) noexcept
 {
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // BEGIN of critical section, only RouDi can reclaim the chunk if the process terminates in this section
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
@@ -222,8 +226,9 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    ChunkTransferTracker::Transfer transfer(getMembers()->m_transferTracker);
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // BEGIN of critical section, only RouDi can reclaim the chunk if the process terminates in this section
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         this->addToHistoryWithoutDelivery(chunk);
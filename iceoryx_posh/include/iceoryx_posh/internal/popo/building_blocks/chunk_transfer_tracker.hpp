@@ -0,0 +1,80 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRANSFER_TRACKER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRANSFER_TRACKER_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Tracks in the port data when a port holds a chunk outside of the port data, e.g. after a chunk was taken
+///        from the queue but before it was stored in the used chunk list or while a chunk is delivered to the queues.
+///        The ChunkGarbageCollector of RouDi uses it to detect that a chunk could have been moved while it inspected
+///        the port data.
+class ChunkTransferTracker
+{
+  public:
+    /// @brief Marks the lifetime of a transfer, the transfer is started by the constructor and finished by the
+    ///        destructor. It must be created before any SharedChunk which is used in the transfer since the chunk
+    ///        must be released before the transfer is finished.
+    class Transfer
+    {
+      public:
+        explicit Transfer(ChunkTransferTracker& tracker) noexcept;
+
+        Transfer(const Transfer&) = delete;
+        Transfer(Transfer&&) = delete;
+        Transfer& operator=(const Transfer&) = delete;
+        Transfer& operator=(Transfer&&) = delete;
+        ~Transfer() noexcept;
+
+      private:
+        ChunkTransferTracker& m_tracker;
+    };
+
+    ChunkTransferTracker() noexcept = default;
+
+    ChunkTransferTracker(const ChunkTransferTracker&) = delete;
+    ChunkTransferTracker(ChunkTransferTracker&&) = delete;
+    ChunkTransferTracker& operator=(const ChunkTransferTracker&) = delete;
+    ChunkTransferTracker& operator=(ChunkTransferTracker&&) = delete;
+    ~ChunkTransferTracker() noexcept = default;
+
+    /// @brief Returns the number of transfers which were started so far, the counter wraps around
+    /// @return the number of started transfers or cxx::nullopt when a transfer is in progress
+    /// @note threadsafe, lockfree
+    cxx::optional<uint32_t> getNumberOfStartedTransfers() const noexcept;
+
+  private:
+    // the upper half counts the started transfers and the lower half the transfers in progress, a single atomic is
+    // required since both must be read at once
+    static constexpr uint64_t IN_PROGRESS_MASK{0xFFFFFFFFU};
+    static constexpr uint64_t STARTED_TRANSFERS_SHIFT{32U};
+    static constexpr uint64_t START_OF_TRANSFER{(static_cast<uint64_t>(1U) << STARTED_TRANSFERS_SHIFT) + 1U};
+
+    std::atomic<uint64_t> m_state{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_TRANSFER_TRACKER_HPP
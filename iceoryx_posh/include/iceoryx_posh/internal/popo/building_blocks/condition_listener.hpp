@@ -19,7 +19,11 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/timer_wheel.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
+
+#include <mutex>
 
 namespace iox
 {
@@ -31,7 +35,9 @@ class ConditionListener
   public:
     using NotificationVector_t = cxx::vector<cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @param[in] condVarData the condition variable data on which the listener waits
+    /// @param[in] waitOptions defines if and how long the listener polls for notifications before it blocks
+    explicit ConditionListener(ConditionVariableData& condVarData, const WaitOptions& waitOptions = {}) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -64,19 +70,44 @@ class ConditionListener
     /// @return a sorted vector of active notifications
     NotificationVector_t timedWait(const units::Duration& timeToWait) noexcept;
 
+    /// @brief Arms a periodic timer which activates the notification of the index whenever it expires. The timers
+    ///        are handled in wait() and timedWait() of the thread which waits on the ConditionListener, therefore no
+    ///        additional thread is required. An already armed timer of the index is replaced or disarmed when the
+    ///        period is zero.
+    /// @param[in] notificationIndex the index of the notification which is activated when the timer expires
+    /// @param[in] period the period of the timer
+    /// @param[in] activityCounter if not a nullptr the timer only expires when the counter did not change within the
+    ///            period
+    /// @return false if the index is out of range or the period is zero, otherwise true
+    bool addTimer(const uint64_t notificationIndex,
+                  const units::Duration& period,
+                  const std::atomic<uint64_t>* activityCounter = nullptr) noexcept;
+
+    /// @brief Disarms the timer of the notification index, does nothing when no timer is armed
+    /// @param[in] notificationIndex the index of the notification
+    void removeTimer(const uint64_t notificationIndex) noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
     void resetSemaphore() noexcept;
+    bool pollForNotification() noexcept;
+    void activateExpiredTimers() noexcept;
+    cxx::optional<units::Duration> timeUntilNextTimerExpiry() noexcept;
+    static units::Duration getCurrentTime() noexcept;
 
     NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    WaitOptions m_waitOptions;
     std::atomic_bool m_toBeDestroyed{false};
+    std::atomic_bool m_hasTimers{false};
+    std::mutex m_timerMutex;
+    TimerWheel m_timerWheel;
 };
 
 } // namespace popo
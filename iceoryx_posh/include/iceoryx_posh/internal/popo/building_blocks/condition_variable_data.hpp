@@ -17,7 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 
-#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_hoofs/posix_wrapper/binary_semaphore.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
@@ -38,11 +38,43 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
-    cxx::optional<posix::UnnamedSemaphore> m_semaphore;
+    /// @note the listener only needs to know that at least one notification happened since the notifiers are
+    ///       identified via m_activeNotifications, therefore a binary semaphore is sufficient which does not
+    ///       require a syscall in notify when the listener is not blocked
+    cxx::optional<posix::BinarySemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief the number of notifiers which share one word of m_activeNotifications
+    static constexpr uint64_t NOTIFIERS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFIERS_PER_WORD - 1U)
+                                                           / NOTIFIERS_PER_WORD};
+
+    /// @brief returns the index of the word in m_activeNotifications which contains the bit of the notifier
+    static constexpr uint64_t notificationWordIndex(const uint64_t notifierIndex) noexcept
+    {
+        return notifierIndex / NOTIFIERS_PER_WORD;
+    }
+
+    /// @brief returns the mask of the bit which belongs to the notifier in its word of m_activeNotifications
+    static constexpr uint64_t notificationBitMask(const uint64_t notifierIndex) noexcept
+    {
+        return 1ULL << (notifierIndex % NOTIFIERS_PER_WORD);
+    }
+
+    /// @brief returns true when the notifier with the given index has an active notification
+    bool isNotificationActive(const uint64_t notifierIndex) const noexcept
+    {
+        return (m_activeNotifications[notificationWordIndex(notifierIndex)].load(std::memory_order_relaxed)
+                & notificationBitMask(notifierIndex))
+               != 0U;
+    }
+
+    /// @brief every notifier is represented by one bit so that the listener can collect and reset all
+    ///        active notifications of up to NOTIFIERS_PER_WORD notifiers with one atomic operation
+    std::atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     std::atomic_bool m_wasNotified{false};
+    /// @brief set by a listener which never blocks, the notifiers can skip the post of the semaphore then
+    std::atomic_bool m_isListenerBusyPolling{false};
 };
 
 } // namespace popo
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DIRTY_PORT_LIST_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DIRTY_PORT_LIST_HPP
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief the kinds of ports which can request a discovery run
+enum class DirtyPortKind : uint8_t
+{
+    PUBLISHER,
+    SUBSCRIBER,
+    CLIENT,
+    SERVER
+};
+
+/// @brief identifies a port by its kind and its position in the port pool of RouDi
+struct DirtyPort
+{
+    DirtyPortKind kind{DirtyPortKind::PUBLISHER};
+    uint32_t index{0U};
+};
+
+/// @brief A lock-free list in shared memory which contains the ports that changed their state since the last
+///        discovery run. The ports push themselves and RouDi pops them, therefore the discovery does not have to
+///        visit every port to find the state changes.
+class DirtyPortList
+{
+  public:
+    static constexpr uint64_t CAPACITY{static_cast<uint64_t>(MAX_PUBLISHERS) + MAX_SUBSCRIBERS + MAX_CLIENTS
+                                       + MAX_SERVERS};
+
+    DirtyPortList() noexcept = default;
+
+    DirtyPortList(const DirtyPortList&) = delete;
+    DirtyPortList(DirtyPortList&&) = delete;
+    DirtyPortList& operator=(const DirtyPortList&) = delete;
+    DirtyPortList& operator=(DirtyPortList&&) = delete;
+    ~DirtyPortList() noexcept = default;
+
+    /// @brief Adds a port to the list, when the list is full the overflow is recorded instead
+    /// @param[in] port the port which changed its state
+    /// @note threadsafe, lockfree
+    void push(const DirtyPort& port) noexcept;
+
+    /// @brief Removes the oldest port from the list
+    /// @return the port or cxx::nullopt when the list is empty
+    /// @note threadsafe, lockfree
+    cxx::optional<DirtyPort> pop() noexcept;
+
+    /// @brief Returns true when a push failed since the last call, the discovery must visit all ports then
+    /// @note threadsafe, lockfree
+    bool checkAndResetOverflow() noexcept;
+
+  private:
+    concurrent::LockFreeQueue<DirtyPort, CAPACITY> m_queue;
+    std::atomic_bool m_hasOverflowed{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DIRTY_PORT_LIST_HPP
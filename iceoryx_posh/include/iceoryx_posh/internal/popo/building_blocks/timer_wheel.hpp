@@ -0,0 +1,111 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_WHEEL_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_WHEEL_HPP
+
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A hashed timer wheel with one periodic timer per notification index. The timers are sorted into slots by
+///        their expiry tick, therefore adding, removing and advancing the wheel does not depend on the number of
+///        armed timers but only on the number of slots and expired timers.
+///        A timer can observe an activity counter, then it only expires when the counter did not change since the
+///        last expiry. This is used to detect that no sample arrived within a period without touching the timer
+///        on every sample.
+/// @note The TimerWheel is not thread safe and all time arguments are monotonic time points.
+class TimerWheel
+{
+  public:
+    using Index_t = cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>;
+    static constexpr uint64_t CAPACITY{MAX_NUMBER_OF_NOTIFIERS};
+    static constexpr uint64_t NUMBER_OF_SLOTS{256U};
+    static constexpr units::Duration DEFAULT_RESOLUTION{units::Duration::fromMilliseconds(1U)};
+
+    /// @param[in] resolution the duration of a single tick, timers expire at the latest one tick after their period
+    explicit TimerWheel(const units::Duration resolution = DEFAULT_RESOLUTION) noexcept;
+
+    /// @brief Arms the timer of the index, an already armed timer of the index is replaced or disarmed when the period
+    ///        is zero
+    /// @param[in] index the notification index of the timer, must be smaller than CAPACITY
+    /// @param[in] period the period of the timer, a period below the resolution is rounded up to the resolution
+    /// @param[in] now the current time
+    /// @param[in] activityCounter if not a nullptr the timer only expires when the counter did not change within the
+    ///            period
+    /// @return false if the index is out of range or the period is zero, otherwise true
+    bool add(const uint64_t index,
+             const units::Duration period,
+             const units::Duration now,
+             const std::atomic<uint64_t>* activityCounter = nullptr) noexcept;
+
+    /// @brief Disarms the timer of the index, does nothing when the timer is not armed
+    /// @param[in] index the notification index of the timer
+    void remove(const uint64_t index) noexcept;
+
+    /// @brief returns true if no timer is armed, otherwise false
+    bool empty() const noexcept;
+
+    /// @brief returns the duration until the next timer expires or cxx::nullopt when no timer is armed
+    /// @param[in] now the current time
+    cxx::optional<units::Duration> timeUntilNextExpiry(const units::Duration now) const noexcept;
+
+    /// @brief Expires all timers which are due up to now and rearms them for their next period
+    /// @param[in] now the current time
+    /// @param[in] onExpiry called with the notification index of every expired timer
+    void advance(const units::Duration now, const cxx::function_ref<void(uint64_t)>& onExpiry) noexcept;
+
+  private:
+    static constexpr Index_t INVALID_INDEX{static_cast<Index_t>(CAPACITY)};
+
+    struct Timer
+    {
+        bool isArmed{false};
+        uint64_t periodInTicks{0U};
+        uint64_t expiryTick{0U};
+        const std::atomic<uint64_t>* activityCounter{nullptr};
+        uint64_t lastActivity{0U};
+        Index_t next{INVALID_INDEX};
+        Index_t previous{INVALID_INDEX};
+    };
+
+    uint64_t toTicksRoundedDown(const units::Duration time) const noexcept;
+    uint64_t toTicksRoundedUp(const units::Duration time) const noexcept;
+    void link(const uint64_t index) noexcept;
+    void unlink(const uint64_t index) noexcept;
+    void rearm(const uint64_t index, const uint64_t currentTick) noexcept;
+
+  private:
+    uint64_t m_resolutionInNanoseconds;
+    uint64_t m_currentTick{0U};
+    uint64_t m_numberOfArmedTimers{0U};
+    Timer m_timers[CAPACITY];
+    Index_t m_slots[NUMBER_OF_SLOTS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_WHEEL_HPP
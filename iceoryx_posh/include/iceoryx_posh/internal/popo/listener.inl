@@ -26,7 +26,8 @@ template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline cxx::expected<ListenerError>
 ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
-                                    const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const NotificationPriority priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -39,18 +40,20 @@ ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
                     typeid(NoEnumUsed).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
-            NotificationAttorney::enableEvent(
-                eventOrigin,
-                TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl<Capacity>::removeTrigger}, eventId));
+            NotificationAttorney::enableEvent(eventOrigin, createTriggerHandle(eventId));
         });
 }
 
 template <uint64_t Capacity>
 template <typename T, typename EventType, typename ContextDataType, typename>
-inline cxx::expected<ListenerError> ListenerImpl<Capacity>::attachEvent(
-    T& eventOrigin, const EventType eventType, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline cxx::expected<ListenerError>
+ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
+                                    const EventType eventType,
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const NotificationPriority priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -63,12 +66,10 @@ inline cxx::expected<ListenerError> ListenerImpl<Capacity>::attachEvent(
                     typeid(EventType).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
-            NotificationAttorney::enableEvent(
-                eventOrigin,
-                TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl<Capacity>::removeTrigger}, eventId),
-                eventType);
+            NotificationAttorney::enableEvent(eventOrigin, createTriggerHandle(eventId), eventType);
         });
 }
 
@@ -101,10 +102,40 @@ inline ListenerImpl<Capacity>::ListenerImpl() noexcept
 }
 
 template <uint64_t Capacity>
-inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
+inline ListenerImpl<Capacity>::ListenerImpl(const WaitOptions& waitOptions) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitOptions)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(const ListenerOptions& options) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), options)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const WaitOptions& waitOptions) noexcept
+    : ListenerImpl(conditionVariable, ListenerOptions{waitOptions, {}})
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const ListenerOptions& options) noexcept
     : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
+    , m_conditionListener(conditionVariable, options.waitOptions)
 {
+    for (auto& state : m_dispatchStates)
+    {
+        state.store(DispatchState::IDLE, std::memory_order_relaxed);
+    }
+    for (auto& priority : m_priorities)
+    {
+        priority.store(DEFAULT_NOTIFICATION_PRIORITY, std::memory_order_relaxed);
+    }
+
+    startWorkers(options);
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
 
@@ -115,9 +146,65 @@ inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+    stopWorkers();
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::startWorkers(const ListenerOptions& options) noexcept
+{
+    if (options.workers.empty())
+    {
+        return;
+    }
+
+    if (posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(m_workerSemaphore)
+            .has_error())
+    {
+        errorHandler(PoshError::POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE, ErrorLevel::FATAL);
+        return;
+    }
+
+    for (const auto& worker : options.workers)
+    {
+        if (posix::ThreadBuilder()
+                .name("iox-listener")
+                .cpuAffinityMask(worker.cpuAffinityMask)
+                .scheduler(worker.scheduler)
+                .schedulerPriority(worker.schedulerPriority)
+                .create(m_workers[m_numberOfWorkers], [this] { workerLoop(); })
+                .has_error())
+        {
+            errorHandler(PoshError::POPO__LISTENER_FAILED_TO_CREATE_WORKER_THREAD, ErrorLevel::FATAL);
+            return;
+        }
+        ++m_numberOfWorkers;
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::stopWorkers() noexcept
+{
+    // the listener thread is already joined, therefore no new event is dispatched. Every worker finishes the
+    // already dispatched events and terminates when it acquires the semaphore while the queue is empty.
+    m_stopWorkers.store(true, std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        if (m_workerSemaphore->post().has_error())
+        {
+            errorHandler(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+        }
+    }
+
+    for (uint64_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        m_workers[i].reset();
+    }
+}
+
 template <uint64_t Capacity>
 inline cxx::expected<uint32_t, ListenerError>
 ListenerImpl<Capacity>::addEvent(void* const origin,
@@ -126,7 +213,8 @@ ListenerImpl<Capacity>::addEvent(void* const origin,
                                  const uint64_t eventTypeHash,
                                  internal::GenericCallbackRef_t callback,
                                  internal::TranslationCallbackRef_t translationCallback,
-                                 const cxx::function<void(uint64_t)> invalidationCallback) noexcept
+                                 const cxx::function<void(uint64_t)> invalidationCallback,
+                                 const NotificationPriority priority) noexcept
 {
     std::lock_guard<std::mutex> lock(m_addEventMutex);
 
@@ -144,6 +232,7 @@ ListenerImpl<Capacity>::addEvent(void* const origin,
         return cxx::error<ListenerError>(ListenerError::LISTENER_FULL);
     }
 
+    m_priorities[index].store(priority, std::memory_order_relaxed);
     m_events[index]->init(
         index, origin, userType, eventType, eventTypeHash, callback, translationCallback, invalidationCallback);
     return cxx::success<uint32_t>(index);
@@ -161,14 +250,135 @@ inline void ListenerImpl<Capacity>::threadLoop() noexcept
     while (m_wasDtorCalled.load(std::memory_order_relaxed) == false)
     {
         auto activateNotificationIds = m_conditionListener.wait();
+        internal::sortByDescendingPriority(activateNotificationIds, [this](const auto id) {
+            return m_priorities[id].load(std::memory_order_relaxed);
+        });
 
         for (auto& id : activateNotificationIds)
         {
-            m_events[id]->executeCallback();
+            if (m_numberOfWorkers == 0U)
+            {
+                m_events[id]->executeCallback();
+            }
+            else
+            {
+                dispatchToWorkers(id);
+            }
         }
     }
 }
 
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::dispatchToWorkers(const uint64_t eventId) noexcept
+{
+    auto& state = m_dispatchStates[eventId];
+    auto currentState = state.load(std::memory_order_relaxed);
+    while (true)
+    {
+        switch (currentState)
+        {
+        case DispatchState::IDLE:
+            if (state.compare_exchange_weak(currentState, DispatchState::QUEUED, std::memory_order_relaxed))
+            {
+                // every event is at most once in the queue, therefore the queue with Capacity entries cannot overflow
+                cxx::Expects(m_dispatchQueue.tryPush(eventId));
+                if (m_workerSemaphore->post().has_error())
+                {
+                    errorHandler(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+                }
+                return;
+            }
+            break;
+        case DispatchState::RUNNING:
+            // the worker executing the callback runs it once more when it has finished
+            if (state.compare_exchange_weak(
+                    currentState, DispatchState::RUNNING_AND_FIRED_AGAIN, std::memory_order_relaxed))
+            {
+                return;
+            }
+            break;
+        case DispatchState::QUEUED:
+        case DispatchState::RUNNING_AND_FIRED_AGAIN:
+        case DispatchState::DETACHED:
+            return;
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::workerLoop() noexcept
+{
+    while (true)
+    {
+        if (m_workerSemaphore->wait().has_error())
+        {
+            errorHandler(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+            return;
+        }
+
+        auto eventId = m_dispatchQueue.pop();
+        if (eventId.has_value())
+        {
+            executeDispatchedEvent(*eventId);
+        }
+        else if (m_stopWorkers.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::executeDispatchedEvent(const uint64_t eventId) noexcept
+{
+    auto& state = m_dispatchStates[eventId];
+    auto expectedState = DispatchState::QUEUED;
+    if (!state.compare_exchange_strong(expectedState, DispatchState::RUNNING, std::memory_order_relaxed))
+    {
+        // the event was detached while it was queued
+        releaseDetachedEvent(eventId);
+        return;
+    }
+
+    while (true)
+    {
+        m_events[eventId]->executeCallback();
+        expectedState = DispatchState::RUNNING;
+        if (state.compare_exchange_strong(expectedState, DispatchState::IDLE, std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // when the event fired again during the execution the state is RUNNING_AND_FIRED_AGAIN and the callback
+        // is executed once more by this worker, this guarantees that a callback is never executed concurrently
+        if (expectedState == DispatchState::RUNNING_AND_FIRED_AGAIN
+            && state.compare_exchange_strong(expectedState, DispatchState::RUNNING, std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        // the event was detached during the execution
+        releaseDetachedEvent(eventId);
+        return;
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::releaseDetachedEvent(const uint64_t eventId) noexcept
+{
+    m_dispatchStates[eventId].store(DispatchState::IDLE, std::memory_order_relaxed);
+    m_indexManager.push(static_cast<uint32_t>(eventId));
+}
+
+template <uint64_t Capacity>
+inline TriggerHandle ListenerImpl<Capacity>::createTriggerHandle(const uint64_t index) noexcept
+{
+    return TriggerHandle(*m_conditionVariableData,
+                         {*this, &ListenerImpl<Capacity>::removeTrigger},
+                         index,
+                         {*this, &ListenerImpl<Capacity>::enableTimer});
+}
+
 template <uint64_t Capacity>
 inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
 {
@@ -177,10 +387,34 @@ inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
         return;
     }
 
-    if (m_events[index]->reset())
+    m_conditionListener.removeTimer(index);
+
+    if (!m_events[index]->reset())
     {
-        m_indexManager.push(static_cast<uint32_t>(index));
+        return;
     }
+
+    // an index whose event is still queued or running must not be reused by another event before the worker has
+    // finished with it, therefore the worker releases the index in this case
+    auto& state = m_dispatchStates[index];
+    auto currentState = state.load(std::memory_order_relaxed);
+    while (currentState != DispatchState::IDLE)
+    {
+        if (state.compare_exchange_weak(currentState, DispatchState::DETACHED, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    m_indexManager.push(static_cast<uint32_t>(index));
+}
+
+template <uint64_t Capacity>
+inline bool ListenerImpl<Capacity>::enableTimer(const uint64_t index,
+                                                const units::Duration& period,
+                                                const std::atomic<uint64_t>* activityCounter) noexcept
+{
+    return m_conditionListener.addTimer(index, period, activityCounter);
 }
 
 ///////////////////////
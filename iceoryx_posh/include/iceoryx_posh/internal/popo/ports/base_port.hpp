@@ -79,6 +79,14 @@ class BasePort
     /// @return true if it shall be destroyed, false if not
     bool toBeDestroyed() const noexcept;
 
+    /// @brief Adds the port to the dirty port list and signals RouDi that a discovery run is required, does nothing
+    ///        when the port was not created by RouDi
+    void notifyDiscovery() noexcept;
+
+    /// @brief Used by the discovery to mark the port as processed, a later state change adds it to the dirty port
+    ///        list again
+    void resetDirtyFlag() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -21,6 +21,8 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 
 #include <atomic>
@@ -32,6 +34,9 @@ namespace popo
 /// @brief Defines different base port data
 struct BasePortData
 {
+    /// @brief the notification index which is used to signal RouDi that a discovery run is required
+    static constexpr uint64_t DISCOVERY_NOTIFICATION_INDEX{0U};
+
     /// @brief Constructor for base port data members
     BasePortData() noexcept = default;
 
@@ -54,6 +59,14 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+    /// @brief set by RouDi when the port is created, used to wake up the discovery when the port changes its state
+    memory::RelativePointer<ConditionVariableData> m_discoveryConditionVariableDataPtr;
+    /// @brief set by RouDi when the port is created, the port adds itself to this list when it changes its state
+    memory::RelativePointer<DirtyPortList> m_dirtyPortListPtr;
+    /// @brief identifies the port in the dirty port list
+    DirtyPort m_dirtyPort;
+    /// @brief true while the port is contained in the dirty port list
+    std::atomic_bool m_isDirty{false};
 };
 
 } // namespace popo
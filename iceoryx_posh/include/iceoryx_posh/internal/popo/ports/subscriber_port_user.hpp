@@ -82,6 +82,9 @@ class SubscriberPortUser : public BasePort
     /// @return true if the underlying queue overflowed since last call of this method, otherwise false
     bool hasLostChunksSinceLastCall() noexcept;
 
+    /// @brief returns the counter which is incremented whenever a chunk is delivered to the subscriber
+    const std::atomic<uint64_t>& getNumberOfReceivedChunks() const noexcept;
+
     /// @brief attach a condition variable (via its pointer) to subscriber
     void setConditionVariable(ConditionVariableData& conditionVariableData, const uint64_t notificationIndex) noexcept;
 
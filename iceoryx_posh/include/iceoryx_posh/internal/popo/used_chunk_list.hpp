@@ -65,6 +65,13 @@ class UsedChunkList
     /// still running.
     void cleanup() noexcept;
 
+    /// @brief Calls the callable with every storage slot of the list, also with the ones which are logically a
+    /// nullptr. The slots are not synchronized with the application, they can be stale or concurrently modified.
+    /// @param[in] callable which is called with a const mepoo::ShmSafeUnmanagedChunk&
+    /// @note from RouDi context to find out which chunks might still be referenced by the application
+    template <typename Callable>
+    void forEachStorageSlot(const Callable& callable) const noexcept;
+
   private:
     void init() noexcept;
 
@@ -119,6 +119,16 @@ void UsedChunkList<Capacity>::cleanup() noexcept
     init(); // just to save us from the future self
 }
 
+template <uint32_t Capacity>
+template <typename Callable>
+void UsedChunkList<Capacity>::forEachStorageSlot(const Callable& callable) const noexcept
+{
+    for (const auto& data : m_listData)
+    {
+        callable(data);
+    }
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::init() noexcept
 {
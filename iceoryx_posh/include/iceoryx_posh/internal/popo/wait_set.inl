@@ -30,9 +30,15 @@ inline WaitSet<Capacity>::WaitSet() noexcept
 }
 
 template <uint64_t Capacity>
-inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
+inline WaitSet<Capacity>::WaitSet(const WaitOptions& waitOptions) noexcept
+    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitOptions)
+{
+}
+
+template <uint64_t Capacity>
+inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData, const WaitOptions& waitOptions) noexcept
     : m_conditionVariableDataPtr(&condVarData)
-    , m_conditionListener(condVarData)
+    , m_conditionListener(condVarData, waitOptions)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -61,7 +67,8 @@ WaitSet<Capacity>::attachImpl(T& eventOrigin,
                               const uint64_t eventId,
                               const NotificationCallback<T, ContextDataType>& eventCallback,
                               const uint64_t originType,
-                              const uint64_t originTypeHash) noexcept
+                              const uint64_t originTypeHash,
+                              const NotificationPriority priority) noexcept
 {
     for (auto& currentTrigger : m_triggerArray)
     {
@@ -102,6 +109,7 @@ WaitSet<Capacity>::attachImpl(T& eventOrigin,
                                        originType,
                                        originTypeHash);
     }
+    m_priorities[*index] = priority;
 
     return cxx::success<uint64_t>(*index);
 }
@@ -112,7 +120,8 @@ inline cxx::expected<WaitSetError>
 WaitSet<Capacity>::attachEvent(T& eventOrigin,
                                const EventType eventType,
                                const uint64_t eventId,
-                               const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
     static_assert(IS_EVENT_ENUM<EventType>, "Only enums with an underlying EventEnumIdentifier are allowed.");
 
@@ -121,46 +130,52 @@ WaitSet<Capacity>::attachEvent(T& eventOrigin,
                       eventId,
                       eventCallback,
                       static_cast<uint64_t>(eventType),
-                      typeid(EventType).hash_code())
+                      typeid(EventType).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
-            NotificationAttorney::enableEvent(
-                eventOrigin,
-                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId),
-                eventType);
+            NotificationAttorney::enableEvent(eventOrigin, createTriggerHandle(uniqueId), eventType);
         });
 }
 
 template <uint64_t Capacity>
 template <typename T, typename EventType, typename ContextDataType, typename>
-inline cxx::expected<WaitSetError> WaitSet<Capacity>::attachEvent(
-    T& eventOrigin, const EventType eventType, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline cxx::expected<WaitSetError>
+WaitSet<Capacity>::attachEvent(T& eventOrigin,
+                               const EventType eventType,
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachEvent(eventOrigin, eventType, NotificationInfo::INVALID_ID, eventCallback);
+    return attachEvent(eventOrigin, eventType, NotificationInfo::INVALID_ID, eventCallback, priority);
 }
 
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
-inline cxx::expected<WaitSetError> WaitSet<Capacity>::attachEvent(
-    T& eventOrigin, const uint64_t eventId, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline cxx::expected<WaitSetError>
+WaitSet<Capacity>::attachEvent(T& eventOrigin,
+                               const uint64_t eventId,
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
     return attachImpl(eventOrigin,
                       cxx::nullopt,
                       eventId,
                       eventCallback,
                       static_cast<uint64_t>(NoEventEnumUsed::PLACEHOLDER),
-                      typeid(NoEventEnumUsed).hash_code())
+                      typeid(NoEventEnumUsed).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
-            NotificationAttorney::enableEvent(
-                eventOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
+            NotificationAttorney::enableEvent(eventOrigin, createTriggerHandle(uniqueId));
         });
 }
 
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline cxx::expected<WaitSetError>
-WaitSet<Capacity>::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+WaitSet<Capacity>::attachEvent(T& eventOrigin,
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachEvent(eventOrigin, NotificationInfo::INVALID_ID, eventCallback);
+    return attachEvent(eventOrigin, NotificationInfo::INVALID_ID, eventCallback, priority);
 }
 
 template <uint64_t Capacity>
@@ -169,7 +184,8 @@ inline cxx::expected<WaitSetError>
 WaitSet<Capacity>::attachState(T& stateOrigin,
                                const StateType stateType,
                                const uint64_t id,
-                               const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
     static_assert(IS_STATE_ENUM<StateType>, "Only enums with an underlying StateEnumIdentifier are allowed.");
     auto hasTriggeredCallback = NotificationAttorney::getCallbackForIsStateConditionSatisfied(stateOrigin, stateType);
@@ -179,27 +195,32 @@ WaitSet<Capacity>::attachState(T& stateOrigin,
                       id,
                       stateCallback,
                       static_cast<uint64_t>(stateType),
-                      typeid(StateType).hash_code())
+                      typeid(StateType).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
-            NotificationAttorney::enableState(
-                stateOrigin,
-                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId),
-                stateType);
+            NotificationAttorney::enableState(stateOrigin, createTriggerHandle(uniqueId), stateType);
+            notifyWhenStateConditionIsSatisfied(uniqueId);
         });
 }
 
 template <uint64_t Capacity>
 template <typename T, typename StateType, typename ContextDataType, typename>
-inline cxx::expected<WaitSetError> WaitSet<Capacity>::attachState(
-    T& stateOrigin, const StateType stateType, const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+inline cxx::expected<WaitSetError>
+WaitSet<Capacity>::attachState(T& stateOrigin,
+                               const StateType stateType,
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachState(stateOrigin, stateType, NotificationInfo::INVALID_ID, stateCallback);
+    return attachState(stateOrigin, stateType, NotificationInfo::INVALID_ID, stateCallback, priority);
 }
 
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
-inline cxx::expected<WaitSetError> WaitSet<Capacity>::attachState(
-    T& stateOrigin, const uint64_t id, const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+inline cxx::expected<WaitSetError>
+WaitSet<Capacity>::attachState(T& stateOrigin,
+                               const uint64_t id,
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
     auto hasTriggeredCallback = NotificationAttorney::getCallbackForIsStateConditionSatisfied(stateOrigin);
     return attachImpl(stateOrigin,
@@ -207,19 +228,22 @@ inline cxx::expected<WaitSetError> WaitSet<Capacity>::attachState(
                       id,
                       stateCallback,
                       static_cast<uint64_t>(NoStateEnumUsed::PLACEHOLDER),
-                      typeid(NoStateEnumUsed).hash_code())
+                      typeid(NoStateEnumUsed).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
-            NotificationAttorney::enableState(
-                stateOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
+            NotificationAttorney::enableState(stateOrigin, createTriggerHandle(uniqueId));
+            notifyWhenStateConditionIsSatisfied(uniqueId);
         });
 }
 
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline cxx::expected<WaitSetError>
-WaitSet<Capacity>::attachState(T& stateOrigin, const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+WaitSet<Capacity>::attachState(T& stateOrigin,
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachState(stateOrigin, NotificationInfo::INVALID_ID, stateCallback);
+    return attachState(stateOrigin, NotificationInfo::INVALID_ID, stateCallback, priority);
 }
 
 template <uint64_t Capacity>
@@ -236,9 +260,31 @@ inline void WaitSet<Capacity>::detachState(T& stateOrigin, const Targs&... args)
     NotificationAttorney::disableState(stateOrigin, args...);
 }
 
+template <uint64_t Capacity>
+inline TriggerHandle WaitSet<Capacity>::createTriggerHandle(const uint64_t uniqueTriggerId) noexcept
+{
+    return TriggerHandle(*m_conditionVariableDataPtr,
+                         {*this, &WaitSet::removeTrigger},
+                         uniqueTriggerId,
+                         {*this, &WaitSet::enableTimer});
+}
+
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::notifyWhenStateConditionIsSatisfied(const uint64_t uniqueTriggerId) noexcept
+{
+    // the origin only notifies when its state changes, a state which already holds when it is attached, e.g. a
+    // subscriber which received samples before, would not be reported until the next notification otherwise
+    if (m_triggerArray[uniqueTriggerId]->isStateConditionSatisfied())
+    {
+        ConditionNotifier(*m_conditionVariableDataPtr, uniqueTriggerId).notify();
+    }
+}
+
 template <uint64_t Capacity>
 inline void WaitSet<Capacity>::removeTrigger(const uint64_t uniqueTriggerId) noexcept
 {
+    m_conditionListener.removeTimer(uniqueTriggerId);
+
     for (auto& trigger : m_triggerArray)
     {
         if (trigger.has_value() && trigger->getUniqueId() == uniqueTriggerId)
@@ -251,6 +297,14 @@ inline void WaitSet<Capacity>::removeTrigger(const uint64_t uniqueTriggerId) noe
     }
 }
 
+template <uint64_t Capacity>
+inline bool WaitSet<Capacity>::enableTimer(const uint64_t uniqueTriggerId,
+                                           const units::Duration& period,
+                                           const std::atomic<uint64_t>* activityCounter) noexcept
+{
+    return m_conditionListener.addTimer(uniqueTriggerId, period, activityCounter);
+}
+
 template <uint64_t Capacity>
 inline void WaitSet<Capacity>::removeAllTriggers() noexcept
 {
@@ -277,7 +331,7 @@ template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
 {
-    NotificationInfoVector triggers;
+    ConditionListener::NotificationVector_t triggeredIndices;
     if (!m_activeNotifications.empty())
     {
         for (uint64_t i = m_activeNotifications.size() - 1U;; --i)
@@ -288,7 +342,7 @@ WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
 
             if (!doRemoveNotificationId && trigger->isStateConditionSatisfied())
             {
-                cxx::Expects(triggers.push_back(&m_triggerArray[index]->getNotificationInfo()));
+                cxx::Expects(triggeredIndices.push_back(index));
                 doRemoveNotificationId = (trigger->getTriggerType() == TriggerType::EVENT_BASED);
             }
 
@@ -304,6 +358,14 @@ WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
         }
     }
 
+    internal::sortByDescendingPriority(triggeredIndices, [this](const auto index) { return m_priorities[index]; });
+
+    NotificationInfoVector triggers;
+    for (const auto index : triggeredIndices)
+    {
+        cxx::Expects(triggers.push_back(&m_triggerArray[index]->getNotificationInfo()));
+    }
+
     return triggers;
 }
 
@@ -0,0 +1,106 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_CHUNK_GARBAGE_COLLECTOR_HPP
+#define IOX_POSH_ROUDI_CHUNK_GARBAGE_COLLECTOR_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_transfer_tracker.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Finds and releases chunks which are still in use but are not referenced by any port anymore. This happens
+/// when a process terminates abnormally while it holds a chunk outside of the port data, e.g. after a chunk was taken
+/// from a queue but before it was stored in the used chunk list.
+/// A collection marks every chunk which is referenced by a port and inspects afterwards all chunks in use. A running
+/// process holds a chunk outside of the port data only within a transfer which is recorded by the
+/// ChunkTransferTracker of its port, e.g. while a publisher is blocked in the delivery to a full queue. Therefore the
+/// transfers of all ports are recorded before and after the marking and the collection is only finished when no port
+/// started a transfer or was in a transfer in between. Then every chunk in use which was not marked is held only by
+/// processes whose ports were removed and is reclaimed, otherwise the collection is discarded. Chunks which were
+/// obtained after the collection was started are stamped with it by the MemoryManager and are never reclaimed by it.
+/// The marking is conservative, stale entries in the port data keep a chunk alive until they are overwritten.
+/// @note not thread-safe, all methods must be called from the same context which has access to all ports
+class ChunkGarbageCollector
+{
+  public:
+    static constexpr uint64_t MAX_NUMBER_OF_MEMORY_MANAGERS{MAX_SHM_SEGMENTS + 1U};
+
+    /// @brief Adds a MemoryManager whose chunks are inspected by the collections
+    /// @param[in] memoryManager to add, it must outlive the ChunkGarbageCollector
+    /// @return true if the MemoryManager was added, false if MAX_NUMBER_OF_MEMORY_MANAGERS is exceeded
+    bool addMemoryManager(mepoo::MemoryManager& memoryManager) noexcept;
+
+    /// @brief Starts a new collection in all MemoryManagers, the transfers of all ports must be recorded afterwards
+    void beginCollection() noexcept;
+
+    /// @brief Records the transfers of a port, it must be called for every port before the referenced chunks are
+    /// marked and again after endMarking
+    /// @param[in] transferTracker the ChunkTransferTracker of the port
+    void recordTransfers(const popo::ChunkTransferTracker& transferTracker) noexcept;
+
+    /// @brief Marks the chunk as referenced in the current collection
+    /// @param[in] chunk to mark, it can also be logically a nullptr or stale
+    void markReferenced(const mepoo::ShmSafeUnmanagedChunk& chunk) noexcept;
+
+    /// @brief Marks all chunks which are referenced by a ChunkSender, i.e. the chunks in use, the last chunk and
+    /// the history
+    /// @param[in] chunkSenderData the data of the ChunkSender
+    template <typename ChunkSenderDataType>
+    void markChunksOfSender(const ChunkSenderDataType& chunkSenderData) noexcept;
+
+    /// @brief Marks all chunks which are referenced by a ChunkReceiver, i.e. the chunks in the queue and in use
+    /// @param[in] chunkReceiverData the data of the ChunkReceiver
+    template <typename ChunkReceiverDataType>
+    void markChunksOfReceiver(const ChunkReceiverDataType& chunkReceiverData) noexcept;
+
+    /// @brief Ends the marking, the transfers of all ports must be recorded again afterwards
+    void endMarking() noexcept;
+
+    /// @brief Finishes the current collection and reclaims the chunks which are in use but were not marked
+    /// @return the number of reclaimed chunks or cxx::nullopt when the collection was discarded since a port
+    /// transferred a chunk while the collection was running
+    cxx::optional<uint64_t> finishCollection() noexcept;
+
+  private:
+    /// @brief the sum of the started transfers of all ports, a change between the recordings means that a transfer
+    /// was started in between
+    struct TransferRecord
+    {
+        uint64_t sumOfStartedTransfers{0U};
+        bool hasTransferInProgress{false};
+    };
+
+    cxx::vector<mepoo::MemoryManager*, MAX_NUMBER_OF_MEMORY_MANAGERS> m_memoryManagers;
+    uint64_t m_collection{0U};
+    TransferRecord m_transfersBeforeMarking;
+    TransferRecord m_transfersAfterMarking;
+    bool m_isMarkingFinished{false};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/chunk_garbage_collector.inl"
+
+#endif // IOX_POSH_ROUDI_CHUNK_GARBAGE_COLLECTOR_HPP
@@ -0,0 +1,52 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_CHUNK_GARBAGE_COLLECTOR_INL
+#define IOX_POSH_ROUDI_CHUNK_GARBAGE_COLLECTOR_INL
+
+namespace iox
+{
+namespace roudi
+{
+template <typename ChunkSenderDataType>
+inline void ChunkGarbageCollector::markChunksOfSender(const ChunkSenderDataType& chunkSenderData) noexcept
+{
+    auto mark = [this](const mepoo::ShmSafeUnmanagedChunk& chunk) { markReferenced(chunk); };
+
+    chunkSenderData.m_chunksInUse.forEachStorageSlot(mark);
+    markReferenced(chunkSenderData.m_lastChunkUnmanaged);
+
+    // the removed history entries are also inspected since the ChunkDistributor could be interrupted while it
+    // rearranges the history
+    const auto& history = chunkSenderData.m_history;
+    for (uint64_t i = 0U; i < history.capacity(); ++i)
+    {
+        mark(history.data()[i]);
+    }
+}
+
+template <typename ChunkReceiverDataType>
+inline void ChunkGarbageCollector::markChunksOfReceiver(const ChunkReceiverDataType& chunkReceiverData) noexcept
+{
+    auto mark = [this](const mepoo::ShmSafeUnmanagedChunk& chunk) { markReferenced(chunk); };
+
+    chunkReceiverData.m_queue.forEachStorageSlot(mark);
+    chunkReceiverData.m_chunksInUse.forEachStorageSlot(mark);
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_CHUNK_GARBAGE_COLLECTOR_INL
@@ -0,0 +1,99 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_ELEMENT_INDEX_HPP
+#define IOX_POSH_ROUDI_ELEMENT_INDEX_HPP
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Maps a key to the elements, e.g. the port data, which have this key. The elements are chained by index in
+///        hash buckets, therefore no dynamic memory is required and a lookup only visits the elements of one bucket
+///        instead of all elements.
+/// @tparam T the element type
+/// @tparam Capacity the maximum number of elements
+/// @tparam Key provides the key type 'Type', the key of an element with 'static Type of(const T& element)' and the
+///         hash of a key with 'static uint64_t hash(const Type& key)'; the key of an element must not change while
+///         the element is in the index
+/// @note The ElementIndex is not thread safe.
+template <typename T, uint64_t Capacity, typename Key>
+class ElementIndex
+{
+  public:
+    ElementIndex() noexcept;
+
+    /// @brief Adds an element to the index, an element must not be added twice
+    /// @param[in] element the element to add
+    /// @return false if the index is full, otherwise true
+    bool add(T* const element) noexcept;
+
+    /// @brief Removes an element from the index, does nothing when the element is not contained
+    /// @param[in] element the element to remove
+    void remove(const T* const element) noexcept;
+
+    /// @brief Calls the callable for every element with the given key in the order in which the elements were
+    ///        added. The callable is allowed to remove the element it was called with.
+    /// @param[in] key the key to look up
+    /// @param[in] callable called with a pointer to the element
+    template <typename Callable>
+    void forEach(const typename Key::Type& key, const Callable& callable) const noexcept;
+
+    /// @brief returns the number of elements in the index
+    uint64_t size() const noexcept;
+
+  private:
+    using Index_t = uint32_t;
+    static_assert(Capacity < std::numeric_limits<Index_t>::max(), "Capacity exceeds the index type");
+
+    static constexpr Index_t INVALID_INDEX{std::numeric_limits<Index_t>::max()};
+
+    static constexpr uint64_t numberOfBuckets() noexcept
+    {
+        uint64_t buckets = 1U;
+        while (buckets < Capacity)
+        {
+            buckets *= 2U;
+        }
+        return buckets;
+    }
+    static constexpr uint64_t NUMBER_OF_BUCKETS{numberOfBuckets()};
+
+    struct Entry
+    {
+        T* element{nullptr};
+        uint64_t hash{0U};
+        Index_t next{INVALID_INDEX};
+    };
+
+    Index_t& bucketOf(const uint64_t hash) noexcept;
+    Index_t bucketOf(const uint64_t hash) const noexcept;
+
+  private:
+    Entry m_entries[Capacity];
+    Index_t m_buckets[NUMBER_OF_BUCKETS];
+    Index_t m_freeList{INVALID_INDEX};
+    uint64_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/element_index.inl"
+
+#endif // IOX_POSH_ROUDI_ELEMENT_INDEX_HPP
@@ -0,0 +1,138 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_ELEMENT_INDEX_INL
+#define IOX_POSH_ROUDI_ELEMENT_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/element_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity, typename Key>
+constexpr typename ElementIndex<T, Capacity, Key>::Index_t ElementIndex<T, Capacity, Key>::INVALID_INDEX;
+
+template <typename T, uint64_t Capacity, typename Key>
+constexpr uint64_t ElementIndex<T, Capacity, Key>::NUMBER_OF_BUCKETS;
+
+template <typename T, uint64_t Capacity, typename Key>
+inline ElementIndex<T, Capacity, Key>::ElementIndex() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket = INVALID_INDEX;
+    }
+
+    // all entries are free in the beginning
+    for (uint64_t i = Capacity; i > 0U; --i)
+    {
+        m_entries[i - 1U].next = m_freeList;
+        m_freeList = static_cast<Index_t>(i - 1U);
+    }
+}
+
+template <typename T, uint64_t Capacity, typename Key>
+inline bool ElementIndex<T, Capacity, Key>::add(T* const element) noexcept
+{
+    if (m_freeList == INVALID_INDEX)
+    {
+        return false;
+    }
+
+    const auto index = m_freeList;
+    auto& entry = m_entries[index];
+    m_freeList = entry.next;
+
+    entry.element = element;
+    entry.hash = Key::hash(Key::of(*element));
+    entry.next = INVALID_INDEX;
+
+    // append to the end of the bucket to keep the order in which the elements were added
+    Index_t* link = &bucketOf(entry.hash);
+    while (*link != INVALID_INDEX)
+    {
+        link = &m_entries[*link].next;
+    }
+    *link = index;
+
+    ++m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity, typename Key>
+inline void ElementIndex<T, Capacity, Key>::remove(const T* const element) noexcept
+{
+    Index_t* link = &bucketOf(Key::hash(Key::of(*element)));
+    while (*link != INVALID_INDEX)
+    {
+        const auto index = *link;
+        auto& entry = m_entries[index];
+        if (entry.element == element)
+        {
+            *link = entry.next;
+            entry.element = nullptr;
+            entry.next = m_freeList;
+            m_freeList = index;
+            --m_size;
+            return;
+        }
+        link = &entry.next;
+    }
+}
+
+template <typename T, uint64_t Capacity, typename Key>
+template <typename Callable>
+inline void ElementIndex<T, Capacity, Key>::forEach(const typename Key::Type& key,
+                                                    const Callable& callable) const noexcept
+{
+    const auto hash = Key::hash(key);
+    auto index = bucketOf(hash);
+    while (index != INVALID_INDEX)
+    {
+        const auto& entry = m_entries[index];
+        // the callable may remove the element, therefore the successor is read first
+        index = entry.next;
+        if (entry.hash == hash && Key::of(*entry.element) == key)
+        {
+            callable(entry.element);
+        }
+    }
+}
+
+template <typename T, uint64_t Capacity, typename Key>
+inline uint64_t ElementIndex<T, Capacity, Key>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T, uint64_t Capacity, typename Key>
+inline typename ElementIndex<T, Capacity, Key>::Index_t&
+ElementIndex<T, Capacity, Key>::bucketOf(const uint64_t hash) noexcept
+{
+    return m_buckets[hash & (NUMBER_OF_BUCKETS - 1U)];
+}
+
+template <typename T, uint64_t Capacity, typename Key>
+inline typename ElementIndex<T, Capacity, Key>::Index_t
+ElementIndex<T, Capacity, Key>::bucketOf(const uint64_t hash) const noexcept
+{
+    return m_buckets[hash & (NUMBER_OF_BUCKETS - 1U)];
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_ELEMENT_INDEX_INL
@@ -0,0 +1,134 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_RUNTIME_MESSAGE_INTROSPECTION_HPP
+#define IOX_POSH_ROUDI_INTROSPECTION_RUNTIME_MESSAGE_INTROSPECTION_HPP
+
+#include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief This class handles the runtime message introspection for RouDi.
+///        It is recommended to use the RuntimeMessageIntrospectionType alias which sets
+///        the intended template parameter.
+///        The class counts the runtime messages RouDi processed per message type together with the time it took to
+///        process them and sends the statistics to the introspection client if subscribed. The messages are
+///        reported lock-free from the runtime messages threads.
+template <typename PublisherPort>
+class RuntimeMessageIntrospection
+{
+  public:
+    RuntimeMessageIntrospection() noexcept = default;
+    ~RuntimeMessageIntrospection() noexcept;
+
+    RuntimeMessageIntrospection(const RuntimeMessageIntrospection&) = delete;
+    RuntimeMessageIntrospection(RuntimeMessageIntrospection&&) = delete;
+    RuntimeMessageIntrospection& operator=(const RuntimeMessageIntrospection&) = delete;
+    RuntimeMessageIntrospection& operator=(RuntimeMessageIntrospection&&) = delete;
+
+    /// @brief This function is used to report a processed runtime message
+    /// @param[in] messageType is the type of the message
+    /// @param[in] processingTime is the time RouDi needed to process the message
+    void addMessage(const runtime::IpcMessageType messageType, const units::Duration processingTime) noexcept;
+
+    /// @brief This function is used to report a processed binary message with port requests
+    /// @param[in] processingTime is the time RouDi needed to process the message
+    void addBinaryMessage(const units::Duration processingTime) noexcept;
+
+    /// @brief This functions registers the POSH publisher port which is used
+    ///        to send the data to the instrospection client
+    /// @param publisherPort is the publisher port for transmission
+    void registerPublisherPort(PublisherPort&& publisherPort) noexcept;
+
+    /// @brief This function starts a thread which periodically sends
+    ///        the introspection data to the client. The send interval
+    ///        can be set by @ref setSendInterval "setSendInterval(...)".
+    ///        Before this function is called, the publisher port hast to be
+    ///        registered with @ref registerPublisherPort "registerPublisherPort()".
+    void run() noexcept;
+
+    /// @brief This function stops the thread previously started by @ref run "run()"
+    void stop() noexcept;
+
+    /// @brief This function configures the interval for the transmission of the
+    ///        runtime message introspection data.
+    /// @param[in] interval duration between two send invocations.
+    void setSendInterval(const units::Duration interval) noexcept;
+
+  protected:
+    cxx::optional<PublisherPort> m_publisherPort;
+    void send() noexcept;
+
+  private:
+    enum class StatisticsIndex : uint32_t
+    {
+        UNKNOWN,
+        REG,
+        CREATE_PUBLISHER,
+        CREATE_SUBSCRIBER,
+        CREATE_CLIENT,
+        CREATE_SERVER,
+        CREATE_INTERFACE,
+        CREATE_CONDITION_VARIABLE,
+        CREATE_NODE,
+        KEEPALIVE,
+        TERMINATION,
+        PREPARE_APP_TERMINATION,
+        BINARY_PORT_REQUESTS,
+        END
+    };
+    static_assert(static_cast<uint32_t>(StatisticsIndex::END) <= MAX_NUMBER_OF_RUNTIME_MESSAGE_TYPES,
+                  "The introspection topic must contain the statistics of all runtime message types");
+
+    struct Statistics
+    {
+        std::atomic<uint64_t> m_numberOfMessages{0U};
+        std::atomic<uint64_t> m_totalProcessingTime_ns{0U};
+        std::atomic<uint64_t> m_maxProcessingTime_ns{0U};
+    };
+
+    static StatisticsIndex toStatisticsIndex(const runtime::IpcMessageType messageType) noexcept;
+    static cxx::string<MAX_RUNTIME_MESSAGE_TYPE_NAME_LENGTH> toMessageTypeName(const StatisticsIndex index) noexcept;
+    void add(const StatisticsIndex index, const units::Duration processingTime) noexcept;
+
+    std::array<Statistics, static_cast<uint32_t>(StatisticsIndex::END)> m_statistics;
+    std::atomic_bool m_hasNewData{true}; // true because we want to have a valid field, even without messages
+
+    units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
+    concurrent::PeriodicTask<cxx::function<void()>> m_publishingTask{
+        concurrent::PeriodicTaskManualStart, "RtMsgIntr", *this, &RuntimeMessageIntrospection::send};
+};
+
+/// @brief typedef for the templated runtime message introspection class that is used by RouDi for the
+/// actual runtime message introspection functionality.
+using RuntimeMessageIntrospectionType = RuntimeMessageIntrospection<PublisherPortUserType>;
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/introspection/runtime_message_introspection.inl"
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_RUNTIME_MESSAGE_INTROSPECTION_HPP
@@ -0,0 +1,219 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_INTROSPECTION_RUNTIME_MESSAGE_INTROSPECTION_INL
+#define IOX_POSH_ROUDI_INTROSPECTION_RUNTIME_MESSAGE_INTROSPECTION_INL
+
+#include "runtime_message_introspection.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename PublisherPort>
+inline RuntimeMessageIntrospection<PublisherPort>::~RuntimeMessageIntrospection() noexcept
+{
+    stop();
+    if (m_publisherPort.has_value())
+    {
+        m_publisherPort->stopOffer();
+    }
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::addMessage(const runtime::IpcMessageType messageType,
+                                                                   const units::Duration processingTime) noexcept
+{
+    add(toStatisticsIndex(messageType), processingTime);
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::addBinaryMessage(const units::Duration processingTime) noexcept
+{
+    add(StatisticsIndex::BINARY_PORT_REQUESTS, processingTime);
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::add(const StatisticsIndex index,
+                                                            const units::Duration processingTime) noexcept
+{
+    auto& statistics = m_statistics[static_cast<uint32_t>(index)];
+    const auto processingTime_ns = processingTime.toNanoseconds();
+
+    statistics.m_numberOfMessages.fetch_add(1U, std::memory_order_relaxed);
+    statistics.m_totalProcessingTime_ns.fetch_add(processingTime_ns, std::memory_order_relaxed);
+    auto maxProcessingTime_ns = statistics.m_maxProcessingTime_ns.load(std::memory_order_relaxed);
+    while (processingTime_ns > maxProcessingTime_ns
+           && !statistics.m_maxProcessingTime_ns.compare_exchange_weak(
+               maxProcessingTime_ns, processingTime_ns, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+    m_hasNewData.store(true, std::memory_order_relaxed);
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::registerPublisherPort(PublisherPort&& publisherPort) noexcept
+{
+    // we do not want to call this twice
+    if (!m_publisherPort.has_value())
+    {
+        m_publisherPort.emplace(std::move(publisherPort));
+    }
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::run() noexcept
+{
+    // @todo iox-#518 error handling for non debug builds
+    cxx::Expects(m_publisherPort.has_value());
+
+    // this is a field, there needs to be a sample before activate is called
+    send();
+    m_publisherPort->offer();
+
+    m_publishingTask.start(m_sendInterval);
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::send() noexcept
+{
+    if (!m_hasNewData.exchange(false, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    auto maybeChunkHeader = m_publisherPort->tryAllocateChunk(sizeof(RuntimeMessageIntrospectionFieldTopic),
+                                                              alignof(RuntimeMessageIntrospectionFieldTopic),
+                                                              CHUNK_NO_USER_HEADER_SIZE,
+                                                              CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (maybeChunkHeader.has_error())
+    {
+        // try again with the next send interval
+        m_hasNewData.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    auto sample = static_cast<RuntimeMessageIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
+    new (sample) RuntimeMessageIntrospectionFieldTopic;
+
+    for (uint32_t i = 0U; i < m_statistics.size(); ++i)
+    {
+        const auto& statistics = m_statistics[i];
+        const auto numberOfMessages = statistics.m_numberOfMessages.load(std::memory_order_relaxed);
+        if (numberOfMessages == 0U)
+        {
+            continue;
+        }
+
+        RuntimeMessageIntrospectionData data;
+        data.m_messageType = toMessageTypeName(static_cast<StatisticsIndex>(i));
+        data.m_numberOfMessages = numberOfMessages;
+        data.m_totalProcessingTime_ns = statistics.m_totalProcessingTime_ns.load(std::memory_order_relaxed);
+        data.m_maxProcessingTime_ns = statistics.m_maxProcessingTime_ns.load(std::memory_order_relaxed);
+        sample->m_messageList.emplace_back(data);
+    }
+
+    m_publisherPort->sendChunk(maybeChunkHeader.value());
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::stop() noexcept
+{
+    m_publishingTask.stop();
+}
+
+template <typename PublisherPort>
+inline void RuntimeMessageIntrospection<PublisherPort>::setSendInterval(const units::Duration interval) noexcept
+{
+    m_sendInterval = interval;
+    if (m_publishingTask.isActive())
+    {
+        m_publishingTask.stop();
+        m_publishingTask.start(m_sendInterval);
+    }
+}
+
+template <typename PublisherPort>
+inline typename RuntimeMessageIntrospection<PublisherPort>::StatisticsIndex
+RuntimeMessageIntrospection<PublisherPort>::toStatisticsIndex(const runtime::IpcMessageType messageType) noexcept
+{
+    switch (messageType)
+    {
+    case runtime::IpcMessageType::REG:
+        return StatisticsIndex::REG;
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+        return StatisticsIndex::CREATE_PUBLISHER;
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+        return StatisticsIndex::CREATE_SUBSCRIBER;
+    case runtime::IpcMessageType::CREATE_CLIENT:
+        return StatisticsIndex::CREATE_CLIENT;
+    case runtime::IpcMessageType::CREATE_SERVER:
+        return StatisticsIndex::CREATE_SERVER;
+    case runtime::IpcMessageType::CREATE_INTERFACE:
+        return StatisticsIndex::CREATE_INTERFACE;
+    case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
+        return StatisticsIndex::CREATE_CONDITION_VARIABLE;
+    case runtime::IpcMessageType::CREATE_NODE:
+        return StatisticsIndex::CREATE_NODE;
+    case runtime::IpcMessageType::KEEPALIVE:
+        return StatisticsIndex::KEEPALIVE;
+    case runtime::IpcMessageType::TERMINATION:
+        return StatisticsIndex::TERMINATION;
+    case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
+        return StatisticsIndex::PREPARE_APP_TERMINATION;
+    default:
+        return StatisticsIndex::UNKNOWN;
+    }
+}
+
+template <typename PublisherPort>
+inline cxx::string<MAX_RUNTIME_MESSAGE_TYPE_NAME_LENGTH>
+RuntimeMessageIntrospection<PublisherPort>::toMessageTypeName(const StatisticsIndex index) noexcept
+{
+    switch (index)
+    {
+    case StatisticsIndex::REG:
+        return "REG";
+    case StatisticsIndex::CREATE_PUBLISHER:
+        return "CREATE_PUBLISHER";
+    case StatisticsIndex::CREATE_SUBSCRIBER:
+        return "CREATE_SUBSCRIBER";
+    case StatisticsIndex::CREATE_CLIENT:
+        return "CREATE_CLIENT";
+    case StatisticsIndex::CREATE_SERVER:
+        return "CREATE_SERVER";
+    case StatisticsIndex::CREATE_INTERFACE:
+        return "CREATE_INTERFACE";
+    case StatisticsIndex::CREATE_CONDITION_VARIABLE:
+        return "CREATE_CONDITION_VARIABLE";
+    case StatisticsIndex::CREATE_NODE:
+        return "CREATE_NODE";
+    case StatisticsIndex::KEEPALIVE:
+        return "KEEPALIVE";
+    case StatisticsIndex::TERMINATION:
+        return "TERMINATION";
+    case StatisticsIndex::PREPARE_APP_TERMINATION:
+        return "PREPARE_APP_TERMINATION";
+    case StatisticsIndex::BINARY_PORT_REQUESTS:
+        return "BINARY_PORT_REQUESTS";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_INTROSPECTION_RUNTIME_MESSAGE_INTROSPECTION_INL
@@ -31,9 +31,9 @@ namespace roudi
 class PortPoolMemoryBlock : public MemoryBlock
 {
   public:
-    /// @todo iox-#1709 the PortPool needs to be refactored to use a typed MemPool
-    /// once that is done, the cTor needs a configuration similar to MemPoolCollectionMemoryProvider
-    PortPoolMemoryBlock() noexcept = default;
+    /// @brief Creates a MemoryBlock for the PortPoolData
+    /// @param[in] config with the number of ports of every type for which memory is reserved
+    PortPoolMemoryBlock(const config::RouDiConfig& config = config::RouDiConfig()) noexcept;
     ~PortPoolMemoryBlock() noexcept;
 
     PortPoolMemoryBlock(const PortPoolMemoryBlock&) = delete;
@@ -63,6 +63,7 @@ class PortPoolMemoryBlock : public MemoryBlock
     void destroy() noexcept override;
 
   private:
+    config::RouDiConfig m_config;
     PortPoolData* m_portPoolData{nullptr};
 };
 
@@ -0,0 +1,93 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_PORT_DATA_ARENA_HPP
+#define IOX_POSH_ROUDI_PORT_DATA_ARENA_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Stores elements at fixed positions like the FixedPositionContainer but the number of positions is chosen at
+/// runtime and the positions are allocated from an allocator, e.g. in the management segment. A position is only
+/// constructed when it is used for the first time, the memory of positions which were never used is not touched.
+/// @tparam T the type of the elements
+/// @tparam MaxCapacity the upper bound for the runtime capacity, it is the capacity of the list returned by content()
+/// @note all positions have the size of T, the queue and history capacities of a single port are therefore still the
+/// compile time maxima, sizing them with the port options is described in doc/design/draft/runtime-sized-port-data.md
+template <typename T, uint64_t MaxCapacity>
+class PortDataArena
+{
+  public:
+    /// @brief the alignment of the memory which is allocated for the positions
+    static constexpr uint64_t MEMORY_ALIGNMENT{posix::Allocator::MEMORY_ALIGNMENT};
+
+    /// @brief Creates the arena and allocates the positions
+    /// @param[in] capacity the number of positions, must not exceed MaxCapacity
+    /// @param[in] allocator to allocate the positions from, the memory must outlive the arena
+    PortDataArena(const uint64_t capacity, posix::Allocator& allocator) noexcept;
+    ~PortDataArena() noexcept;
+
+    PortDataArena(const PortDataArena&) = delete;
+    PortDataArena(PortDataArena&&) = delete;
+    PortDataArena& operator=(const PortDataArena&) = delete;
+    PortDataArena& operator=(PortDataArena&&) = delete;
+
+    /// @brief returns the memory which is allocated for an arena with the given capacity
+    static uint64_t requiredMemorySize(const uint64_t capacity) noexcept;
+
+    /// @brief returns the number of positions
+    uint64_t capacity() const noexcept;
+
+    bool hasFreeSpace() noexcept;
+
+    template <typename... Targs>
+    T* insert(Targs&&... args) noexcept;
+
+    void erase(const T* const element) noexcept;
+
+    cxx::vector<T*, MaxCapacity> content() noexcept;
+
+    /// @brief returns the element at the position or a nullptr when the position is empty
+    T* get(const uint64_t index) noexcept;
+
+    /// @brief returns the position of the element, the element must be contained
+    uint64_t indexOf(const T* const element) const noexcept;
+
+  private:
+    using Position_t = cxx::optional<T>;
+
+    Position_t* positions() const noexcept;
+
+  private:
+    uint64_t m_capacity{0U};
+    /// @brief the number of positions which were constructed so far
+    uint64_t m_size{0U};
+    memory::RelativePointer<Position_t> m_positions;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/port_data_arena.inl"
+
+#endif // IOX_POSH_ROUDI_PORT_DATA_ARENA_HPP
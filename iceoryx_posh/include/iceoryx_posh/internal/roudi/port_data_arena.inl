@@ -0,0 +1,162 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_PORT_DATA_ARENA_INL
+#define IOX_POSH_ROUDI_PORT_DATA_ARENA_INL
+
+#include "iceoryx_posh/internal/roudi/port_data_arena.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t MaxCapacity>
+constexpr uint64_t PortDataArena<T, MaxCapacity>::MEMORY_ALIGNMENT;
+
+template <typename T, uint64_t MaxCapacity>
+inline PortDataArena<T, MaxCapacity>::PortDataArena(const uint64_t capacity, posix::Allocator& allocator) noexcept
+    : m_capacity(capacity)
+{
+    static_assert(alignof(Position_t) <= MEMORY_ALIGNMENT, "the positions require a larger alignment");
+    cxx::Expects(capacity <= MaxCapacity);
+
+    if (m_capacity > 0U)
+    {
+        m_positions = static_cast<Position_t*>(allocator.allocate(requiredMemorySize(m_capacity), MEMORY_ALIGNMENT));
+    }
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline PortDataArena<T, MaxCapacity>::~PortDataArena() noexcept
+{
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        positions()[i].~Position_t();
+    }
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline uint64_t PortDataArena<T, MaxCapacity>::requiredMemorySize(const uint64_t capacity) noexcept
+{
+    return cxx::align(capacity * sizeof(Position_t), MEMORY_ALIGNMENT);
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline uint64_t PortDataArena<T, MaxCapacity>::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline typename PortDataArena<T, MaxCapacity>::Position_t* PortDataArena<T, MaxCapacity>::positions() const noexcept
+{
+    return m_positions.get();
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline bool PortDataArena<T, MaxCapacity>::hasFreeSpace() noexcept
+{
+    if (m_size < m_capacity)
+    {
+        return true;
+    }
+
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        if (!positions()[i].has_value())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename T, uint64_t MaxCapacity>
+template <typename... Targs>
+inline T* PortDataArena<T, MaxCapacity>::insert(Targs&&... args) noexcept
+{
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        auto& position = positions()[i];
+        if (!position.has_value())
+        {
+            position.emplace(std::forward<Targs>(args)...);
+            return &position.value();
+        }
+    }
+
+    cxx::Expects(m_size < m_capacity);
+    auto position = new (&positions()[m_size]) Position_t();
+    ++m_size;
+    position->emplace(std::forward<Targs>(args)...);
+    return &position->value();
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline void PortDataArena<T, MaxCapacity>::erase(const T* const element) noexcept
+{
+    auto index = indexOf(element);
+    if (index < m_size)
+    {
+        positions()[index].reset();
+    }
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline cxx::vector<T*, MaxCapacity> PortDataArena<T, MaxCapacity>::content() noexcept
+{
+    cxx::vector<T*, MaxCapacity> returnValue;
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        auto& position = positions()[i];
+        if (position.has_value())
+        {
+            returnValue.emplace_back(&position.value());
+        }
+    }
+    return returnValue;
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline T* PortDataArena<T, MaxCapacity>::get(const uint64_t index) noexcept
+{
+    if (index >= m_size || !positions()[index].has_value())
+    {
+        return nullptr;
+    }
+    return &positions()[index].value();
+}
+
+template <typename T, uint64_t MaxCapacity>
+inline uint64_t PortDataArena<T, MaxCapacity>::indexOf(const T* const element) const noexcept
+{
+    // the element is stored inside of its position, therefore the position is found without a search
+    const auto* begin = reinterpret_cast<const uint8_t*>(positions());
+    const auto* address = reinterpret_cast<const uint8_t*>(element);
+    if (m_size == 0U || address < begin || address >= begin + m_size * sizeof(Position_t))
+    {
+        return m_size;
+    }
+
+    const auto index = static_cast<uint64_t>(address - begin) / sizeof(Position_t);
+    const auto& position = positions()[index];
+    return (position.has_value() && &position.value() == element) ? index : m_size;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PORT_DATA_ARENA_INL
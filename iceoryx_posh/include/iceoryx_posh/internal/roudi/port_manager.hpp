@@ -25,6 +25,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
@@ -35,7 +36,10 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/roudi/chunk_garbage_collector.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_index.hpp"
+#include "iceoryx_posh/internal/roudi/service_description_index.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
@@ -65,6 +69,27 @@ class PortManager
 
     void doDiscovery() noexcept;
 
+    /// @brief Blocks until a port changed its state and requires a discovery run or until the timeout has passed
+    /// @param[in] timeout the maximum time to wait for a discovery request
+    /// @return true if a discovery run was requested, false if the timeout has passed
+    bool waitForDiscoveryRequest(const units::Duration& timeout) noexcept;
+
+    /// @brief Wakes up a waitForDiscoveryRequest call, e.g. when the discovery shall be stopped
+    void requestDiscovery() noexcept;
+
+    /// @brief Blocks until a runtime submitted a request to its command channel or until the timeout has passed
+    /// @param[in] timeout the maximum time to wait for a request
+    /// @return the command channel with the submitted request or cxx::nullopt if the timeout has passed
+    /// @note threadsafe, it can be called concurrently to the other methods
+    cxx::optional<runtime::CommandChannel*> waitForCommandChannelRequest(const units::Duration& timeout) noexcept;
+
+    /// @brief Creates the publisher and subscriber ports of the static topology and connects them. A runtime takes
+    /// the port of its name with the service of a connection when it requests it instead of creating a new one and
+    /// the port is restored when the runtime terminates.
+    /// @param[in] staticConnections of the RouDi config
+    /// @note must be called before the runtimes are started, the options of the static connection apply to the port
+    void createStaticTopology(const config::RouDiConfig::StaticConnections_t& staticConnections) noexcept;
+
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -121,6 +146,21 @@ class PortManager
     cxx::expected<popo::ConditionVariableData*, PortPoolError>
     acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Acquires the heartbeat with which a runtime signals its liveliness
+    /// @param [in] runtimeName of the runtime which owns the heartbeat
+    /// @return on success a pointer to the Heartbeat; on error a PortPoolError
+    cxx::expected<runtime::Heartbeat*, PortPoolError> acquireHeartbeat(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Acquires the command channel with which a runtime sends its requests after the registration
+    /// @param [in] runtimeName of the runtime which owns the command channel
+    /// @return on success a pointer to the CommandChannel; on error a PortPoolError
+    cxx::expected<runtime::CommandChannel*, PortPoolError>
+    acquireCommandChannel(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Releases the command channel of a runtime which is removed
+    /// @param [in] commandChannel which was acquired with acquireCommandChannel, a nullptr is ignored
+    void releaseCommandChannel(runtime::CommandChannel* const commandChannel) noexcept;
+
     /// @brief Used to unblock potential locks in the shutdown phase of a process
     /// @param [in] name of the process runtime which is about to shut down
     void unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept;
@@ -139,16 +179,22 @@ class PortManager
 
     void handlePublisherPorts() noexcept;
 
+    void handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
+
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
 
     void handleSubscriberPorts() noexcept;
 
+    void handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
     void doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept;
 
     void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
     void handleClientPorts() noexcept;
 
+    void handleClientPort(popo::ClientPortData* const clientPortData) noexcept;
+
     void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
 
     void makeAllServerPortsToStopOffer() noexcept;
@@ -157,14 +203,54 @@ class PortManager
 
     void handleServerPorts() noexcept;
 
+    void handleServerPort(popo::ServerPortData* const serverPortData) noexcept;
+
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
 
+    /// @brief runs the discovery only for the ports which requested it since the last discovery run
+    void handleDirtyPorts() noexcept;
+
     void handleInterfaces() noexcept;
 
     void handleNodes() noexcept;
 
     void handleConditionVariables() noexcept;
 
+    /// @brief reclaims the chunks which were leaked by terminated processes, runs only when a process was removed
+    /// since the last finished collection
+    void collectLeakedChunks() noexcept;
+
+    /// @brief records the chunk transfers of all ports in the current collection
+    void recordChunkTransfers() noexcept;
+
+    /// @brief creates the ports of the static topology which belong to the runtime
+    void createStaticPortsOfRuntime(const RuntimeName_t& runtimeName) noexcept;
+
+    void createStaticPublisherPort(const config::StaticConnection& connection) noexcept;
+
+    void createStaticSubscriberPort(const config::StaticConnection& connection,
+                                    const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief hands the port of the static topology over to the runtime which requests it, a port whose options
+    /// or PortConfigInfo do not match the requested ones is destroyed since the runtime gets a new port
+    /// @return the port data or cxx::nullopt if there is no matching port of the static topology which was not yet
+    /// taken
+    cxx::optional<PublisherPortRouDiType::MemberType_t*>
+    takeStaticPublisherPortData(const capro::ServiceDescription& service,
+                                const popo::PublisherOptions& publisherOptions,
+                                const RuntimeName_t& runtimeName,
+                                mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                const PortConfigInfo& portConfigInfo) noexcept;
+
+    cxx::optional<SubscriberPortType::MemberType_t*>
+    takeStaticSubscriberPortData(const capro::ServiceDescription& service,
+                                 const popo::SubscriberOptions& subscriberOptions,
+                                 const RuntimeName_t& runtimeName,
+                                 const PortConfigInfo& portConfigInfo) noexcept;
+
+    static bool isPortConfigInfoOfStaticPort(const PortConfigInfo& portConfigInfo,
+                                             const mepoo::MemoryInfo& memoryInfoOfStaticPort) noexcept;
+
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
@@ -198,7 +284,10 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
-    void publishServiceRegistry() const noexcept;
+    void publishServiceRegistry() noexcept;
+
+    void publishServiceRegistryChange(const ServiceRegistryChange::Type type,
+                                      const capro::ServiceDescription& service) noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
@@ -209,6 +298,36 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     cxx::vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     cxx::optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    cxx::optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryChangePublisherPortData;
+    uint64_t m_publishedServiceRegistryGeneration{0U};
+    uint64_t m_publishedServiceRegistryChangeGeneration{0U};
+    cxx::optional<popo::ConditionListener> m_discoveryConditionListener;
+    ServiceDescriptionIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publisherIndex;
+    ServiceDescriptionIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscriberIndex;
+    ServiceDescriptionIndex<popo::ClientPortData, MAX_CLIENTS> m_clientIndex;
+    ServiceDescriptionIndex<popo::ServerPortData, MAX_SERVERS> m_serverIndex;
+
+    // the data owned by a runtime, to delete it without searching the port pool when the runtime terminates
+    RuntimeNameIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publishersOfRuntime;
+    RuntimeNameIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscribersOfRuntime;
+    RuntimeNameIndex<popo::ClientPortData, MAX_CLIENTS> m_clientsOfRuntime;
+    RuntimeNameIndex<popo::ServerPortData, MAX_SERVERS> m_serversOfRuntime;
+    RuntimeNameIndex<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacesOfRuntime;
+    RuntimeNameIndex<runtime::NodeData, MAX_NODE_NUMBER> m_nodesOfRuntime;
+    RuntimeNameIndex<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariablesOfRuntime;
+    RuntimeNameIndex<runtime::Heartbeat, MAX_PROCESS_NUMBER> m_heartbeatsOfRuntime;
+
+    // the connections are kept to restore the ports of the static topology when their runtime terminates
+    config::RouDiConfig::StaticConnections_t m_staticConnections;
+    // the ports of the static topology which were not yet taken by their runtime
+    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_STATIC_CONNECTIONS> m_untakenStaticPublishers;
+    cxx::vector<SubscriberPortType::MemberType_t*, MAX_STATIC_CONNECTIONS * MAX_SUBSCRIBERS_PER_STATIC_CONNECTION>
+        m_untakenStaticSubscribers;
+    bool m_restoreStaticPorts{true};
+
+    ChunkGarbageCollector m_chunkGarbageCollector;
+    bool m_chunkGarbageCollectionRequested{false};
+    mepoo::TimePointNs_t m_lastChunkGarbageCollection;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -219,6 +338,13 @@ class PortManager
                                              mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                              const PortConfigInfo& portConfigInfo) noexcept;
 
+    // the ports of the static topology are created with this method, it does not take one of them
+    cxx::expected<SubscriberPortType::MemberType_t*, PortPoolError>
+    acquireNewSubscriberPortData(const capro::ServiceDescription& service,
+                                 const popo::SubscriberOptions& subscriberOptions,
+                                 const RuntimeName_t& runtimeName,
+                                 const PortConfigInfo& portConfigInfo) noexcept;
+
     PublisherPortRouDiType::MemberType_t* acquireInternalPublisherPortDataWithoutDiscovery(
         const capro::ServiceDescription& service,
         const popo::PublisherOptions& publisherOptions,
@@ -27,21 +27,19 @@ template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPoli
 inline cxx::optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept
 {
+    cxx::optional<RuntimeName_t> usedByProcess;
     // check if the publisher is already in the list
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
-    {
-        popo::PublisherPortRouDi publisherPort(publisherPortData);
-        if (service == publisherPort.getCaProServiceDescription())
+    m_publisherIndex.forEach(service, [&](PublisherPortRouDiType::MemberType_t* publisherPortData) {
+        if (publisherPortData->m_toBeDestroyed)
         {
-            if (publisherPortData->m_toBeDestroyed)
-            {
-                destroyPublisherPort(publisherPortData);
-                continue;
-            }
-            return cxx::make_optional<RuntimeName_t>(publisherPortData->m_runtimeName);
+            destroyPublisherPort(publisherPortData);
         }
-    }
-    return cxx::nullopt;
+        else if (!usedByProcess.has_value())
+        {
+            usedByProcess.emplace(publisherPortData->m_runtimeName);
+        }
+    });
+    return usedByProcess;
 }
 
 template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPolicy>::value>*>
@@ -21,12 +21,19 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/roudi/port_data_arena.hpp"
+#include "iceoryx_posh/internal/runtime/command_channel.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
+#include "iceoryx_posh/roudi/roudi_config.hpp"
+
+#include <array>
 
 namespace iox
 {
@@ -48,21 +55,47 @@ class FixedPositionContainer
 
     cxx::vector<T*, Capacity> content() noexcept;
 
+    /// @brief returns the element at the position or a nullptr when the position is empty
+    T* get(const uint64_t index) noexcept;
+
+    /// @brief returns the position of the element, the element must be contained
+    uint64_t indexOf(const T* const element) const noexcept;
+
   private:
     cxx::vector<cxx::optional<T>, Capacity> m_data;
 };
 
 struct PortPoolData
 {
+    /// @brief Creates the PortPoolData, the publisher, subscriber, client and server port data are allocated from the
+    /// arena with the capacities of the config instead of the compile time maxima
+    /// @param[in] config with the number of ports of every type
+    /// @param[in] arenaAllocator to allocate the port data from, it must provide requiredArenaMemorySize(config)
+    PortPoolData(const config::RouDiConfig& config, posix::Allocator& arenaAllocator) noexcept;
+
+    /// @brief returns the memory which the port data require from the arena allocator
+    static uint64_t requiredArenaMemorySize(const config::RouDiConfig& config) noexcept;
+
     FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortMembers;
     FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER> m_nodeMembers;
     FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableMembers;
+    FixedPositionContainer<runtime::Heartbeat, MAX_PROCESS_NUMBER> m_heartbeatMembers;
+
+    PortDataArena<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
+    PortDataArena<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+
+    PortDataArena<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
+    PortDataArena<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
 
-    FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
-    FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+    /// @brief the ports notify this condition variable when they change their state to wake up the discovery
+    popo::ConditionVariableData m_discoveryConditionVariableData{IPC_CHANNEL_ROUDI_NAME};
+    /// @brief the ports which changed their state since the last discovery run
+    popo::DirtyPortList m_dirtyPortList;
 
-    FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
-    FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+    /// @brief the runtimes submit the indices of their command channels with a pending request to this queue
+    runtime::CommandChannelQueue m_commandChannelQueue;
+    /// @brief the command channels are never destroyed, a channel which is closed can be opened for another runtime
+    std::array<runtime::CommandChannel, MAX_PROCESS_NUMBER> m_commandChannels;
 };
 
 } // namespace roudi
@@ -22,6 +22,22 @@ namespace iox
 {
 namespace roudi
 {
+inline PortPoolData::PortPoolData(const config::RouDiConfig& config, posix::Allocator& arenaAllocator) noexcept
+    : m_publisherPortMembers(config.m_maxNumberOfPublishers, arenaAllocator)
+    , m_subscriberPortMembers(config.m_maxNumberOfSubscribers, arenaAllocator)
+    , m_serverPortMembers(config.m_maxNumberOfServers, arenaAllocator)
+    , m_clientPortMembers(config.m_maxNumberOfClients, arenaAllocator)
+{
+}
+
+inline uint64_t PortPoolData::requiredArenaMemorySize(const config::RouDiConfig& config) noexcept
+{
+    return decltype(m_publisherPortMembers)::requiredMemorySize(config.m_maxNumberOfPublishers)
+           + decltype(m_subscriberPortMembers)::requiredMemorySize(config.m_maxNumberOfSubscribers)
+           + decltype(m_serverPortMembers)::requiredMemorySize(config.m_maxNumberOfServers)
+           + decltype(m_clientPortMembers)::requiredMemorySize(config.m_maxNumberOfClients);
+}
+
 template <typename T, uint64_t Capacity>
 bool FixedPositionContainer<T, Capacity>::hasFreeSpace() noexcept
 {
@@ -86,6 +102,30 @@ cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content() noexcep
     return returnValue;
 }
 
+template <typename T, uint64_t Capacity>
+T* FixedPositionContainer<T, Capacity>::get(const uint64_t index) noexcept
+{
+    if (index >= m_data.size() || !m_data[index].has_value())
+    {
+        return nullptr;
+    }
+    return &m_data[index].value();
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::indexOf(const T* const element) const noexcept
+{
+    uint64_t index = 0U;
+    for (; index < m_data.size(); ++index)
+    {
+        if (m_data[index].has_value() && &m_data[index].value() == element)
+        {
+            break;
+        }
+    }
+    return index;
+}
+
 } // namespace roudi
 } // namespace iox
 
@@ -17,9 +17,13 @@
 #ifndef IOX_POSH_ROUDI_PROCESS_HPP
 #define IOX_POSH_ROUDI_PROCESS_HPP
 
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iceoryx_posh/internal/runtime/command_channel.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
@@ -41,23 +45,37 @@ class Process
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] dataSegmentId is an identifier for the shm data segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
+    /// @param [in] heartbeat in the management segment which is incremented by the application to signal its
+    /// liveliness; a nullptr when the application sends KEEPALIVE messages instead
+    /// @param [in] pidfd which becomes readable when the process terminates, the process takes the ownership
+    /// @param [in] commandChannel in the management segment with which the application sends its requests after the
+    /// registration; a nullptr when the application uses only the IPC channel
+    /// @param [in] isInProcess indicates that the application runs in the same process like RouDi and hands its
+    /// requests directly to RouDi; there is no IPC channel to such an application
     Process(const RuntimeName_t& name,
             const uint32_t pid,
             const posix::PosixUser& user,
             const bool isMonitored,
-            const uint64_t sessionId) noexcept;
+            const uint64_t sessionId,
+            runtime::Heartbeat* const heartbeat = nullptr,
+            const int32_t pidfd = ProcessTerminationMonitor::INVALID_PIDFD,
+            runtime::CommandChannel* const commandChannel = nullptr,
+            const bool isInProcess = false) noexcept;
 
     Process(const Process& other) = delete;
     Process& operator=(const Process& other) = delete;
     /// @note the move cTor and assignment operator are already implicitly deleted because of the atomic
     Process(Process&& other) = delete;
     Process& operator=(Process&& other) = delete;
-    ~Process() noexcept = default;
+    ~Process() noexcept;
 
     uint32_t getPid() const noexcept;
 
     const RuntimeName_t getName() const noexcept;
 
+    /// @brief Sends a message to the application, a response to a request from the command channel is sent via the
+    /// command channel and all other messages via the IPC channel which is opened with the first such message
+    /// @param [in] data is the message for the application
     void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
 
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
@@ -68,17 +86,42 @@ class Process
 
     mepoo::TimePointNs_t getTimestamp() noexcept;
 
+    /// @brief Sets the timestamp to the provided time if the heartbeat of the process changed since the last call
+    /// @param [in] now is the current time
+    void updateTimestampFromHeartbeat(const mepoo::TimePointNs_t now) noexcept;
+
+    /// @brief The heartbeat of the process in the management segment
+    /// @return the heartbeat or a nullptr when the process sends KEEPALIVE messages
+    runtime::Heartbeat* getHeartbeat() const noexcept;
+
+    /// @brief The command channel of the process in the management segment
+    /// @return the command channel or a nullptr when the process uses only the IPC channel
+    runtime::CommandChannel* getCommandChannel() const noexcept;
+
     posix::PosixUser getUser() const noexcept;
 
     bool isMonitored() const noexcept;
 
+    /// @brief Returns true if the application runs in the same process like RouDi and has no IPC channel
+    bool isInProcess() const noexcept;
+
+    /// @brief Checks with the pidfd whether the process terminated
+    /// @return true if the process terminated, false if it is still running or has no pidfd
+    bool hasTerminated() const noexcept;
+
   private:
     const uint32_t m_pid{0U};
-    runtime::IpcInterfaceUser m_ipcChannel;
+    RuntimeName_t m_name;
+    cxx::optional<runtime::IpcInterfaceUser> m_ipcChannel;
     mepoo::TimePointNs_t m_timestamp;
     posix::PosixUser m_user;
     bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
+    runtime::Heartbeat* m_heartbeat{nullptr};
+    uint64_t m_lastHeartbeatCounter{0U};
+    int32_t m_pidfd{ProcessTerminationMonitor::INVALID_PIDFD};
+    runtime::CommandChannel* m_commandChannel{nullptr};
+    bool m_isInProcess{false};
 };
 
 } // namespace roudi
@@ -17,19 +17,25 @@
 #ifndef IOX_POSH_ROUDI_PROCESS_MANAGER_HPP
 #define IOX_POSH_ROUDI_PROCESS_MANAGER_HPP
 
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/list.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_index.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_frame.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_port_request.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 
 #include <cstdint>
 #include <ctime>
+#include <mutex>
 
 namespace iox
 {
@@ -43,6 +49,11 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief Manages the registered processes and creates their ports. The ProcessManager is thread safe, the process
+///        list and the PortManager are guarded by separate mutexes so that e.g. a keep alive message does not wait
+///        for a discovery run. If both are required, the process list is always locked first. A registration
+///        acquires the heartbeat and the command channel from the PortManager while the process list is locked,
+///        but opens the IPC channel to the process and sends the REG_ACK after the lock was released.
 class ProcessManager : public ProcessManagerInterface
 {
   public:
@@ -71,6 +82,8 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] binaryProtocolVersion version of the binary protocol which is supported by the process, 0 if the
+    /// process supports only the string based protocol
     /// @return false if process was already registered, true otherwise
     bool registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
@@ -78,7 +91,8 @@ class ProcessManager : public ProcessManagerInterface
                          const bool isMonitored,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const uint16_t binaryProtocolVersion = 0U) noexcept;
 
     /// @brief Unregisters a process at the ProcessManager
     /// @param [in] name of the process which wants to unregister
@@ -146,21 +160,86 @@ class ProcessManager : public ProcessManagerInterface
 
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Creates the resources of a batch of binary requests and sends one binary frame with a response for
+    ///        every request to the process
+    /// @param[in] name is the name of the runtime requesting the resources
+    /// @param[in] numberOfRequests is the number of IpcPortRequests in the frame
+    /// @param[in] requests is the frame which is positioned at the first IpcPortRequest
+    void addPortsForProcess(const RuntimeName_t& name,
+                            const uint16_t numberOfRequests,
+                            runtime::IpcBinaryFrame& requests) noexcept;
+
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
     void run() noexcept;
 
+    /// @brief Returns true if the termination of the monitored processes is detected with pidfds
+    bool isProcessTerminationMonitoringSupported() const noexcept;
+
+    /// @brief Blocks until a monitored process terminated or the timeout passed and removes the terminated processes
+    /// @param [in] timeout the maximum time to wait for the termination of a process
+    void handleProcessTermination(const units::Duration timeout) noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
     void sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept;
 
+    /// @brief Creates the requested resource for a process without serializing the response
+    /// @param[in] name is the name of the runtime requesting the resource
+    /// @param[in] request describes the resource
+    /// @return the ACK with the location of the resource in the management segment or an ERROR
+    runtime::IpcPortResponse addPortForProcess(const RuntimeName_t& name,
+                                               const runtime::IpcPortRequest& request) noexcept;
+
+    /// @brief Calls the callable which processes a request of a runtime in the same process like RouDi. The messages
+    /// which are sent meanwhile from the calling thread to a runtime in the same process are stored in the response
+    /// instead of being sent via an IPC channel; a runtime which registers meanwhile is registered as such a runtime
+    /// @param[out] response to the request
+    /// @param[in] callable which processes the request
+    void processInProcessRequest(runtime::IpcMessage& response, const cxx::function_ref<void()> callable) noexcept;
+
+    /// @brief Runs the discovery for the ports which changed their state since the last discovery run
+    void discoveryUpdate() noexcept override;
+
 
   private:
     cxx::optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
+    /// @brief Calls the callable with the PortManager while the PortManager mutex is locked
+    /// @return the return value of the callable
+    template <typename Callable>
+    auto withPortManager(const Callable& callable) noexcept -> decltype(callable(std::declval<PortManager&>()))
+    {
+        std::lock_guard<std::mutex> lock(m_portManagerMutex);
+        return callable(m_portManager);
+    }
+
     void monitorProcesses() noexcept;
-    void discoveryUpdate() noexcept override;
+
+    /// @brief Sends a message to the process, the process list must be locked by the caller
+    /// @note a message to a runtime in the same process like RouDi is stored as response of the in-process request
+    void sendToProcess(Process& process, const runtime::IpcMessage& message) noexcept;
+
+    /// @brief Creates the requested resource and sends the response as string based IpcMessage to the process
+    void addPortForProcessAndSendResponse(const RuntimeName_t& name, const runtime::IpcPortRequest& request) noexcept;
+
+    /// @brief Creates the requested resource for the process, the process list must be locked by the caller
+    /// @return the ACK with the location of the resource in the management segment or an ERROR
+    runtime::IpcPortResponse createPortForProcess(Process& process, const runtime::IpcPortRequest& request) noexcept;
+    runtime::IpcPortResponse createPublisherForProcess(Process& process,
+                                                       const runtime::IpcPortRequest& request) noexcept;
+    runtime::IpcPortResponse createSubscriberForProcess(Process& process,
+                                                        const runtime::IpcPortRequest& request) noexcept;
+    runtime::IpcPortResponse createClientForProcess(Process& process, const runtime::IpcPortRequest& request) noexcept;
+    runtime::IpcPortResponse createServerForProcess(Process& process, const runtime::IpcPortRequest& request) noexcept;
+    runtime::IpcPortResponse createInterfaceForProcess(Process& process,
+                                                       const runtime::IpcPortRequest& request) noexcept;
+    runtime::IpcPortResponse createNodeForProcess(Process& process, const runtime::IpcPortRequest& request) noexcept;
+    runtime::IpcPortResponse createConditionVariableForProcess(Process& process) noexcept;
+    runtime::IpcPortResponse ackResponse(const runtime::IpcMessageType requestType,
+                                         void* const resource) const noexcept;
+    static runtime::IpcPortResponse errorResponse(const runtime::IpcMessageErrorType error) noexcept;
 
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
@@ -169,6 +248,8 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] binaryProtocolVersion version of the binary protocol which is supported by the process
+    /// @param [out] registrationAck the REG_ACK which has to be sent to the process when it was added
     /// @return Returns if the process could be added successfully.
     bool addProcess(const RuntimeName_t& name,
                     const uint32_t pid,
@@ -176,7 +257,15 @@ class ProcessManager : public ProcessManagerInterface
                     const bool isMonitored,
                     const int64_t transmissionTimestamp,
                     const uint64_t sessionId,
-                    const version::VersionInfo& versionInfo) noexcept;
+                    const version::VersionInfo& versionInfo,
+                    const uint16_t binaryProtocolVersion,
+                    runtime::IpcMessage& registrationAck) noexcept;
+
+    /// @brief Sends the REG_ACK to a process which was just added, the process list must not be locked since the
+    /// IPC channel to the process is opened for this message
+    /// @param [in] name of the process
+    /// @param [in] registrationAck the message which was created by addProcess
+    static void sendRegistrationAck(const RuntimeName_t& name, const runtime::IpcMessage& registrationAck) noexcept;
 
     /// @brief Removes the process from the managed client process list, identified by its id.
     /// @param [in] name The process name which should be removed.
@@ -221,14 +310,37 @@ class ProcessManager : public ProcessManagerInterface
                            const char* errorString,
                            ShutdownPolicy shutdownPolicy) noexcept;
 
+    /// @brief The key of the process index, the name of a process is only accessible via getName
+    struct ProcessNameKey
+    {
+        using Type = RuntimeName_t;
+
+        static RuntimeName_t of(const Process& process) noexcept
+        {
+            return process.getName();
+        }
+
+        static uint64_t hash(const RuntimeName_t& name) noexcept
+        {
+            return hashRuntimeName(name);
+        }
+    };
+
     RouDiMemoryInterface& m_roudiMemoryInterface;
     PortManager& m_portManager;
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     memory::segment_id_underlying_t m_mgmtSegmentId{memory::UntypedRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
+    ElementIndex<Process, MAX_PROCESS_NUMBER, ProcessNameKey> m_processIndex;
+    ProcessTerminationMonitor m_processTerminationMonitor;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
+    std::mutex m_processListMutex;
+    std::mutex m_portManagerMutex;
+
+    /// @brief the response of the in-process request which is processed by the current thread
+    static thread_local runtime::IpcMessage* t_inProcessResponse;
 };
 
 } // namespace roudi
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+#define IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Detects the termination of processes with pidfds, this allows RouDi to clean up the resources of a
+/// crashed process immediately instead of waiting for the keep alive timeout. On platforms without pidfds the
+/// monitor is not supported and the processes are only monitored with the keep alive mechanism.
+class ProcessTerminationMonitor
+{
+  public:
+    static constexpr int32_t INVALID_PIDFD{-1};
+
+    ProcessTerminationMonitor() noexcept;
+    ~ProcessTerminationMonitor() noexcept;
+
+    ProcessTerminationMonitor(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor(ProcessTerminationMonitor&&) = delete;
+    ProcessTerminationMonitor& operator=(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor& operator=(ProcessTerminationMonitor&&) = delete;
+
+    /// @brief Returns true if the platform and the kernel support the detection with pidfds
+    bool isSupported() const noexcept;
+
+    /// @brief Opens a pidfd for the process and watches it, the process is no longer watched when the pidfd is closed
+    /// @param[in] pid of the process
+    /// @return the pidfd which is owned by the caller and must be closed with closePidfd, cxx::nullopt if the process
+    /// cannot be watched
+    cxx::optional<int32_t> watch(const uint32_t pid) noexcept;
+
+    /// @brief Blocks until one of the watched processes terminated or the timeout passed
+    /// @param[in] timeout the maximum time to block
+    /// @return true if a watched process terminated, false otherwise
+    bool waitForTermination(const units::Duration timeout) noexcept;
+
+    /// @brief Checks without blocking whether the process of the pidfd terminated
+    /// @param[in] pidfd of the process
+    /// @return true if the process terminated, false if it is still running or the pidfd is invalid
+    static bool hasTerminated(const int32_t pidfd) noexcept;
+
+    /// @brief Closes a pidfd which was returned by watch
+    /// @param[in] pidfd to close
+    static void closePidfd(const int32_t pidfd) noexcept;
+
+  private:
+    int32_t m_pidfdSet{INVALID_PIDFD};
+};
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
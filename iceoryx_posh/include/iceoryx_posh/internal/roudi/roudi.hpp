@@ -17,19 +17,23 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/scope_guard.hpp"
-#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_platform/file.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/runtime_message_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_posh/internal/runtime/in_process_request_handler.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <thread>
 
@@ -39,7 +43,7 @@ namespace roudi
 {
 using namespace iox::units::duration_literals;
 
-class RouDi
+class RouDi : public runtime::InProcessRequestHandler
 {
   public:
     /// @brief Indicate whether the thread processing messages from the runtimes will start directly or deferred
@@ -47,7 +51,10 @@ class RouDi
     enum class RuntimeMessagesThreadStart
     {
         IMMEDIATE,
-        DEFER_START
+        DEFER_START,
+        /// @brief neither the IPC channel nor the runtime messages threads are created, only runtimes in the same
+        /// process which hand their requests directly to RouDi can register
+        NONE
     };
 
     struct RoudiStartupParameters
@@ -57,12 +64,14 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const uint32_t runtimeMessagesThreadCount = roudi::DEFAULT_RUNTIME_MESSAGES_THREAD_COUNT) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_runtimeMessagesThreadCount(runtimeMessagesThreadCount)
         {
         }
 
@@ -71,6 +80,9 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        /// @brief the number of threads which process the messages of the runtimes, it is clamped to
+        ///        [1, MAX_RUNTIME_MESSAGES_THREAD_COUNT]
+        const uint32_t m_runtimeMessagesThreadCount;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -82,8 +94,18 @@ class RouDi
 
     virtual ~RouDi() noexcept;
 
+    /// @copydoc runtime::InProcessRequestHandler::processRequest
+    bool processRequest(const runtime::IpcMessage& request, runtime::IpcMessage& response) noexcept override;
+
+    /// @copydoc runtime::InProcessRequestHandler::processPortRequest
+    /// @note the ports of the runtime are connected by a discovery run in the calling thread before the call returns,
+    /// therefore the runtime does not wait for the discovery thread
+    runtime::IpcPortResponse processPortRequest(const RuntimeName_t& runtimeName,
+                                                const runtime::IpcPortRequest& request) noexcept override;
+
   protected:
-    /// @brief Starts the thread processing messages from the runtimes
+    /// @brief Starts the threads processing messages from the runtimes, the same number of threads processes the IPC
+    /// channel and the command channels
     /// Once this is done, applications can register and Roudi is fully operational.
     void startProcessRuntimeMessagesThread() noexcept;
 
@@ -92,12 +114,18 @@ class RouDi
     ///
     /// @note Intentionally not virtual to be able to call it in derived class
     void shutdown() noexcept;
+
+    /// @note with more than one runtime messages thread this is called concurrently, an override must be thread safe
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
     virtual void cyclicUpdateHook() noexcept;
     void IpcMessageErrorHandler() noexcept;
 
+    /// @brief Handles a message which contains an IpcBinaryFrame with a batch of IpcPortRequests
+    /// @param [in] message with the encoded frame
+    void processBinaryMessage(const runtime::IpcMessage& message) noexcept;
+
     version::VersionInfo parseRegisterMessage(const runtime::IpcMessage& message,
                                               uint32_t& pid,
                                               uid_t& userId,
@@ -110,12 +138,14 @@ class RouDi
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] binaryProtocolVersion version of the binary protocol which is supported by the process
     void registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
                          const posix::PosixUser user,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const uint16_t binaryProtocolVersion = 0U) noexcept;
 
     /// @brief Creates a unique ID which can be used to check outdated IPC channel transmissions
     /// @return a unique, monotonic and consecutive increasing number
@@ -124,14 +154,28 @@ class RouDi
   private:
     void processRuntimeMessages() noexcept;
 
+    /// @brief processes the requests which the runtimes send via their command channels after the registration
+    void processCommandChannelRequests() noexcept;
+
+    /// @brief processes a runtime message and reports the processing time to the runtime message introspection
+    void processRuntimeMessage(const runtime::IpcMessage& message) noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
+    /// @brief removes the monitored processes immediately when they terminate, requires pidfds
+    void monitorProcessTermination() noexcept;
+
     cxx::ScopeGuard m_unregisterRelativePtr{[] { memory::UntypedRelativePointer::unregisterAll(); }};
     bool m_killProcessesInDestructor;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
     std::atomic_bool m_runHandleRuntimeMessageThread;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
+    /// @brief the time after which the process termination thread checks whether RouDi shuts down
+    const units::Duration m_processTerminationWaitTimeout{100_ms};
+    uint32_t m_runtimeMessagesThreadCount{DEFAULT_RUNTIME_MESSAGES_THREAD_COUNT};
+    /// @brief all runtime messages threads receive from this channel, every message is received by one of them
+    cxx::optional<runtime::IpcInterfaceCreator> m_roudiIpcInterface;
 
   protected:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
@@ -145,15 +189,19 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    /// @note the ProcessManager synchronizes itself to process the runtime messages concurrently
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
-    std::thread m_handleRuntimeMessageThread;
+    std::thread m_processTerminationThread;
+    cxx::vector<std::thread, MAX_RUNTIME_MESSAGES_THREAD_COUNT> m_handleRuntimeMessageThreads;
+    cxx::vector<std::thread, MAX_RUNTIME_MESSAGES_THREAD_COUNT> m_handleCommandChannelThreads;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
     MemPoolIntrospectionType m_mempoolIntrospection;
+    RuntimeMessageIntrospectionType m_runtimeMessageIntrospection;
 
   private:
     roudi::MonitoringMode m_monitoringMode{roudi::MonitoringMode::ON};
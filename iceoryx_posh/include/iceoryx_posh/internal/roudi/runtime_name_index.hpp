@@ -0,0 +1,66 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_HPP
+#define IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/element_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Hashes a runtime name with FNV-1a
+inline uint64_t hashRuntimeName(const RuntimeName_t& runtimeName) noexcept
+{
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    const auto* character = runtimeName.c_str();
+    for (uint64_t i = 0U; i < runtimeName.size(); ++i)
+    {
+        hash ^= static_cast<uint8_t>(character[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/// @brief The key of the RuntimeNameIndex, T must provide the member m_runtimeName
+template <typename T>
+struct RuntimeNameKey
+{
+    using Type = RuntimeName_t;
+
+    static const RuntimeName_t& of(const T& element) noexcept
+    {
+        return element.m_runtimeName;
+    }
+
+    static uint64_t hash(const RuntimeName_t& runtimeName) noexcept
+    {
+        return hashRuntimeName(runtimeName);
+    }
+};
+
+/// @brief Maps a runtime name to the elements which are owned by the runtime, e.g. the ports of a process
+template <typename T, uint64_t Capacity>
+using RuntimeNameIndex = ElementIndex<T, Capacity, RuntimeNameKey<T>>;
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RUNTIME_NAME_INDEX_HPP
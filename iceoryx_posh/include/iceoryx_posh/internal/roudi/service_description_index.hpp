@@ -0,0 +1,51 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_HPP
+#define IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/element_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The key of the ServiceDescriptionIndex, T must provide the member m_serviceDescription
+template <typename T>
+struct ServiceDescriptionKey
+{
+    using Type = capro::ServiceDescription;
+
+    static const capro::ServiceDescription& of(const T& element) noexcept
+    {
+        return element.m_serviceDescription;
+    }
+
+    static uint64_t hash(const capro::ServiceDescription& service) noexcept
+    {
+        return service.hash();
+    }
+};
+
+/// @brief Maps a ServiceDescription to the elements, e.g. the port data, which have this service description
+template <typename T, uint64_t Capacity>
+using ServiceDescriptionIndex = ElementIndex<T, Capacity, ServiceDescriptionKey<T>>;
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_HPP
@@ -32,6 +32,25 @@ namespace iox
 {
 namespace roudi
 {
+/// @brief A modification of the ServiceRegistry which RouDi publishes in addition to the complete registry. A
+///        subscriber applies the changes in the order of their generation to its copy of the registry and only
+///        requires the complete registry when it missed a change.
+struct ServiceRegistryChange
+{
+    enum class Type : uint8_t
+    {
+        ADD_PUBLISHER,
+        REMOVE_PUBLISHER,
+        ADD_SERVER,
+        REMOVE_SERVER
+    };
+
+    /// @brief the generation of the registry after the change was applied
+    uint64_t generation{0U};
+    Type type{Type::ADD_PUBLISHER};
+    capro::ServiceDescription serviceDescription;
+};
+
 class ServiceRegistry
 {
   public:
@@ -86,6 +105,8 @@ class ServiceRegistry
     /// @param[in] instance, string or wildcard (= iox::cxx::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::cxx::nullopt) to search for
     /// @param[in] callable, callable to apply to each matching entry
+    /// @note Only the entries which match the non-wildcard strings are visited, a search with three wildcards visits
+    ///       all entries
     void find(const cxx::optional<capro::IdString_t>& service,
               const cxx::optional<capro::IdString_t>& instance,
               const cxx::optional<capro::IdString_t>& event,
@@ -96,22 +117,76 @@ class ServiceRegistry
     /// @note Can be used to obtain all entries or count them
     void forEach(cxx::function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
 
+    /// @brief Returns the generation of the registry which is incremented by every modification
+    uint64_t generation() const noexcept;
+
+    /// @brief Applies a change of another registry, the generation is set to the generation of the change
+    /// @param[in] change, the change to apply, it must have the generation following the one of this registry to
+    ///            result in the same entries as the other registry
+    void apply(const ServiceRegistryChange& change) noexcept;
+
   private:
     using Entry_t = cxx::optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = cxx::vector<Entry_t, CAPACITY>;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
+    /// @brief Selects the strings of a service description which are used as key of a hash index. Every
+    ///        combination of service, instance and event has its own index, therefore a search finds the matching
+    ///        entries in the index of its non-wildcard strings.
+    enum Key : uint8_t
+    {
+        SERVICE = 1U,
+        INSTANCE = 2U,
+        EVENT = 4U,
+        SERVICE_INSTANCE_EVENT = SERVICE | INSTANCE | EVENT
+    };
+    static constexpr uint32_t NUMBER_OF_KEYS = SERVICE_INSTANCE_EVENT;
+
+    /// @brief Chains the indices of the entries whose key hashes fall into the same bucket. The chains are sorted by
+    ///        the entry index and consist of indices instead of pointers, therefore the registry can still be copied
+    ///        into the shared memory.
+    class HashIndex
+    {
+      public:
+        HashIndex() noexcept;
+
+        void add(const uint64_t hash, const uint32_t index) noexcept;
+        void remove(const uint64_t hash, const uint32_t index) noexcept;
+
+        /// @brief returns the first index in the chain of the hash or NO_INDEX
+        uint32_t first(const uint64_t hash) const noexcept;
+        /// @brief returns the next index in the chain or NO_INDEX
+        uint32_t next(const uint32_t index) const noexcept;
+
+      private:
+        static constexpr uint32_t NUMBER_OF_BUCKETS = CAPACITY;
+
+        uint32_t m_buckets[NUMBER_OF_BUCKETS];
+        uint32_t m_next[CAPACITY];
+    };
+
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
-    uint32_t m_freeIndex{NO_INDEX};
+    /// @brief the hash index of a key is at position key - 1
+    HashIndex m_indices[NUMBER_OF_KEYS];
+
+    /// @brief the slots of removed entries which are reused by the next insertions
+    cxx::vector<uint32_t, CAPACITY> m_freeIndices;
+
+    uint64_t m_generation{0U};
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
+    void addToIndices(const uint32_t index) noexcept;
+    void release(const uint32_t index) noexcept;
+
+    static uint64_t hashOf(const uint8_t key,
+                           const capro::IdString_t* const service,
+                           const capro::IdString_t* const instance,
+                           const capro::IdString_t* const event) noexcept;
+    static uint64_t hashOf(const uint8_t key, const capro::ServiceDescription& serviceDescription) noexcept;
 
     cxx::expected<Error> add(const capro::ServiceDescription& serviceDescription,
                              ReferenceCounter_t ServiceDescriptionEntry::*count);
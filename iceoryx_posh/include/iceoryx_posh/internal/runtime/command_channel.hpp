@@ -0,0 +1,155 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_COMMAND_CHANNEL_HPP
+#define IOX_POSH_RUNTIME_COMMAND_CHANNEL_HPP
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
+#include "iceoryx_hoofs/posix_wrapper/binary_semaphore.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+enum class CommandChannelError : uint8_t
+{
+    /// @brief the channel is not assigned to a runtime
+    CHANNEL_CLOSED,
+    /// @brief another request of the runtime is in flight
+    CHANNEL_BUSY,
+    /// @brief the request is not a valid IpcMessage
+    INVALID_MESSAGE,
+    /// @brief the request does not fit into the channel
+    MESSAGE_TOO_LARGE,
+    /// @brief the request could not be handed over to RouDi
+    SUBMISSION_FAILED
+};
+
+/// @brief A lock-free queue in the management segment with the indices of the command channels which contain a
+///        pending request. The runtimes push the index of their channel and wake up RouDi with a futex based
+///        semaphore, the runtime messages threads of RouDi pop the indices.
+class CommandChannelQueue
+{
+  public:
+    /// @brief every runtime has at most one request in flight
+    static constexpr uint64_t CAPACITY{MAX_PROCESS_NUMBER};
+
+    CommandChannelQueue() noexcept;
+
+    CommandChannelQueue(const CommandChannelQueue&) = delete;
+    CommandChannelQueue(CommandChannelQueue&&) = delete;
+    CommandChannelQueue& operator=(const CommandChannelQueue&) = delete;
+    CommandChannelQueue& operator=(CommandChannelQueue&&) = delete;
+    ~CommandChannelQueue() noexcept = default;
+
+    /// @brief Adds the index of a command channel with a pending request and wakes up RouDi
+    /// @param[in] index of the command channel
+    /// @return true if the index was added, false if the queue is full
+    /// @note threadsafe, lockfree
+    bool push(const uint32_t index) noexcept;
+
+    /// @brief Removes the oldest index, when the queue is empty it waits until an index is pushed or the timeout
+    ///        has passed
+    /// @param[in] timeout the maximum time to wait for an index
+    /// @return the index or cxx::nullopt when no index was pushed within the timeout
+    /// @note threadsafe
+    cxx::optional<uint32_t> timedPop(const units::Duration& timeout) noexcept;
+
+  private:
+    concurrent::LockFreeQueue<uint32_t, CAPACITY> m_queue;
+    cxx::optional<posix::BinarySemaphore> m_wakeUpSemaphore;
+};
+
+/// @brief The request and response channel between one runtime and RouDi in the management segment. After the
+///        registration via the IPC channel the runtime writes its requests into the channel and submits it to the
+///        CommandChannelQueue, RouDi writes the response into the channel and wakes up the runtime with a futex
+///        based semaphore. Since a runtime has at most one request in flight the channel has a single slot for the
+///        request and one for the response which carry the same IpcMessages as the IPC channel.
+class CommandChannel
+{
+  public:
+    CommandChannel() noexcept;
+
+    CommandChannel(const CommandChannel&) = delete;
+    CommandChannel(CommandChannel&&) = delete;
+    CommandChannel& operator=(const CommandChannel&) = delete;
+    CommandChannel& operator=(CommandChannel&&) = delete;
+    ~CommandChannel() noexcept = default;
+
+    /// @brief Assigns the channel to a runtime, called by RouDi with the registration
+    /// @param[in] runtimeName of the runtime which owns the channel
+    /// @param[in] queue to which the runtime submits its requests
+    /// @param[in] index of the channel which identifies it in the queue
+    void open(const RuntimeName_t& runtimeName, CommandChannelQueue& queue, const uint32_t index) noexcept;
+
+    /// @brief Releases the channel from its runtime, called by RouDi when the runtime is removed
+    void close() noexcept;
+
+    /// @brief returns true if the channel is assigned to a runtime
+    bool isOpen() const noexcept;
+
+    /// @brief returns the name of the runtime which owns the channel
+    RuntimeName_t runtimeName() const noexcept;
+
+    /// @brief Sends a request to RouDi and blocks until RouDi responded, called by the runtime
+    /// @param[in] request to RouDi
+    /// @param[out] response from RouDi, an empty message when RouDi did not respond to the request
+    /// @return an error when the request was not sent, the runtime can fall back to the IPC channel then
+    cxx::expected<CommandChannelError> sendRequest(const IpcMessage& request, IpcMessage& response) noexcept;
+
+    /// @brief Takes the pending request, called by RouDi after the index was popped from the CommandChannelQueue
+    /// @param[out] request which was sent by the runtime
+    /// @return true if a request was pending, false otherwise
+    bool takeRequest(IpcMessage& request) noexcept;
+
+    /// @brief Sends the response to the request which was taken and wakes up the runtime, called by RouDi
+    /// @param[in] response to the request
+    /// @return true if a taken request was answered, false if no request is processed or it was already answered
+    bool sendResponse(const IpcMessage& response) noexcept;
+
+  private:
+    using Request_t = cxx::string<ROUDI_MESSAGE_SIZE>;
+    using Response_t = cxx::string<APP_MESSAGE_SIZE>;
+
+    static constexpr uint32_t STATE_IDLE{0U};
+    static constexpr uint32_t STATE_WRITING_REQUEST{1U};
+    static constexpr uint32_t STATE_REQUEST_PENDING{2U};
+    static constexpr uint32_t STATE_PROCESSING{3U};
+    static constexpr uint32_t STATE_WRITING_RESPONSE{4U};
+    static constexpr uint32_t STATE_RESPONSE_READY{5U};
+
+    std::atomic<uint32_t> m_state{STATE_IDLE};
+    std::atomic_bool m_isOpen{false};
+    RuntimeName_t m_runtimeName;
+    memory::RelativePointer<CommandChannelQueue> m_queue;
+    uint32_t m_index{0U};
+    Request_t m_request;
+    Response_t m_response;
+    cxx::optional<posix::BinarySemaphore> m_responseSemaphore;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_COMMAND_CHANNEL_HPP
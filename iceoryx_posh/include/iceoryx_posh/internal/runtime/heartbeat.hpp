@@ -0,0 +1,55 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_HEARTBEAT_HPP
+#define IOX_POSH_RUNTIME_HEARTBEAT_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Liveliness counter of a runtime which resides in the management segment. The runtime increments the
+/// counter periodically and RouDi considers the runtime alive as long as the counter changes.
+class Heartbeat
+{
+  public:
+    /// @brief constructor
+    /// @param[in] runtimeName name of the runtime which owns the heartbeat
+    explicit Heartbeat(const RuntimeName_t& runtimeName) noexcept;
+
+    Heartbeat(const Heartbeat&) = delete;
+    Heartbeat(Heartbeat&&) = delete;
+    Heartbeat& operator=(const Heartbeat&) = delete;
+    Heartbeat& operator=(Heartbeat&&) = delete;
+
+    /// @brief signals that the runtime is still alive
+    void beat() noexcept;
+
+    /// @brief returns the number of beats since the creation of the heartbeat
+    uint64_t counter() const noexcept;
+
+    RuntimeName_t m_runtimeName;
+
+  private:
+    std::atomic<uint64_t> m_counter{0U};
+};
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_HEARTBEAT_HPP
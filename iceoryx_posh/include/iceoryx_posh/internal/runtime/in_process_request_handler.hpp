@@ -0,0 +1,63 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IN_PROCESS_REQUEST_HANDLER_HPP
+#define IOX_POSH_RUNTIME_IN_PROCESS_REQUEST_HANDLER_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_port_request.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Interface of a RouDi which runs in the same process like the runtime. The runtime hands its requests
+/// directly to RouDi which processes them in the thread of the caller, neither the IPC channels nor the command
+/// channels nor the runtime messages threads of RouDi are involved.
+class InProcessRequestHandler
+{
+  public:
+    virtual ~InProcessRequestHandler() noexcept = default;
+
+    InProcessRequestHandler(const InProcessRequestHandler&) = delete;
+    InProcessRequestHandler(InProcessRequestHandler&&) = delete;
+    InProcessRequestHandler& operator=(const InProcessRequestHandler&) = delete;
+    InProcessRequestHandler& operator=(InProcessRequestHandler&&) = delete;
+
+    /// @brief Processes a request like the registration or the termination of a runtime
+    /// @param[in] request to RouDi
+    /// @param[out] response of RouDi
+    /// @return true if RouDi responded to the request, false otherwise
+    /// @note threadsafe
+    virtual bool processRequest(const IpcMessage& request, IpcMessage& response) noexcept = 0;
+
+    /// @brief Creates a port or another resource for a runtime without serializing the request, the new port is
+    /// already connected to the matching ports when the call returns
+    /// @param[in] runtimeName of the registered runtime which requests the resource
+    /// @param[in] request describes the resource
+    /// @return the ACK with the location of the resource in the management segment or an ERROR
+    /// @note threadsafe
+    virtual IpcPortResponse processPortRequest(const RuntimeName_t& runtimeName,
+                                               const IpcPortRequest& request) noexcept = 0;
+
+  protected:
+    InProcessRequestHandler() noexcept = default;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IN_PROCESS_REQUEST_HANDLER_HPP
@@ -0,0 +1,131 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_FRAME_HPP
+#define IOX_POSH_RUNTIME_IPC_BINARY_FRAME_HPP
+
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Version of the binary protocol between the runtimes and RouDi. It is negotiated with the registration,
+///        a value of 0 means that only the string based IpcMessage protocol is used.
+constexpr uint16_t IPC_BINARY_PROTOCOL_VERSION{1U};
+
+/// @brief A binary frame with a fixed layout which is exchanged between the runtimes and RouDi without any
+///        allocation or string conversion. The values are written and read in the same order with the stream
+///        operators, integers and enums are stored with their native size and byte order since both sides
+///        run on the same machine and strings are stored with a length prefix.
+///
+///        The IPC channels transport null terminated strings, therefore the frame is encoded with the
+///        Consistent Overhead Byte Stuffing (COBS) which removes all zero bytes with an overhead of one byte
+///        per 254 bytes. The encoded frame starts with IpcMessage::BINARY_FRAME_MARKER and is carried by an
+///        IpcMessage so that RouDi can distinguish it from the string messages.
+class IpcBinaryFrame
+{
+  public:
+    /// @brief the frame, its COBS overhead and the marker fit into the messages of RouDi and of the runtimes
+    static constexpr uint64_t CAPACITY{algorithm::minVal(ROUDI_MESSAGE_SIZE, APP_MESSAGE_SIZE) - 8U};
+
+    IpcBinaryFrame() noexcept = default;
+
+    /// @brief Appends an integral or enum value to the frame. If the value does not fit into the frame, nothing
+    ///        is appended and the frame becomes invalid.
+    /// @tparam T integral or enum type
+    /// @param[in] value to append
+    /// @return reference to the frame
+    template <typename T>
+    IpcBinaryFrame& operator<<(const T& value) noexcept;
+
+    /// @brief Appends a string with a length prefix to the frame. If the string does not fit into the frame,
+    ///        nothing is appended and the frame becomes invalid.
+    /// @param[in] value to append
+    /// @return reference to the frame
+    template <uint64_t Capacity>
+    IpcBinaryFrame& operator<<(const cxx::string<Capacity>& value) noexcept;
+
+    /// @brief Reads the next integral or enum value. If the frame does not contain enough data, the value is not
+    ///        changed and the frame becomes invalid.
+    /// @tparam T integral or enum type
+    /// @param[out] value which is read
+    /// @return reference to the frame
+    template <typename T>
+    IpcBinaryFrame& operator>>(T& value) noexcept;
+
+    /// @brief Reads the next bool. If the frame does not contain enough data or the value is neither 0 nor 1, the
+    ///        value is not changed and the frame becomes invalid.
+    /// @param[out] value which is read
+    /// @return reference to the frame
+    IpcBinaryFrame& operator>>(bool& value) noexcept;
+
+    /// @brief Reads the next string. If the frame does not contain enough data or the string exceeds the capacity,
+    ///        the value is not changed and the frame becomes invalid.
+    /// @param[out] value which is read
+    /// @return reference to the frame
+    template <uint64_t Capacity>
+    IpcBinaryFrame& operator>>(cxx::string<Capacity>& value) noexcept;
+
+    /// @brief check if all previous writes and reads were successful
+    /// @return true if the frame is valid, otherwise false
+    bool isValid() const noexcept;
+
+    /// @brief marks the frame as invalid, e.g. when a value which was read is out of range
+    void invalidate() noexcept;
+
+    /// @brief returns the number of bytes which were written to the frame
+    /// @return the size of the frame in bytes
+    uint64_t size() const noexcept;
+
+    /// @brief removes the content of the frame and makes it valid again
+    void clear() noexcept;
+
+    /// @brief Encodes the frame into a message which can be sent over an IPC channel
+    /// @param[out] message which contains the encoded frame afterwards
+    /// @return true if the frame is valid and was encoded, otherwise false
+    bool encode(IpcMessage& message) const noexcept;
+
+    /// @brief Replaces the content of the frame with the frame encoded in the message, the next read starts at
+    ///        the beginning of the frame
+    /// @param[in] message which contains the encoded frame
+    /// @return true if the message contains a correctly encoded frame, otherwise false and the frame is invalid
+    bool decode(const IpcMessage& message) noexcept;
+
+  private:
+    bool write(const void* const data, const uint64_t size) noexcept;
+    bool read(void* const data, const uint64_t size) noexcept;
+
+  private:
+    std::array<uint8_t, CAPACITY> m_data;
+    uint64_t m_size{0U};
+    uint64_t m_readPosition{0U};
+    bool m_isValid{true};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_frame.inl"
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_FRAME_HPP
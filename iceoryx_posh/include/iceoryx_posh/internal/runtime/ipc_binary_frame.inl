@@ -0,0 +1,80 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_FRAME_INL
+#define IOX_POSH_RUNTIME_IPC_BINARY_FRAME_INL
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_frame.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+template <typename T>
+inline IpcBinaryFrame& IpcBinaryFrame::operator<<(const T& value) noexcept
+{
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                  "Only integral and enum types can be written to the binary frame");
+    write(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryFrame& IpcBinaryFrame::operator<<(const cxx::string<Capacity>& value) noexcept
+{
+    static_assert(Capacity <= std::numeric_limits<uint16_t>::max(), "The string length must fit into the prefix");
+    const auto length = static_cast<uint16_t>(value.size());
+    if (m_isValid && m_size + sizeof(length) + length > CAPACITY)
+    {
+        m_isValid = false;
+    }
+    write(&length, sizeof(length));
+    write(value.c_str(), length);
+    return *this;
+}
+
+template <typename T>
+inline IpcBinaryFrame& IpcBinaryFrame::operator>>(T& value) noexcept
+{
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                  "Only integral and enum types can be read from the binary frame");
+    read(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryFrame& IpcBinaryFrame::operator>>(cxx::string<Capacity>& value) noexcept
+{
+    uint16_t length{0U};
+    if (!read(&length, sizeof(length)))
+    {
+        return *this;
+    }
+    if (length > Capacity || m_readPosition + length > m_size)
+    {
+        m_isValid = false;
+        return *this;
+    }
+    value = cxx::string<Capacity>(cxx::TruncateToCapacity,
+                                  reinterpret_cast<const char*>(&m_data[m_readPosition]),
+                                  static_cast<uint64_t>(length));
+    m_readPosition += length;
+    return *this;
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_FRAME_INL
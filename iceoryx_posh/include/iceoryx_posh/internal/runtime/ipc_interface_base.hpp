@@ -117,6 +117,10 @@ enum class IpcMessageErrorType : int32_t
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
     NODE_DATA_LIST_FULL,
+    REQUEST_INTERFACE_INVALID_RESPONSE,
+    REQUEST_INTERFACE_WRONG_IPC_MESSAGE_RESPONSE,
+    REQUEST_NODE_INVALID_RESPONSE,
+    REQUEST_NODE_WRONG_IPC_MESSAGE_RESPONSE,
     END,
 };
 
@@ -39,9 +39,15 @@ namespace runtime
 ///    separator. A message is defined as valid if all entries contained in
 ///    that message are valid and it ends with the separator or it is empty,
 ///    otherwise it is defined as invalid.
+///
+///    A message which starts with the BINARY_FRAME_MARKER contains an encoded
+///    IpcBinaryFrame instead of entries, it is always valid and has no entries.
 class IpcMessage
 {
   public:
+    /// @brief the first character of a message which contains an encoded IpcBinaryFrame
+    static constexpr char BINARY_FRAME_MARKER{'#'};
+
     /// @brief Creates an empty and valid IPC channel message.
     IpcMessage() noexcept = default;
 
@@ -84,6 +90,11 @@ class IpcMessage
     ///      true = if it is a valid entry otherwise false
     bool isValidEntry(const std::string& entry) const noexcept;
 
+    /// @brief returns if a null terminated entry is valid without copying it into a std::string
+    /// @param[in] entry null terminated string to check
+    /// @return true if it is a valid entry otherwise false
+    bool isValidEntry(const char* const entry) const noexcept;
+
     /// @brief check if the message is valid
     /// @return  If one element in the CTor initializer_list was invalid it returns false, otherwise true.
     bool isValid() const noexcept;
@@ -114,11 +125,17 @@ class IpcMessage
     template <typename T>
     void addEntry(const T& entry) noexcept;
 
+    /// @brief check if the message contains an encoded IpcBinaryFrame
+    /// @return true if the message starts with the BINARY_FRAME_MARKER, otherwise false
+    bool isBinaryFrame() const noexcept;
+
     /// @brief Compares two IpcMessages to be equal
     /// @param rhs IpcMessage to compare with
     bool operator==(const IpcMessage& rhs) const noexcept;
 
   private:
+    friend class IpcBinaryFrame;
+
     static const char m_separator; // default value is ,
     std::string m_msg;
     bool m_isValid{true};
@@ -0,0 +1,103 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_PORT_REQUEST_HPP
+#define IOX_POSH_RUNTIME_IPC_PORT_REQUEST_HPP
+
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_frame.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief A request of a runtime to create a port or another resource in the shared memory management segment.
+///        Only the members which belong to the type of the request are transferred.
+///
+///        The requests are sent to RouDi in an IpcBinaryFrame which starts with the IPC_BINARY_PROTOCOL_VERSION,
+///        the RuntimeName_t of the runtime and the number of requests as uint16_t followed by the requests.
+///        RouDi answers with one IpcBinaryFrame which contains the IPC_BINARY_PROTOCOL_VERSION, the number of
+///        responses as uint16_t and an IpcPortResponse for every request in the same order.
+struct IpcPortRequest
+{
+    /// @brief CREATE_PUBLISHER, CREATE_SUBSCRIBER, CREATE_CLIENT, CREATE_SERVER, CREATE_INTERFACE,
+    ///        CREATE_CONDITION_VARIABLE or CREATE_NODE
+    IpcMessageType type{IpcMessageType::NOTYPE};
+    capro::ServiceDescription service;
+    popo::PublisherOptions publisherOptions;
+    popo::SubscriberOptions subscriberOptions;
+    popo::ClientOptions clientOptions;
+    popo::ServerOptions serverOptions;
+    PortConfigInfo portConfigInfo;
+    capro::Interfaces interface{capro::Interfaces::INTERNAL};
+    NodeName_t nodeName;
+    uint64_t nodeDeviceIdentifier{0U};
+};
+
+/// @brief The response of RouDi to an IpcPortRequest, the type is either the ACK of the request or ERROR
+struct IpcPortResponse
+{
+    IpcMessageType type{IpcMessageType::NOTYPE};
+    IpcMessageErrorType error{IpcMessageErrorType::NOTYPE};
+    memory::UntypedRelativePointer::offset_t offset{0U};
+    uint64_t segmentId{0U};
+};
+
+/// @brief The maximum number of requests in one frame, limited by the responses which RouDi sends back in one frame
+constexpr uint16_t MAX_PORT_REQUESTS_PER_FRAME{
+    static_cast<uint16_t>((IpcBinaryFrame::CAPACITY - sizeof(IPC_BINARY_PROTOCOL_VERSION) - sizeof(uint16_t))
+                          / (sizeof(IpcMessageType) + sizeof(IpcMessageErrorType)
+                             + sizeof(memory::UntypedRelativePointer::offset_t) + sizeof(uint64_t)))};
+
+/// @brief returns the ACK which RouDi sends for a successful request
+/// @param[in] requestType the type of the request
+/// @return the type of the ACK or NOTYPE if the request type does not create a resource
+IpcMessageType getAckForPortRequest(const IpcMessageType requestType) noexcept;
+
+/// @brief checks that the strings of the request are valid IpcMessage entries. The runtime rejects the other requests
+///        independent of the negotiated protocol so that the behavior does not depend on the version of RouDi.
+/// @param[in] request to check
+/// @return true if all strings of the request can be transferred with the string based protocol, otherwise false
+bool hasValidIpcMessageEntries(const IpcPortRequest& request) noexcept;
+
+/// @brief checks if two requests would create the same resource, only the members which belong to the type of the
+///        requests are compared
+/// @param[in] lhs the first request
+/// @param[in] rhs the second request
+/// @return true if both requests have the same type and the same members for this type, otherwise false
+bool isSamePortRequest(const IpcPortRequest& lhs, const IpcPortRequest& rhs) noexcept;
+
+IpcBinaryFrame& operator<<(IpcBinaryFrame& frame, const capro::ServiceDescription& service) noexcept;
+IpcBinaryFrame& operator>>(IpcBinaryFrame& frame, capro::ServiceDescription& service) noexcept;
+
+IpcBinaryFrame& operator<<(IpcBinaryFrame& frame, const IpcPortRequest& request) noexcept;
+/// @note the frame becomes invalid when the request contains a type or an enum value which is out of range
+IpcBinaryFrame& operator>>(IpcBinaryFrame& frame, IpcPortRequest& request) noexcept;
+
+IpcBinaryFrame& operator<<(IpcBinaryFrame& frame, const IpcPortResponse& response) noexcept;
+IpcBinaryFrame& operator>>(IpcBinaryFrame& frame, IpcPortResponse& response) noexcept;
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_PORT_REQUEST_HPP
@@ -19,6 +19,9 @@
 #define IOX_POSH_RUNTIME_IPC_RUNTIME_INTERFACE_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/runtime/command_channel.hpp"
+#include "iceoryx_posh/internal/runtime/in_process_request_handler.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_frame.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 
@@ -33,9 +36,12 @@ class IpcRuntimeInterface
     /// @param[in] roudiName name of the RouDi IPC channel
     /// @param[in] runtimeName name of the application's runtime and its IPC channel
     /// @param[in] roudiWaitingTimeout timeout for searching the RouDi IPC channel
+    /// @param[in] inProcessRequestHandler of a RouDi in the same process, if set the runtime registers at it and sends
+    /// all requests to it without creating any IPC channel
     IpcRuntimeInterface(const RuntimeName_t& roudiName,
                         const RuntimeName_t& runtimeName,
-                        const units::Duration roudiWaitingTimeout) noexcept;
+                        const units::Duration roudiWaitingTimeout,
+                        InProcessRequestHandler* const inProcessRequestHandler = nullptr) noexcept;
     ~IpcRuntimeInterface() noexcept = default;
 
     /// @brief Not needed therefore deleted
@@ -48,12 +54,48 @@ class IpcRuntimeInterface
     /// @return true if sending was successful, false if not
     bool sendKeepalive() noexcept;
 
-    /// @brief send a request to the RouDi daemon
+    /// @brief send a request to the RouDi daemon, via the command channel if one is attached and otherwise via the
+    /// IPC channel
     /// @param[in] msg request to RouDi
     /// @param[out] answer response from RouDi
     /// @return true if communication was successful, false if not
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept;
 
+    /// @brief send a binary request to the RouDi daemon, requires a negotiated binary protocol
+    /// @param[in] request binary frame with the request to RouDi
+    /// @param[out] answer binary frame with the response from RouDi
+    /// @return true if communication was successful and the response is a binary frame, false if not
+    bool sendRequestToRouDi(const IpcBinaryFrame& request, IpcBinaryFrame& answer) noexcept;
+
+    /// @brief send a port request to a RouDi in the same process which processes it without serialization
+    /// @param[in] request describes the resource
+    /// @param[out] response from RouDi
+    /// @return true if the request was processed, false if the runtime does not run in the same process like RouDi
+    bool sendRequestToRouDi(const IpcPortRequest& request, IpcPortResponse& response) noexcept;
+
+    /// @brief returns true if the requests are processed by a RouDi in the same process instead of the IPC channel
+    bool isInProcess() const noexcept;
+
+    /// @brief get the version of the binary protocol which was negotiated with RouDi during the registration
+    /// @return the protocol version or 0 if RouDi supports only the string based IpcMessage protocol
+    uint16_t getBinaryProtocolVersion() const noexcept;
+
+    /// @brief get the adress offset of the heartbeat in the management segment
+    /// @return the address offset or a cxx::nullopt if the runtime has to send KEEPALIVE messages instead
+    cxx::optional<memory::UntypedRelativePointer::offset_t> getHeartbeatAddressOffset() const noexcept;
+
+    /// @brief get the adress offset of the command channel in the management segment
+    /// @return the address offset or a cxx::nullopt if RouDi did not assign a command channel to the runtime
+    cxx::optional<memory::UntypedRelativePointer::offset_t> getCommandChannelAddressOffset() const noexcept;
+
+    /// @brief Attaches the command channel which RouDi assigned to the runtime, the following requests are sent via
+    /// the command channel instead of the IPC channel
+    /// @param[in] commandChannel in the management segment which must be mapped by the runtime, a nullptr detaches
+    /// the command channel
+    /// @note RouDi releases the command channel with the TERMINATION request, therefore the runtime must detach the
+    /// command channel before it sends it
+    void attachCommandChannel(CommandChannel* const commandChannel) noexcept;
+
     /// @brief get the adress offset of the segment manager
     /// @return address offset as memory::RelativePointer::offset_t
     memory::UntypedRelativePointer::offset_t getSegmentManagerAddressOffset() const noexcept;
@@ -77,14 +119,36 @@ class IpcRuntimeInterface
 
     RegAckResult waitForRegAck(const int64_t transmissionTimestamp) noexcept;
 
+    /// @brief creates a unique timestamp which identifies the REG_ACK to a REG request
+    int64_t createTransmissionTimestamp(const int64_t previousTimestamp) const noexcept;
+
+    /// @brief creates the REG request, a runtime in the same process like RouDi does not negotiate the binary protocol
+    /// since it sends its port requests without serialization
+    IpcMessage createRegisterRequest(const int64_t transmissionTimestamp) const noexcept;
+
+    /// @brief reads the parameters of a REG_ACK
+    /// @return true if the message is the REG_ACK to the REG request with the transmission timestamp, false otherwise
+    bool readRegAck(const IpcMessage& message, const int64_t transmissionTimestamp) noexcept;
+
+    /// @brief registers the runtime at the RouDi in the same process
+    void registerInProcess() noexcept;
+
   private:
     RuntimeName_t m_runtimeName;
+    InProcessRequestHandler* m_inProcessRequestHandler{nullptr};
     cxx::optional<memory::UntypedRelativePointer::offset_t> m_segmentManagerAddressOffset;
     cxx::optional<IpcInterfaceCreator> m_AppIpcInterface;
-    IpcInterfaceUser m_RoudiIpcInterface;
+    cxx::optional<IpcInterfaceUser> m_RoudiIpcInterface;
     uint64_t m_shmTopicSize{0U};
     uint64_t m_segmentId{0U};
     bool m_sendKeepalive = true;
+    uint16_t m_binaryProtocolVersion{0U};
+    cxx::optional<memory::UntypedRelativePointer::offset_t> m_heartbeatAddressOffset;
+    cxx::optional<memory::UntypedRelativePointer::offset_t> m_commandChannelAddressOffset;
+    CommandChannel* m_commandChannel{nullptr};
+    // the binary requests reuse the buffers of the messages so that they do not allocate memory
+    IpcMessage m_binaryRequestMessage;
+    IpcMessage m_binaryResponseMessage;
 };
 
 } // namespace runtime
@@ -0,0 +1,41 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_PORT_CREATION_BATCH_INL
+#define IOX_POSH_RUNTIME_PORT_CREATION_BATCH_INL
+
+#include "iceoryx_posh/runtime/port_creation_batch.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+template <uint64_t Capacity>
+inline PortCreationBatch<Capacity>::PortCreationBatch() noexcept
+    : PortCreationBatchBase(Capacity)
+{
+    setEntries(m_entryStorage.data());
+}
+
+template <uint64_t Capacity>
+inline PortCreationBatch<Capacity>::~PortCreationBatch() noexcept
+{
+    release();
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_CREATION_BATCH_INL
@@ -18,8 +18,11 @@
 #define IOX_POSH_RUNTIME_POSH_RUNTIME_IMPL_HPP
 
 #include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_port_request.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -77,6 +80,9 @@ class PoshRuntimeImpl : public PoshRuntime
     /// @copydoc PoshRuntime::createNode
     NodeData* createNode(const NodeProperty& nodeProperty) noexcept override;
 
+    /// @copydoc PoshRuntime::createPorts
+    uint64_t createPorts(PortCreationBatchBase& batch) noexcept override;
+
     /// @copydoc PoshRuntime::sendRequestToRouDi
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept override;
 
@@ -85,29 +91,85 @@ class PoshRuntimeImpl : public PoshRuntime
     friend class roudi::RuntimeTestInterface;
 
     // Protected constructor for IPC setup
+    /// @param[in] name of the runtime
+    /// @param[in] location of the runtime relative to RouDi
+    /// @param[in] inProcessRequestHandler of a RouDi in the same process which processes the requests of the runtime
+    /// synchronously without IPC, requires RuntimeLocation::SAME_PROCESS_LIKE_ROUDI
     PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name,
-                    const RuntimeLocation location = RuntimeLocation::SEPARATE_PROCESS_FROM_ROUDI) noexcept;
-
-  private:
-    cxx::expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
-
-    cxx::expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
+                    const RuntimeLocation location = RuntimeLocation::SEPARATE_PROCESS_FROM_ROUDI,
+                    InProcessRequestHandler* const inProcessRequestHandler = nullptr) noexcept;
 
-    cxx::expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-    requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    /// @copydoc PoshRuntime::releasePorts
+    void releasePorts(PortCreationBatchBase& batch) noexcept override;
 
-    cxx::expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-    requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept;
-
-    cxx::expected<popo::ConditionVariableData*, IpcMessageErrorType>
-    requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
+  private:
+    /// @brief the maximum number of batches whose ports are reserved at the same time
+    static constexpr uint64_t MAX_PORT_CREATION_BATCHES{16U};
+
+    /// @brief creates the request for a publisher and limits the options to the supported values
+    IpcPortRequest createPublisherRequest(const capro::ServiceDescription& service,
+                                          const popo::PublisherOptions& publisherOptions,
+                                          const PortConfigInfo& portConfigInfo) const noexcept;
+
+    /// @brief creates the request for a subscriber and limits the options to the supported values
+    IpcPortRequest createSubscriberRequest(const capro::ServiceDescription& service,
+                                           const popo::SubscriberOptions& subscriberOptions,
+                                           const PortConfigInfo& portConfigInfo) const noexcept;
+
+    /// @brief creates the request for a client and limits the options to the supported values
+    IpcPortRequest createClientRequest(const capro::ServiceDescription& service,
+                                       const popo::ClientOptions& clientOptions,
+                                       const PortConfigInfo& portConfigInfo) const noexcept;
+
+    /// @brief creates the request for a server and limits the options to the supported values
+    IpcPortRequest createServerRequest(const capro::ServiceDescription& service,
+                                       const popo::ServerOptions& serverOptions,
+                                       const PortConfigInfo& portConfigInfo) const noexcept;
+
+    /// @brief Requests a port or another resource from RouDi, with the binary protocol if RouDi supports it
+    /// @param[in] request describes the resource
+    /// @param[in] invalidResponseError is returned when the communication with RouDi failed
+    /// @param[in] wrongResponseError is returned when RouDi sent an unexpected response
+    /// @return pointer to the resource in the shared memory or the error
+    /// @note a port which was reserved by a PortCreationBatch for the same request is returned without a request to
+    ///       RouDi
+    cxx::expected<void*, IpcMessageErrorType>
+    requestPortFromRoudi(const IpcPortRequest& request,
+                         const IpcMessageErrorType invalidResponseError,
+                         const IpcMessageErrorType wrongResponseError) noexcept;
+
+    /// @brief sends a single request to RouDi, with the binary protocol if RouDi supports it
+    cxx::expected<void*, IpcMessageErrorType>
+    sendPortRequestToRoudi(const IpcPortRequest& request,
+                           const IpcMessageErrorType invalidResponseError,
+                           const IpcMessageErrorType wrongResponseError) noexcept;
+
+    /// @brief returns the resource of a response of RouDi or the error of the response
+    cxx::expected<void*, IpcMessageErrorType>
+    getPortFromResponse(const IpcPortRequest& request,
+                        const IpcPortResponse& response,
+                        const IpcMessageErrorType wrongResponseError) const noexcept;
+
+    /// @brief sends the requests of the batch in as few binary frames as possible to RouDi
+    /// @return the number of ports which were created
+    uint64_t sendPortRequestsToRoudi(PortCreationBatchBase& batch) noexcept;
+
+    /// @brief takes a port which was reserved by a PortCreationBatch for the same request
+    cxx::optional<void*> takeReservedPort(const IpcPortRequest& request) noexcept;
+
+    /// @brief creates the string based IpcMessage for a request to a RouDi without the binary protocol
+    IpcMessage createPortRequestMessage(const IpcPortRequest& request) const noexcept;
 
     mutable posix::mutex m_appIpcRequestMutex{false};
 
+    /// @brief protects the batches and their entries, it is never held during a request to RouDi
+    posix::mutex m_portCreationBatchMutex{false};
+    cxx::vector<PortCreationBatchBase*, MAX_PORT_CREATION_BATCHES> m_portCreationBatches;
+
     IpcRuntimeInterface m_ipcChannelInterface;
     cxx::optional<SharedMemoryUser> m_ShmInterface;
+    /// @brief the heartbeat in the management segment or a nullptr if RouDi expects KEEPALIVE messages
+    Heartbeat* m_heartbeat{nullptr};
 
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
@@ -18,13 +18,18 @@
 #define IOX_POSH_POPO_LISTENER_HPP
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
 #include "iceoryx_hoofs/cxx/function.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/listener_options.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
+#include "iceoryx_posh/popo/notification_priority.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -103,6 +108,14 @@ class ListenerImpl
 {
   public:
     ListenerImpl() noexcept;
+
+    /// @brief creates a Listener which waits for events as defined in the provided options
+    /// @param[in] waitOptions defines if and how long the Listener polls for events before it blocks
+    explicit ListenerImpl(const WaitOptions& waitOptions) noexcept;
+
+    /// @brief creates a Listener which is configured as defined in the provided options
+    /// @param[in] options defines how the Listener waits for events and by which threads the callbacks are executed
+    explicit ListenerImpl(const ListenerOptions& options) noexcept;
     ListenerImpl(const ListenerImpl&) = delete;
     ListenerImpl(ListenerImpl&&) = delete;
     ~ListenerImpl() noexcept;
@@ -121,14 +134,18 @@ class ListenerImpl
     /// @param[in] eventType enum required to specify the type of event inside of eventOrigin
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority the callbacks of events with a higher priority are executed first when multiple events
+    /// occurred at the same time
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T,
               typename EventType,
               typename ContextDataType,
               typename = std::enable_if_t<std::is_enum<EventType>::value>>
-    cxx::expected<ListenerError> attachEvent(T& eventOrigin,
-                                             const EventType eventType,
-                                             const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+    cxx::expected<ListenerError>
+    attachEvent(T& eventOrigin,
+                const EventType eventType,
+                const NotificationCallback<T, ContextDataType>& eventCallback,
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief Attaches an event. Hereby the event is defined as a class T, the eventOrigin and
     ///        the corresponding callback which will be called when the event occurs.
@@ -139,10 +156,14 @@ class ListenerImpl
     /// @param[in] eventOrigin the object which will signal the event (the origin)
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. Has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority the callbacks of events with a higher priority are executed first when multiple events
+    /// occurred at the same time
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T, typename ContextDataType>
-    cxx::expected<ListenerError> attachEvent(T& eventOrigin,
-                                             const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+    cxx::expected<ListenerError>
+    attachEvent(T& eventOrigin,
+                const NotificationCallback<T, ContextDataType>& eventCallback,
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief Detaches an event. Hereby, the event is defined as a class T, the eventOrigin and
     ///        the eventType with further specifies the event inside of eventOrigin
@@ -165,24 +186,49 @@ class ListenerImpl
 
     /// @brief Returns the size of the Listener
     /// @return size of the Listener
+    /// @note When workers are used, a detached event whose callback is still queued or running is counted until the
+    ///       worker has finished with it
     uint64_t size() const noexcept;
 
   protected:
-    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData, const WaitOptions& waitOptions = {}) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData, const ListenerOptions& options) noexcept;
 
   private:
     class Event_t;
 
+    /// @brief the dispatch state of an event when the callbacks are executed by the workers
+    enum class DispatchState : uint8_t
+    {
+        IDLE,
+        QUEUED,
+        RUNNING,
+        RUNNING_AND_FIRED_AGAIN,
+        /// the event was detached while it was queued or running, the worker releases its index
+        DETACHED
+    };
+
     void threadLoop() noexcept;
+    void startWorkers(const ListenerOptions& options) noexcept;
+    void stopWorkers() noexcept;
+    void workerLoop() noexcept;
+    void dispatchToWorkers(const uint64_t eventId) noexcept;
+    void executeDispatchedEvent(const uint64_t eventId) noexcept;
+    void releaseDetachedEvent(const uint64_t eventId) noexcept;
     cxx::expected<uint32_t, ListenerError> addEvent(void* const origin,
                                                     void* const userType,
                                                     const uint64_t eventType,
                                                     const uint64_t eventTypeHash,
                                                     internal::GenericCallbackRef_t callback,
                                                     internal::TranslationCallbackRef_t translationCallback,
-                                                    const cxx::function<void(uint64_t)> invalidationCallback) noexcept;
+                                                    const cxx::function<void(uint64_t)> invalidationCallback,
+                                                    const NotificationPriority priority) noexcept;
 
+    TriggerHandle createTriggerHandle(const uint64_t index) noexcept;
     void removeTrigger(const uint64_t index) noexcept;
+    bool enableTimer(const uint64_t index,
+                     const units::Duration& period,
+                     const std::atomic<uint64_t>* activityCounter) noexcept;
 
   private:
     enum class NoEnumUsed : EventEnumIdentifier
@@ -213,6 +259,14 @@ class ListenerImpl
     std::atomic_bool m_wasDtorCalled{false};
     ConditionVariableData* m_conditionVariableData = nullptr;
     ConditionListener m_conditionListener;
+
+    uint64_t m_numberOfWorkers{0U};
+    std::atomic_bool m_stopWorkers{false};
+    std::atomic<DispatchState> m_dispatchStates[Capacity];
+    std::atomic<NotificationPriority> m_priorities[Capacity];
+    concurrent::LockFreeQueue<uint64_t, Capacity> m_dispatchQueue;
+    cxx::optional<posix::UnnamedSemaphore> m_workerSemaphore;
+    cxx::optional<posix::Thread> m_workers[MAX_NUMBER_OF_LISTENER_WORKERS];
 };
 
 class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
@@ -221,8 +275,17 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
     using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     Listener() noexcept;
 
+    /// @brief creates a Listener which waits for events as defined in the provided options
+    /// @param[in] waitOptions defines if and how long the Listener polls for events before it blocks
+    explicit Listener(const WaitOptions& waitOptions) noexcept;
+
+    /// @brief creates a Listener which is configured as defined in the provided options
+    /// @param[in] options defines how the Listener waits for events and by which threads the callbacks are executed
+    explicit Listener(const ListenerOptions& options) noexcept;
+
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const WaitOptions& waitOptions = {}) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options) noexcept;
 };
 
 } // namespace popo
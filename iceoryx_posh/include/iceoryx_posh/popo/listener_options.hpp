@@ -0,0 +1,63 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+#define IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/posix_wrapper/scheduler.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/wait_options.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Defines the scheduling settings of a single worker thread of the Listener
+struct ListenerWorkerOptions
+{
+    /// @brief the cpu cores the worker is allowed to run on, bit n represents core n, 0 means unrestricted
+    uint64_t cpuAffinityMask{0U};
+
+    /// @brief the scheduling policy of the worker, if not set the policy of the thread creating the Listener is used
+    cxx::optional<posix::Scheduler> scheduler;
+
+    /// @brief the priority of the worker for the scheduler, ignored when no scheduler is set
+    int32_t schedulerPriority{0};
+};
+
+/// @brief This struct is used to configure the Listener.
+///        Without workers the callbacks are executed serially in the background thread of the Listener which also
+///        waits for the events. With workers the background thread dispatches every fired event to a pool of worker
+///        threads so that a slow callback does not delay the callbacks of the other events. The callback of a single
+///        event is never executed concurrently, when the event fires again while its callback is running the callback
+///        is executed once more after the current invocation has finished.
+struct ListenerOptions
+{
+    /// @brief defines if and how long the Listener polls for events before it blocks
+    WaitOptions waitOptions;
+
+    /// @brief one entry per worker thread, if empty the callbacks are executed in the Listener thread
+    cxx::vector<ListenerWorkerOptions, MAX_NUMBER_OF_LISTENER_WORKERS> workers;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LISTENER_OPTIONS_HPP
@@ -0,0 +1,60 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_NOTIFICATION_PRIORITY_HPP
+#define IOX_POSH_POPO_NOTIFICATION_PRIORITY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The priority of an event or state attached to a WaitSet or Listener. Triggered notifications with a
+///        higher priority are returned by the WaitSet and executed by the Listener before the ones with a lower
+///        priority. Notifications with the same priority keep their order.
+using NotificationPriority = uint8_t;
+
+constexpr NotificationPriority DEFAULT_NOTIFICATION_PRIORITY{0U};
+
+namespace internal
+{
+/// @brief Sorts the elements stable by descending priority. An insertion sort is used since it does not require
+///        additional memory and the elements are already in order when all of them have the same priority.
+/// @param[in] elements container with random access which provides size() and operator[]
+/// @param[in] priorityOf callable which returns the NotificationPriority of an element
+template <typename Container, typename PriorityOf>
+inline void sortByDescendingPriority(Container& elements, const PriorityOf& priorityOf) noexcept
+{
+    for (uint64_t i = 1U; i < elements.size(); ++i)
+    {
+        auto element = elements[i];
+        const NotificationPriority priority = priorityOf(element);
+        uint64_t position = i;
+        while (position > 0U && priorityOf(elements[position - 1U]) < priority)
+        {
+            elements[position] = elements[position - 1U];
+            --position;
+        }
+        elements[position] = element;
+    }
+}
+} // namespace internal
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_NOTIFICATION_PRIORITY_HPP
@@ -48,6 +48,10 @@ struct PublisherOptions
     /// @brief deserialization of the PublisherOptions
     static cxx::expected<PublisherOptions, cxx::Serialization::Error>
     deserialize(const cxx::Serialization& serialized) noexcept;
+
+    /// @brief comparison operator
+    /// @param[in] rhs the right hand side of the comparison
+    bool operator==(const PublisherOptions& rhs) const noexcept;
 };
 
 } // namespace popo
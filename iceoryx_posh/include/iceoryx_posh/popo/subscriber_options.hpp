@@ -21,6 +21,7 @@
 #include "port_queue_policies.hpp"
 
 #include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 
 #include <cstdint>
 
@@ -51,11 +52,26 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The option whether the receiver queue shall provide a separate lane for every publisher to reduce the
+    ///        contention between multiple publishers
+    /// @attention The queueCapacity is distributed over the lanes, therefore a single publisher can only use its
+    ///            share of the queueCapacity. With a queueCapacity smaller than the number of lanes the publishers
+    ///            share the lanes. There is no order between samples of different publishers.
+    bool useShardedQueue{false};
+
+    /// @brief The period in which at least one sample is expected, when no sample arrived within a whole period the
+    ///        SubscriberEvent::DEADLINE_MISSED is triggered. Zero disables the deadline monitoring.
+    units::Duration deadline{units::Duration::zero()};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
     static cxx::expected<SubscriberOptions, cxx::Serialization::Error>
     deserialize(const cxx::Serialization& serialized) noexcept;
+
+    /// @brief comparison operator
+    /// @param[in] rhs the right hand side of the comparison
+    bool operator==(const SubscriberOptions& rhs) const noexcept;
 };
 
 } // namespace popo
@@ -0,0 +1,83 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_TIMER_TRIGGER_HPP
+#define IOX_POSH_POPO_TIMER_TRIGGER_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/popo/trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The TimerTrigger triggers the WaitSet or Listener it is attached to periodically. The period is handled by
+///        the thread which waits on the WaitSet or Listener, therefore no additional thread is required to multiplex
+///        periodic ticks with other events.
+/// @code
+///   iox::popo::TimerTrigger cyclicTrigger{iox::units::Duration::fromMilliseconds(100U)};
+///   waitset.attachEvent(cyclicTrigger);
+/// @endcode
+class TimerTrigger
+{
+  public:
+    /// @brief Creates a TimerTrigger
+    /// @param[in] period the period in which the TimerTrigger is triggered after it was attached, a period of zero
+    ///            never triggers
+    explicit TimerTrigger(const units::Duration period) noexcept;
+    TimerTrigger(const TimerTrigger& rhs) = delete;
+    TimerTrigger(TimerTrigger&& rhs) = delete;
+    TimerTrigger& operator=(const TimerTrigger& rhs) = delete;
+    TimerTrigger& operator=(TimerTrigger&& rhs) = delete;
+
+    /// @brief Changes the period, when attached the first period starts now
+    /// @param[in] period the new period, zero stops the TimerTrigger
+    /// @note not thread safe, must not be called concurrently with attach and detach
+    void setPeriod(const units::Duration period) noexcept;
+
+    /// @brief returns the period of the TimerTrigger
+    units::Duration getPeriod() const noexcept;
+
+    /// @brief Checks if the TimerTrigger was triggered
+    /// @return true if the TimerTrigger is triggered, otherwise false.
+    /// @note The hasTrigger state will be reset after it was handled by a WaitSet/Listener
+    bool hasTriggered() const noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief Only usable by the WaitSet, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger and
+    /// starts the timer.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    void disableEvent() noexcept;
+
+  private:
+    units::Duration m_period;
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_TRIGGER_HPP
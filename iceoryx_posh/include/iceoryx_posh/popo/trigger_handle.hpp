@@ -18,9 +18,11 @@
 #define IOX_POSH_POPO_TRIGGER_HANDLE_HPP
 
 #include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
@@ -36,6 +38,9 @@ namespace popo
 class TriggerHandle
 {
   public:
+    using EnableTimerCallback =
+        cxx::function<bool(uint64_t, const units::Duration&, const std::atomic<uint64_t>* activityCounter)>;
+
     /// @warning do not use =default here otherwise QNX will fail to compile!
     TriggerHandle() noexcept;
 
@@ -44,9 +49,12 @@ class TriggerHandle
     /// @param[in] resetCallback callback which will be called it goes out of scope or reset is called
     /// @param[in] uniqueTriggerId the unique trigger id of the Trigger which corresponds to the TriggerHandle. Usually
     /// stored in a Notifyable. It is required for the resetCallback
+    /// @param[in] enableTimerCallback callback which arms a timer for the trigger in the ConditionListener, it is
+    /// provided by the WaitSet and the Listener
     TriggerHandle(ConditionVariableData& conditionVariableData,
                   const cxx::function<void(uint64_t)>& resetCallback,
-                  const uint64_t uniqueTriggerId) noexcept;
+                  const uint64_t uniqueTriggerId,
+                  const EnableTimerCallback& enableTimerCallback = [](auto, auto&, auto) { return false; }) noexcept;
     TriggerHandle(const TriggerHandle&) = delete;
     TriggerHandle& operator=(const TriggerHandle&) = delete;
 
@@ -71,6 +79,16 @@ class TriggerHandle
     /// the hasTriggeredCallback
     void trigger() noexcept;
 
+    /// @brief Triggers the Trigger periodically without another thread, the timer is handled by the thread which waits
+    /// on the WaitSet or Listener the Trigger is attached to. The timer is disarmed when the TriggerHandle is reset or
+    /// the period is zero.
+    /// @param[in] period the period of the timer
+    /// @param[in] activityCounter if not a nullptr the Trigger is only triggered when the counter did not change within
+    /// the period
+    /// @return true if the timer was armed, false if the TriggerHandle is invalid, the period is zero or the origin of
+    /// the TriggerHandle does not support timers
+    bool enableTimer(const units::Duration& period, const std::atomic<uint64_t>* activityCounter = nullptr) noexcept;
+
     /// @brief calls the resetCallback and invalidates the TriggerHandle
     void reset() noexcept;
 
@@ -86,6 +104,7 @@ class TriggerHandle
   private:
     ConditionVariableData* m_conditionVariableDataPtr = nullptr;
     cxx::function<void(uint64_t)> m_resetCallback = [](auto) {};
+    EnableTimerCallback m_enableTimerCallback = [](auto, auto&, auto) { return false; };
     uint64_t m_uniqueTriggerId = Trigger::INVALID_TRIGGER_ID;
     mutable std::recursive_mutex m_mutex;
 };
@@ -0,0 +1,52 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_WAIT_OPTIONS_HPP
+#define IOX_POSH_POPO_WAIT_OPTIONS_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This struct is used to configure how the WaitSet and the Listener wait for notifications.
+///        Before the waiting thread is blocked it checks spinRepetitions times in a busy loop and afterwards
+///        yieldRepetitions times with a std::this_thread::yield in between if a notification arrived. When a
+///        notification arrives in this phase the costs of blocking and waking up the thread are avoided.
+///        With the default values the thread is blocked right away.
+///        When busyPolling is set the thread is never blocked and polls for notifications until one arrives
+///        or the timeout of a timed wait has passed. This avoids any syscall on the notifier and on the
+///        waiting side but occupies a CPU core. It is intended for threads which run on an isolated core.
+/// @note The polling phase is added on top of the timeout of a timed wait.
+struct WaitOptions
+{
+    /// @brief the number of times the waiting thread checks for a notification in a busy loop before it yields
+    uint64_t spinRepetitions{0U};
+
+    /// @brief the number of times the waiting thread checks for a notification with a std::this_thread::yield
+    ///        in between before it is blocked
+    uint64_t yieldRepetitions{0U};
+
+    /// @brief if true the waiting thread polls for notifications and is never blocked, the spin and yield
+    ///        repetitions are ignored in this case
+    bool busyPolling{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_OPTIONS_HPP
@@ -25,11 +25,13 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/notification_info.hpp"
+#include "iceoryx_posh/popo/notification_priority.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -62,6 +64,10 @@ class WaitSet
     using NotificationInfoVector = cxx::vector<const NotificationInfo*, CAPACITY>;
 
     WaitSet() noexcept;
+
+    /// @brief creates a WaitSet which waits for notifications as defined in the provided options
+    /// @param[in] waitOptions defines if and how long the WaitSet polls for notifications before it blocks
+    explicit WaitSet(const WaitOptions& waitOptions) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -84,6 +90,7 @@ class WaitSet
     /// @param[in] eventType the event specified by the class
     /// @param[in] notificationId an arbitrary user defined id for the event
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait and timedWait
     template <typename T,
               typename EventType,
               typename ContextDataType = internal::NoType_t,
@@ -92,7 +99,8 @@ class WaitSet
     attachEvent(T& eventOrigin,
                 const EventType eventType,
                 const uint64_t notificationId = 0U,
-                const NotificationCallback<T, ContextDataType>& eventCallback = {}) noexcept;
+                const NotificationCallback<T, ContextDataType>& eventCallback = {},
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches an event of a given class to the WaitSet.
     /// @note attachEvent does not take ownership of callback in the underlying eventCallback or the optional
@@ -100,13 +108,16 @@ class WaitSet
     /// @param[in] eventOrigin the class from which the event originates.
     /// @param[in] eventType the event specified by the class
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait and timedWait
     template <typename T,
               typename EventType,
               typename ContextDataType = internal::NoType_t,
               typename = std::enable_if_t<std::is_enum<EventType>::value, void>>
-    cxx::expected<WaitSetError> attachEvent(T& eventOrigin,
-                                            const EventType eventType,
-                                            const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+    cxx::expected<WaitSetError>
+    attachEvent(T& eventOrigin,
+                const EventType eventType,
+                const NotificationCallback<T, ContextDataType>& eventCallback,
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches an event of a given class to the WaitSet.
     /// @note attachEvent does not take ownership of callback in the underlying eventCallback or the optional
@@ -114,20 +125,25 @@ class WaitSet
     /// @param[in] eventOrigin the class from which the event originates.
     /// @param[in] notificationId an arbitrary user defined id for the event
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait and timedWait
     template <typename T, typename ContextDataType = internal::NoType_t>
     cxx::expected<WaitSetError>
     attachEvent(T& eventOrigin,
                 const uint64_t notificationId = 0U,
-                const NotificationCallback<T, ContextDataType>& eventCallback = {}) noexcept;
+                const NotificationCallback<T, ContextDataType>& eventCallback = {},
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches an event of a given class to the WaitSet.
     /// @note attachEvent does not take ownership of callback in the underlying eventCallback or the optional
     /// contextData. The user has to ensure that both will live as long as the event is attached.
     /// @param[in] eventOrigin the class from which the event originates.
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait and timedWait
     template <typename T, typename ContextDataType = internal::NoType_t>
-    cxx::expected<WaitSetError> attachEvent(T& eventOrigin,
-                                            const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+    cxx::expected<WaitSetError>
+    attachEvent(T& eventOrigin,
+                const NotificationCallback<T, ContextDataType>& eventCallback,
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
@@ -136,6 +152,7 @@ class WaitSet
     /// @param[in] stateType the state specified by the class
     /// @param[in] id an arbitrary user defined id for the state
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait and timedWait
     template <typename T,
               typename StateType,
               typename ContextDataType = internal::NoType_t,
@@ -144,7 +161,8 @@ class WaitSet
     attachState(T& stateOrigin,
                 const StateType stateType,
                 const uint64_t id = 0U,
-                const NotificationCallback<T, ContextDataType>& stateCallback = {}) noexcept;
+                const NotificationCallback<T, ContextDataType>& stateCallback = {},
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
@@ -152,13 +170,16 @@ class WaitSet
     /// @param[in] stateOrigin the class from which the state originates.
     /// @param[in] stateType the state specified by the class
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait and timedWait
     template <typename T,
               typename StateType,
               typename ContextDataType = internal::NoType_t,
               typename = std::enable_if_t<std::is_enum<StateType>::value, void>>
-    cxx::expected<WaitSetError> attachState(T& stateOrigin,
-                                            const StateType stateType,
-                                            const NotificationCallback<T, ContextDataType>& stateCallback) noexcept;
+    cxx::expected<WaitSetError>
+    attachState(T& stateOrigin,
+                const StateType stateType,
+                const NotificationCallback<T, ContextDataType>& stateCallback,
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
@@ -166,20 +187,25 @@ class WaitSet
     /// @param[in] stateOrigin the class from which the state originates.
     /// @param[in] id an arbitrary user defined id for the state
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait and timedWait
     template <typename T, typename ContextDataType = internal::NoType_t>
     cxx::expected<WaitSetError>
     attachState(T& stateOrigin,
                 const uint64_t id = 0U,
-                const NotificationCallback<T, ContextDataType>& stateCallback = {}) noexcept;
+                const NotificationCallback<T, ContextDataType>& stateCallback = {},
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
     /// contextData. The user has to ensure that both will live as long as the state is attached.
     /// @param[in] stateOrigin the class from which the state originates.
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait and timedWait
     template <typename T, typename ContextDataType = internal::NoType_t>
-    cxx::expected<WaitSetError> attachState(T& stateOrigin,
-                                            const NotificationCallback<T, ContextDataType>& stateCallback) noexcept;
+    cxx::expected<WaitSetError>
+    attachState(T& stateOrigin,
+                const NotificationCallback<T, ContextDataType>& stateCallback,
+                const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief detaches an event from the WaitSet
     /// @param[in] eventOrigin the origin of the event that should be detached
@@ -209,7 +235,7 @@ class WaitSet
     static constexpr uint64_t capacity() noexcept;
 
   protected:
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData, const WaitOptions& waitOptions = {}) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
@@ -229,12 +255,18 @@ class WaitSet
                                                      const uint64_t notificationId,
                                                      const NotificationCallback<T, ContextDataType>& eventCallback,
                                                      const uint64_t originType,
-                                                     const uint64_t originTypeHash) noexcept;
+                                                     const uint64_t originTypeHash,
+                                                     const NotificationPriority priority) noexcept;
 
     NotificationInfoVector waitAndReturnTriggeredTriggers(const WaitFunction& wait) noexcept;
     NotificationInfoVector createVectorWithTriggeredTriggers() noexcept;
 
+    TriggerHandle createTriggerHandle(const uint64_t uniqueTriggerId) noexcept;
     void removeTrigger(const uint64_t uniqueTriggerId) noexcept;
+    void notifyWhenStateConditionIsSatisfied(const uint64_t uniqueTriggerId) noexcept;
+    bool enableTimer(const uint64_t uniqueTriggerId,
+                     const units::Duration& period,
+                     const std::atomic<uint64_t>* activityCounter) noexcept;
     void removeAllTriggers() noexcept;
     void acquireNotifications(const WaitFunction& wait) noexcept;
 
@@ -246,6 +278,7 @@ class WaitSet
 
     cxx::stack<uint64_t, Capacity> m_indexRepository;
     ConditionListener::NotificationVector_t m_activeNotifications;
+    NotificationPriority m_priorities[Capacity]{};
 };
 
 } // namespace popo
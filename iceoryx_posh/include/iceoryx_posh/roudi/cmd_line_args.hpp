@@ -35,6 +35,7 @@ struct CmdLineArgs_t
     cxx::optional<uint16_t> uniqueRouDiId{cxx::nullopt};
     bool run{true};
     roudi::ConfigFilePathString_t configFilePath;
+    uint32_t runtimeMessagesThreadCount{roudi::DEFAULT_RUNTIME_MESSAGES_THREAD_COUNT};
 };
 
 inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const CmdLineArgs_t& cmdLineArgs) noexcept
@@ -45,6 +46,7 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
     cmdLineArgs.uniqueRouDiId.and_then([&logstream](auto& id) { logstream << "Unique RouDi ID: " << id << "\n"; })
         .or_else([&logstream] { logstream << "Unique RouDi ID: < unset >\n"; });
     logstream << "Process kill delay: " << cmdLineArgs.processKillDelay.toSeconds() << " s\n";
+    logstream << "Runtime messages threads: " << cmdLineArgs.runtimeMessagesThreadCount << "\n";
     if (!cmdLineArgs.configFilePath.empty())
     {
         logstream << "Config file used is: " << cmdLineArgs.configFilePath;
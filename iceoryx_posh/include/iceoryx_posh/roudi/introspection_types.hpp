@@ -41,6 +41,7 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    uint32_t m_reclaimedChunks{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -139,6 +140,26 @@ struct ProcessIntrospectionFieldTopic
     cxx::vector<ProcessIntrospectionData, MAX_PROCESS_NUMBER> m_processList;
 };
 
+const capro::ServiceDescription
+    IntrospectionRuntimeMessageService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "RuntimeMessages");
+constexpr uint32_t MAX_RUNTIME_MESSAGE_TYPE_NAME_LENGTH{32U};
+constexpr uint32_t MAX_NUMBER_OF_RUNTIME_MESSAGE_TYPES{16U};
+
+/// @brief the number of runtime messages of one type which were processed by RouDi and the time it took
+struct RuntimeMessageIntrospectionData
+{
+    cxx::string<MAX_RUNTIME_MESSAGE_TYPE_NAME_LENGTH> m_messageType;
+    uint64_t m_numberOfMessages{0U};
+    uint64_t m_totalProcessingTime_ns{0U};
+    uint64_t m_maxProcessingTime_ns{0U};
+};
+
+/// @brief the topic for the runtime message introspection that a user can subscribe to
+struct RuntimeMessageIntrospectionFieldTopic
+{
+    cxx::vector<RuntimeMessageIntrospectionData, MAX_NUMBER_OF_RUNTIME_MESSAGE_TYPES> m_messageList;
+};
+
 } // namespace roudi
 } // namespace iox
 
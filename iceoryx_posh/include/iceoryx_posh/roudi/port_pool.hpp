@@ -54,6 +54,8 @@ enum class PortPoolError : uint8_t
     NODE_DATA_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
+    HEARTBEAT_LIST_FULL,
+    COMMAND_CHANNEL_LIST_FULL,
 };
 
 class PortPool
@@ -71,6 +73,30 @@ class PortPool
     cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
     cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
     getConditionVariableDataList() noexcept;
+    cxx::vector<runtime::Heartbeat*, MAX_PROCESS_NUMBER> getHeartbeatList() noexcept;
+
+    /// @brief Returns the condition variable which is notified by the ports when they require a discovery run
+    popo::ConditionVariableData& getDiscoveryConditionVariableData() noexcept;
+
+    /// @brief Returns the list of the ports which changed their state since the last discovery run
+    popo::DirtyPortList& getDirtyPortList() noexcept;
+
+    /// @brief Returns the queue to which the runtimes submit their command channels with a pending request
+    runtime::CommandChannelQueue& getCommandChannelQueue() noexcept;
+
+    /// @brief Returns the command channel at the index which was submitted to the CommandChannelQueue
+    /// @return the command channel or a nullptr when the index is out of range
+    /// @note the command channels are never destroyed, therefore this can be called concurrently to the other methods
+    runtime::CommandChannel* getCommandChannel(const uint64_t index) noexcept;
+
+    ///@{
+    /// @brief Returns the port data at the index of a popo::DirtyPort
+    /// @return the port data or a nullptr when the port does not exist anymore
+    PublisherPortRouDiType::MemberType_t* getPublisherPortData(const uint64_t index) noexcept;
+    SubscriberPortType::MemberType_t* getSubscriberPortData(const uint64_t index) noexcept;
+    popo::ClientPortData* getClientPortData(const uint64_t index) noexcept;
+    popo::ServerPortData* getServerPortData(const uint64_t index) noexcept;
+    ///@}
 
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
@@ -135,6 +161,17 @@ class PortPool
     cxx::expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds a Heartbeat to the internal pool and returns a pointer for further usage
+    /// @param[in] runtimeName of the runtime the new heartbeat belongs to
+    /// @return on success a pointer to a Heartbeat; on error a PortPoolError
+    cxx::expected<runtime::Heartbeat*, PortPoolError> addHeartbeat(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Opens a command channel of the internal pool for a runtime and returns a pointer for further usage
+    /// @param[in] runtimeName of the runtime the command channel belongs to
+    /// @return on success a pointer to a CommandChannel; on error a PortPoolError
+    cxx::expected<runtime::CommandChannel*, PortPoolError>
+    addCommandChannel(const RuntimeName_t& runtimeName) noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -170,6 +207,19 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Removes a Heartbeat from the internal pool
+    /// @param[in] heartbeat is a pointer to the Heartbeat to be removed
+    /// @note after this call the provided Heartbeat is no longer available for usage
+    void removeHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept;
+
+    /// @brief Closes a CommandChannel of the internal pool
+    /// @param[in] commandChannel is a pointer to the CommandChannel to be closed
+    /// @note after this call the provided CommandChannel can be opened for another runtime
+    void removeCommandChannel(runtime::CommandChannel* const commandChannel) noexcept;
+
+  private:
+    void enableDiscoveryRequests(popo::BasePortData& portData, const popo::DirtyPort& dirtyPort) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
 };
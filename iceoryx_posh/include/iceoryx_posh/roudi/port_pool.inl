@@ -27,14 +27,17 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
                                                                     const popo::SubscriberOptions& subscriberOptions,
                                                                     const mepoo::MemoryInfo& memoryInfo) noexcept
 {
+    const bool discardOldestData = (subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::DISCARD_OLDEST_DATA);
+    cxx::VariantQueueTypes queueType = discardOldestData ? cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
+                                                         : cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
+    if (subscriberOptions.useShardedQueue)
+    {
+        queueType = discardOldestData ? cxx::VariantQueueTypes::SoFi_ShardedMultiProducerSingleConsumer
+                                      : cxx::VariantQueueTypes::FiFo_ShardedMultiProducerSingleConsumer;
+    }
+
     return m_portPoolData->m_subscriberPortMembers.insert(
-        serviceDescription,
-        runtimeName,
-        (subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
-            ? cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
-            : cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
-        subscriberOptions,
-        memoryInfo);
+        serviceDescription, runtimeName, queueType, subscriberOptions, memoryInfo);
 }
 
 template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPolicy>::value>*>
@@ -58,6 +58,7 @@ class RouDiApp
 
     version::CompatibilityCheckLevel m_compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     units::Duration m_processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    uint32_t m_runtimeMessagesThreadCount{roudi::DEFAULT_RUNTIME_MESSAGES_THREAD_COUNT};
 
   private:
     bool checkAndOptimizeConfig(const RouDiConfig_t& config) noexcept;
@@ -16,6 +16,8 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_CONFIG_HPP
 #define IOX_POSH_ROUDI_ROUDI_CONFIG_HPP
 
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <cstdint>
@@ -24,10 +26,35 @@ namespace iox
 {
 namespace config
 {
+/// @brief A publisher and its subscribers which RouDi creates and connects before the runtimes are started. A runtime
+/// takes the port of its name with the service of the connection when it requests it instead of creating a new one.
+struct StaticConnection
+{
+    capro::ServiceDescription m_service;
+    RuntimeName_t m_publisherRuntimeName;
+    cxx::vector<RuntimeName_t, roudi::MAX_SUBSCRIBERS_PER_STATIC_CONNECTION> m_subscriberRuntimeNames;
+    /// @brief the history capacity of the publisher, a subscriber which is connected again after its runtime
+    /// terminated requests the complete history
+    uint64_t m_historyCapacity{0U};
+    uint64_t m_queueCapacity{MAX_SUBSCRIBER_QUEUE_CAPACITY};
+};
+
 struct RouDiConfig
 {
+    using StaticConnections_t = cxx::vector<StaticConnection, roudi::MAX_STATIC_CONNECTIONS>;
+
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
+
+    /// @brief the number of port data slots which are allocated in the management segment for every port type, they
+    /// must not exceed the compile time maxima MAX_PUBLISHERS, MAX_SUBSCRIBERS, MAX_CLIENTS and MAX_SERVERS
+    uint32_t m_maxNumberOfPublishers{MAX_PUBLISHERS};
+    uint32_t m_maxNumberOfSubscribers{MAX_SUBSCRIBERS};
+    uint32_t m_maxNumberOfClients{MAX_CLIENTS};
+    uint32_t m_maxNumberOfServers{MAX_SERVERS};
+
+    /// @brief the connections of the static topology, they are empty by default
+    StaticConnections_t m_staticConnections;
 };
 } // namespace config
 } // namespace iox
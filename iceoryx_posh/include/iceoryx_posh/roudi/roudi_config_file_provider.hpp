@@ -35,6 +35,12 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// MAX_NUMBER_OF_PORTS_EXCEEDED - the number of ports of a type exceeds the compile time maximum
+/// STATIC_CONNECTION_WITHOUT_SERVICE_DESCRIPTION - a static connection needs a service, an instance and an event
+/// STATIC_CONNECTION_WITH_INVALID_RUNTIME_NAME - a static connection needs a publisher and all runtime names must be
+/// valid
+/// MAX_NUMBER_OF_STATIC_CONNECTIONS_EXCEEDED - max number of static connections exceeded
+/// STATIC_CONNECTION_WITH_TOO_MANY_SUBSCRIBERS - max number of subscribers of a static connection exceeded
 enum class RouDiConfigFileParseError
 {
     NO_GENERAL_SECTION,
@@ -45,6 +51,11 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    MAX_NUMBER_OF_PORTS_EXCEEDED,
+    STATIC_CONNECTION_WITHOUT_SERVICE_DESCRIPTION,
+    STATIC_CONNECTION_WITH_INVALID_RUNTIME_NAME,
+    MAX_NUMBER_OF_STATIC_CONNECTIONS_EXCEEDED,
+    STATIC_CONNECTION_WITH_TOO_MANY_SUBSCRIBERS,
     EXCEPTION_IN_PARSER
 };
 
@@ -56,6 +67,11 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"NO_GENERAL_SEC
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "MAX_NUMBER_OF_PORTS_EXCEEDED",
+                                                                 "STATIC_CONNECTION_WITHOUT_SERVICE_DESCRIPTION",
+                                                                 "STATIC_CONNECTION_WITH_INVALID_RUNTIME_NAME",
+                                                                 "MAX_NUMBER_OF_STATIC_CONNECTIONS_EXCEEDED",
+                                                                 "STATIC_CONNECTION_WITH_TOO_MANY_SUBSCRIBERS",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
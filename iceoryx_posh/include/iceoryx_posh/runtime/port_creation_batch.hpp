@@ -0,0 +1,166 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_PORT_CREATION_BATCH_HPP
+#define IOX_POSH_RUNTIME_PORT_CREATION_BATCH_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_port_request.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+class PoshRuntime;
+class PoshRuntimeImpl;
+
+/// @brief Collects the requests for publisher, subscriber, client and server ports which are created with a single
+///        PoshRuntime::createPorts call. The runtime sends as many requests as fit into one message to RouDi instead
+///        of one request and response per port. The created ports are reserved in the batch, a subsequent
+///        getMiddlewarePublisher, getMiddlewareSubscriber, getMiddlewareClient or getMiddlewareServer call with the
+///        same arguments, e.g. from the constructor of a popo::Publisher, takes the reserved port without a message to
+///        RouDi. Ports which were not taken are destroyed together with the batch.
+/// @code
+///     iox::runtime::PortCreationBatch<64U> batch;
+///     batch.addPublisher({"Radar", "FrontLeft", "Object"});
+///     batch.addSubscriber({"Radar", "FrontRight", "Object"});
+///     iox::runtime::PoshRuntime::getInstance().createPorts(batch);
+///
+///     // both ports are taken from the batch
+///     iox::popo::Publisher<RadarObject> publisher({"Radar", "FrontLeft", "Object"});
+///     iox::popo::Subscriber<RadarObject> subscriber({"Radar", "FrontRight", "Object"});
+/// @endcode
+/// @note The batch must outlive the creation of the ports which are taken from it and must not be destroyed
+///       concurrently to a call to the runtime
+class PortCreationBatchBase
+{
+  public:
+    /// @brief a request of the batch together with the port which was created for it
+    struct Entry
+    {
+        IpcPortRequest request;
+        /// @brief the created port or a nullptr if it was not created yet or the creation failed
+        void* port{nullptr};
+        /// @brief true if the port was handed out by the runtime and is owned by the user
+        bool isTaken{false};
+    };
+
+    PortCreationBatchBase(const PortCreationBatchBase&) = delete;
+    PortCreationBatchBase(PortCreationBatchBase&&) = delete;
+    PortCreationBatchBase& operator=(const PortCreationBatchBase&) = delete;
+    PortCreationBatchBase& operator=(PortCreationBatchBase&&) = delete;
+
+    /// @brief adds a request for a publisher port
+    /// @param[in] service service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return true if the request was added, false if the batch is full or the ports were already created
+    bool addPublisher(const capro::ServiceDescription& service,
+                      const popo::PublisherOptions& publisherOptions = {},
+                      const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a request for a subscriber port
+    /// @param[in] service service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return true if the request was added, false if the batch is full or the ports were already created
+    bool addSubscriber(const capro::ServiceDescription& service,
+                       const popo::SubscriberOptions& subscriberOptions = {},
+                       const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a request for a client port
+    /// @param[in] service service description for the new client port
+    /// @param[in] clientOptions like the queue capacity and queue full policy by a client
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return true if the request was added, false if the batch is full or the ports were already created
+    bool addClient(const capro::ServiceDescription& service,
+                   const popo::ClientOptions& clientOptions = {},
+                   const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a request for a server port
+    /// @param[in] service service description for the new server port
+    /// @param[in] serverOptions like the queue capacity and queue full policy by a server
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return true if the request was added, false if the batch is full or the ports were already created
+    bool addServer(const capro::ServiceDescription& service,
+                   const popo::ServerOptions& serverOptions = {},
+                   const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief returns the number of requests in the batch
+    uint64_t size() const noexcept;
+
+    /// @brief returns the maximum number of requests in the batch
+    uint64_t capacity() const noexcept;
+
+    /// @brief returns the number of created ports which were not taken yet
+    uint64_t numberOfReservedPorts() const noexcept;
+
+  protected:
+    /// @brief creates an empty batch, the derived class provides the storage of the entries with setEntries
+    /// @param[in] capacity the number of entries of the storage
+    explicit PortCreationBatchBase(const uint64_t capacity) noexcept;
+    ~PortCreationBatchBase() noexcept = default;
+
+    /// @brief sets the storage of the entries, must be called by the derived class in its constructor
+    void setEntries(Entry* const entries) noexcept;
+
+    /// @brief destroys the ports which were not taken, must be called by the derived class before the entries are
+    ///        destroyed
+    void release() noexcept;
+
+  private:
+    friend class PoshRuntimeImpl;
+
+    bool add(const IpcPortRequest& request) noexcept;
+
+    Entry* m_entries{nullptr};
+    uint64_t m_capacity{0U};
+    uint64_t m_size{0U};
+    /// @brief the runtime which created the ports or a nullptr if the ports were not created yet
+    PoshRuntime* m_runtime{nullptr};
+};
+
+/// @brief PortCreationBatchBase with the storage for Capacity requests
+/// @tparam Capacity the maximum number of requests
+template <uint64_t Capacity>
+class PortCreationBatch : public PortCreationBatchBase
+{
+  public:
+    PortCreationBatch() noexcept;
+    ~PortCreationBatch() noexcept;
+
+    PortCreationBatch(const PortCreationBatch&) = delete;
+    PortCreationBatch(PortCreationBatch&&) = delete;
+    PortCreationBatch& operator=(const PortCreationBatch&) = delete;
+    PortCreationBatch& operator=(PortCreationBatch&&) = delete;
+
+  private:
+    std::array<Entry, Capacity> m_entryStorage;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/port_creation_batch.inl"
+
+#endif // IOX_POSH_RUNTIME_PORT_CREATION_BATCH_HPP
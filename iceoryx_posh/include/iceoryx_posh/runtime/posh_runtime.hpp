@@ -33,6 +33,7 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_creation_batch.hpp"
 
 #include <atomic>
 
@@ -151,6 +152,14 @@ class PoshRuntime
     /// @return pointer to the data of the node
     virtual NodeData* createNode(const NodeProperty& nodeProperty) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create all ports of the batch with as few messages as possible
+    /// @param[in] batch with the requested ports, the created ports are reserved in the batch until they are taken by
+    /// a getMiddlewarePublisher, getMiddlewareSubscriber, getMiddlewareClient or getMiddlewareServer call with the same
+    /// arguments
+    /// @return the number of ports which were created, ports which could not be created are requested again when
+    /// they are taken and report their error then
+    virtual uint64_t createPorts(PortCreationBatchBase& batch) noexcept = 0;
+
     /// @brief send a request to the RouDi daemon and get the response
     ///        currently each request is followed by a response
     /// @param[in] msg request message to send
@@ -160,6 +169,7 @@ class PoshRuntime
 
   protected:
     friend class roudi::RuntimeTestInterface;
+    friend class PortCreationBatchBase;
     using factory_t = PoshRuntime& (*)(cxx::optional<const RuntimeName_t*>);
 
     // Protected constructor for derived classes
@@ -188,6 +198,11 @@ class PoshRuntime
     /// @brief checks the given application name for certain constraints like length or if is empty
     const RuntimeName_t& verifyInstanceName(cxx::optional<const RuntimeName_t*> name) noexcept;
 
+    /// @brief destroys the ports of the batch which were not taken and removes the batch from the runtime, it is
+    /// called by the batch on destruction
+    /// @param[in] batch whose ports were created by createPorts
+    virtual void releasePorts(PortCreationBatchBase& batch) noexcept = 0;
+
     const RuntimeName_t m_appName;
     std::atomic<bool> m_shutdownRequested{false};
 };
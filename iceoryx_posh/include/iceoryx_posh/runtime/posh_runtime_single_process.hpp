@@ -27,8 +27,21 @@ namespace runtime
 class PoshRuntimeSingleProcess : public PoshRuntimeImpl
 {
   public:
+    /// @brief Creates a runtime which communicates with the RouDi in the same process via the IPC channel
+    /// @param[in] name of the runtime
     PoshRuntimeSingleProcess(const RuntimeName_t& name) noexcept;
+
+    /// @brief Creates a runtime which hands its requests directly to the RouDi in the same process. RouDi processes
+    /// them in the thread of the caller, therefore neither the IPC channels nor the runtime messages threads of RouDi
+    /// are required and the ports are connected when they are returned.
+    /// @param[in] name of the runtime
+    /// @param[in] roudi which runs in the same process and must outlive the runtime
+    PoshRuntimeSingleProcess(const RuntimeName_t& name, InProcessRequestHandler& roudi) noexcept;
+
     ~PoshRuntimeSingleProcess();
+
+  private:
+    void setAsRuntimeOfProcess() noexcept;
 };
 } // namespace runtime
 } // namespace iox
@@ -83,7 +83,18 @@ class ServiceDiscovery
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
+    popo::Subscriber<roudi::ServiceRegistryChange> m_serviceRegistryChangeSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGE_EVENT_NAME},
+        {SERVICE_REGISTRY_CHANGE_QUEUE_CAPACITY, 0U, iox::NodeName_t("Service Registry"), true}};
+
+    /// @brief false when a change was missed, the local registry is then replaced by the next complete registry
+    ///        which contains at least the changes up to m_requiredGeneration
+    bool m_isInSync{false};
+    uint64_t m_requiredGeneration{0U};
+
     void update();
+    void applyChange(const roudi::ServiceRegistryChange& change) noexcept;
+    void adoptServiceRegistryIfRequired(const roudi::ServiceRegistry& serviceRegistry) noexcept;
 };
 
 } // namespace runtime
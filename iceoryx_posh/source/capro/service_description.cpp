@@ -222,6 +222,26 @@ Interfaces ServiceDescription::getSourceInterface() const noexcept
     return m_interfaceSource;
 }
 
+uint64_t ServiceDescription::hash() const noexcept
+{
+    // FNV-1a over the three strings, the terminating zero separates the strings so that e.g. "ab", "c" and "a", "bc"
+    // have different hashes
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (const auto* idString : {&m_serviceString, &m_instanceString, &m_eventString})
+    {
+        const auto* character = idString->c_str();
+        for (uint64_t i = 0U; i <= idString->size(); ++i)
+        {
+            hash ^= static_cast<uint8_t>(character[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
 bool serviceMatch(const ServiceDescription& first, const ServiceDescription& second) noexcept
 {
     return (first.getServiceIDString() == second.getServiceIDString());
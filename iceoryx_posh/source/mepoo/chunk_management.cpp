@@ -24,14 +24,20 @@ namespace mepoo
 {
 ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                                  const cxx::not_null<MemPool*> mempool,
-                                 const cxx::not_null<MemPool*> chunkManagementPool) noexcept
+                                 const cxx::not_null<MemPool*> chunkManagementPool,
+                                 const uint64_t obtainedInCollection) noexcept
     : m_chunkHeader(chunkHeader)
     , m_mempool(mempool)
     , m_chunkManagementPool(chunkManagementPool)
+    , m_obtainedInCollection(obtainedInCollection)
 {
     static_assert(alignof(ChunkManagement) <= mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT,
                   "The ChunkManagement must not exceed the alignment of the mempool chunks, which are aligned to "
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
+
+    // the ChunkGarbageCollector inspects only ChunkManagements in use, it must observe the members of the new chunk
+    // once it observes the reference counter
+    m_referenceCounter.store(1U, std::memory_order_release);
 }
 
 
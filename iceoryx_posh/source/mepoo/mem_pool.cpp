@@ -29,11 +29,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint32_t reclaimedChunks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_reclaimedChunks(reclaimedChunks)
 {
 }
 
@@ -110,6 +112,39 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+void* MemPool::getChunkByIndex(const uint32_t index) const noexcept
+{
+    cxx::Expects(index < m_numberOfChunks);
+    return m_rawMemory.get() + static_cast<uint64_t>(index) * m_chunkSize;
+}
+
+cxx::optional<uint32_t> MemPool::getChunkIndex(const void* chunk) const noexcept
+{
+    if (chunk < m_rawMemory.get()
+        || chunk > m_rawMemory.get() + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)))
+    {
+        return cxx::nullopt;
+    }
+
+    auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory.get();
+    if (offset % m_chunkSize != 0)
+    {
+        return cxx::nullopt;
+    }
+    return static_cast<uint32_t>(offset / m_chunkSize);
+}
+
+void MemPool::reclaimChunk(const void* chunk) noexcept
+{
+    freeChunk(chunk);
+    m_reclaimedChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getReclaimedChunks() const noexcept
+{
+    return m_reclaimedChunks.load(std::memory_order_relaxed);
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -135,7 +170,8 @@ MemPoolInfo MemPool::getInfo() const noexcept
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_reclaimedChunks.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
@@ -197,12 +197,47 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
     else
     {
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
+        // sequentially consistent like the start of the transfer in which the chunk is obtained, see
+        // startGarbageCollection
         auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+            ChunkManagement(chunkHeader,
+                            memPoolPointer,
+                            &m_chunkManagementPool.front(),
+                            m_lastStartedGarbageCollection.load(std::memory_order_seq_cst));
         return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
     }
 }
 
+ChunkManagement* MemoryManager::findChunkManagement(const void* const address) noexcept
+{
+    if (m_chunkManagementPool.empty())
+    {
+        return nullptr;
+    }
+
+    auto& chunkManagementPool = m_chunkManagementPool.front();
+    auto index = chunkManagementPool.getChunkIndex(address);
+    if (!index.has_value())
+    {
+        return nullptr;
+    }
+    return static_cast<ChunkManagement*>(chunkManagementPool.getChunkByIndex(index.value()));
+}
+
+void MemoryManager::startGarbageCollection(const uint64_t collection) noexcept
+{
+    // the collector records the ChunkTransferTrackers of all ports afterwards, a transfer which is started after the
+    // recording is therefore guaranteed to stamp its chunks with the new collection
+    m_lastStartedGarbageCollection.store(collection, std::memory_order_seq_cst);
+}
+
+void MemoryManager::reclaimChunk(ChunkManagement& chunkManagement) noexcept
+{
+    chunkManagement.m_referenceCounter.store(0U, std::memory_order_relaxed);
+    chunkManagement.m_mempool->reclaimChunk(static_cast<void*>(chunkManagement.m_chunkHeader.get()));
+    chunkManagement.m_chunkManagementPool->freeChunk(&chunkManagement);
+}
+
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
 {
     stream << asStringLiteral(value);
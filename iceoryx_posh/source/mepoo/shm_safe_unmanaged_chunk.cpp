@@ -110,5 +110,16 @@ bool ShmSafeUnmanagedChunk::isNotLogicalNullptrAndHasNoOtherOwners() const noexc
     return chunkMgmt->m_referenceCounter.load(std::memory_order_relaxed) == 1U;
 }
 
+const ChunkManagement* ShmSafeUnmanagedChunk::getChunkManagementAddress() const noexcept
+{
+    if (m_chunkManagement.isLogicalNullptr())
+    {
+        return nullptr;
+    }
+    return memory::RelativePointer<mepoo::ChunkManagement>(m_chunkManagement.offset(),
+                                                           memory::segment_id_t{m_chunkManagement.id()})
+        .get();
+}
+
 } // namespace mepoo
 } // namespace iox
@@ -0,0 +1,54 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_transfer_tracker.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t ChunkTransferTracker::IN_PROGRESS_MASK;
+constexpr uint64_t ChunkTransferTracker::STARTED_TRANSFERS_SHIFT;
+constexpr uint64_t ChunkTransferTracker::START_OF_TRANSFER;
+
+ChunkTransferTracker::Transfer::Transfer(ChunkTransferTracker& tracker) noexcept
+    : m_tracker(tracker)
+{
+    // sequentially consistent since the ChunkGarbageCollector relies on a chunk which is obtained in a transfer
+    // after its recording to be stamped with the running collection, see MemoryManager::startGarbageCollection
+    m_tracker.m_state.fetch_add(START_OF_TRANSFER, std::memory_order_seq_cst);
+    // the port data must not be modified before the start of the transfer is visible, like the sequence counter of
+    // a seqlock; the collector pairs it with an acquire fence after it inspected the port data
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+ChunkTransferTracker::Transfer::~Transfer() noexcept
+{
+    m_tracker.m_state.fetch_sub(1U, std::memory_order_release);
+}
+
+cxx::optional<uint32_t> ChunkTransferTracker::getNumberOfStartedTransfers() const noexcept
+{
+    auto state = m_state.load(std::memory_order_seq_cst);
+    if ((state & IN_PROGRESS_MASK) != 0U)
+    {
+        return cxx::nullopt;
+    }
+    return static_cast<uint32_t>(state >> STARTED_TRANSFERS_SHIFT);
+}
+
+} // namespace popo
+} // namespace iox
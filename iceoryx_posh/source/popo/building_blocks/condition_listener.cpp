@@ -16,15 +16,25 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cpu_relax.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitOptions& waitOptions) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitOptions(waitOptions)
 {
+    if (m_waitOptions.busyPolling)
+    {
+        getMembers()->m_isListenerBusyPolling.store(true, std::memory_order_relaxed);
+    }
 }
 
 void ConditionListener::resetSemaphore() noexcept
@@ -58,8 +68,21 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
+    if (m_waitOptions.busyPolling)
+    {
+        return waitImpl([]() -> bool {
+            concurrent::cpuRelax();
+            return true;
+        });
+    }
+
     return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
+        // with armed timers the wait is bounded by the next timer expiry so that waitImpl can activate it
+        auto timeToNextTimerExpiry = this->timeUntilNextTimerExpiry();
+        bool hasError = (timeToNextTimerExpiry.has_value())
+                            ? this->getMembers()->m_semaphore->timedWait(*timeToNextTimerExpiry).has_error()
+                            : this->getMembers()->m_semaphore->wait().has_error();
+        if (hasError)
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
             return false;
@@ -70,47 +93,191 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    if (m_waitOptions.busyPolling)
+    {
+        cxx::DeadlineTimer deadline(timeToWait);
+        return waitImpl([&deadline]() -> bool {
+            concurrent::cpuRelax();
+            return !deadline.hasExpired();
+        });
+    }
+
+    cxx::DeadlineTimer deadline(timeToWait);
+    return waitImpl([this, &deadline]() -> bool {
+        auto remainingTimeToWait = deadline.remainingTime();
+        bool isWaitingForTimer = false;
+        this->timeUntilNextTimerExpiry().and_then([&](const auto& timeToNextTimerExpiry) {
+            if (timeToNextTimerExpiry < remainingTimeToWait)
+            {
+                remainingTimeToWait = timeToNextTimerExpiry;
+                isWaitingForTimer = true;
+            }
+        });
+
+        if (this->getMembers()->m_semaphore->timedWait(remainingTimeToWait).has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+            return false;
         }
-        return false;
+        // an expired timer whose condition does not hold must not end the wait before timeToWait has passed
+        return isWaitingForTimer;
     });
 }
 
 ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept
 {
-    using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        activateExpiredTimers();
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
         }
 
-        doReturnAfterNotificationCollection = !waitCall();
+        if (!pollForNotification())
+        {
+            doReturnAfterNotificationCollection = !waitCall();
+        }
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Index_t = cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>;
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
+    {
+        auto& word = getMembers()->m_activeNotifications[wordIndex];
+        // avoid the write access to the shared cache line when no notifier of this word was triggered
+        if (word.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        uint64_t activeBits = word.exchange(0U, std::memory_order_acquire);
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+        while (activeBits != 0U)
+        {
+            const uint64_t bitIndex = cxx::countTrailingZeros(activeBits);
+            activeBits &= activeBits - 1U;
+            activeNotifications.emplace_back(
+                static_cast<Index_t>(wordIndex * ConditionVariableData::NOTIFIERS_PER_WORD + bitIndex));
+        }
+    }
+}
+
+bool ConditionListener::pollForNotification() noexcept
+{
+    if (m_waitOptions.busyPolling)
+    {
+        // the notifiers do not post the semaphore, waitImpl polls the active notifications directly
+        return false;
+    }
+
+    // the notifier posts the semaphore after it has set the active notification, therefore the semaphore
+    // state signals whether a new notification arrived since the last scan
+    auto hasNotificationArrived = [this] {
+        if (m_toBeDestroyed.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        auto result = getMembers()->m_semaphore->tryWait();
+        if (result.has_error())
+        {
+            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+            return false;
+        }
+        return result.value();
+    };
+
+    for (uint64_t i = 0U; i < m_waitOptions.spinRepetitions; ++i)
+    {
+        if (hasNotificationArrived())
+        {
+            return true;
+        }
+        concurrent::cpuRelax();
+    }
+
+    for (uint64_t i = 0U; i < m_waitOptions.yieldRepetitions; ++i)
+    {
+        if (hasNotificationArrived())
+        {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+
+    return false;
+}
+
+bool ConditionListener::addTimer(const uint64_t notificationIndex,
+                                 const units::Duration& period,
+                                 const std::atomic<uint64_t>* activityCounter) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_timerMutex);
+        const bool isTimerArmed = m_timerWheel.add(notificationIndex, period, getCurrentTime(), activityCounter);
+        m_hasTimers.store(!m_timerWheel.empty(), std::memory_order_relaxed);
+        if (!isTimerArmed)
+        {
+            return false;
+        }
+    }
+
+    if (!m_waitOptions.busyPolling)
+    {
+        // wake up a blocking wait so that it takes the new timer into account
+        getMembers()->m_semaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_ADD_TIMER, ErrorLevel::FATAL);
+        });
+    }
+    return true;
+}
+
+void ConditionListener::removeTimer(const uint64_t notificationIndex) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_timerMutex);
+    m_timerWheel.remove(notificationIndex);
+    m_hasTimers.store(!m_timerWheel.empty(), std::memory_order_relaxed);
+}
+
+void ConditionListener::activateExpiredTimers() noexcept
+{
+    if (!m_hasTimers.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_timerMutex);
+    m_timerWheel.advance(getCurrentTime(), [this](const uint64_t notificationIndex) {
+        getMembers()
+            ->m_activeNotifications[ConditionVariableData::notificationWordIndex(notificationIndex)]
+            .fetch_or(ConditionVariableData::notificationBitMask(notificationIndex), std::memory_order_relaxed);
+    });
+}
+
+cxx::optional<units::Duration> ConditionListener::timeUntilNextTimerExpiry() noexcept
+{
+    if (!m_hasTimers.load(std::memory_order_relaxed))
+    {
+        return cxx::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(m_timerMutex);
+    return m_timerWheel.timeUntilNextExpiry(getCurrentTime());
+}
+
+units::Duration ConditionListener::getCurrentTime() noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    return units::Duration{std::chrono::steady_clock::now().time_since_epoch()};
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
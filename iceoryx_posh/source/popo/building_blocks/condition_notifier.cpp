@@ -36,8 +36,14 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    getMembers()
+        ->m_activeNotifications[ConditionVariableData::notificationWordIndex(m_notificationIndex)]
+        .fetch_or(ConditionVariableData::notificationBitMask(m_notificationIndex), std::memory_order_release);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+    if (getMembers()->m_isListenerBusyPolling.load(std::memory_order_relaxed))
+    {
+        return;
+    }
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
 }
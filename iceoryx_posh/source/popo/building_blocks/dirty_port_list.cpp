@@ -0,0 +1,44 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t DirtyPortList::CAPACITY;
+
+void DirtyPortList::push(const DirtyPort& port) noexcept
+{
+    if (!m_queue.tryPush(port))
+    {
+        m_hasOverflowed.store(true, std::memory_order_release);
+    }
+}
+
+cxx::optional<DirtyPort> DirtyPortList::pop() noexcept
+{
+    return m_queue.pop();
+}
+
+bool DirtyPortList::checkAndResetOverflow() noexcept
+{
+    return m_hasOverflowed.exchange(false, std::memory_order_acq_rel);
+}
+
+} // namespace popo
+} // namespace iox
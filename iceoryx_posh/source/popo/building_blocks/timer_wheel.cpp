@@ -0,0 +1,219 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_wheel.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t TimerWheel::CAPACITY;
+constexpr uint64_t TimerWheel::NUMBER_OF_SLOTS;
+constexpr units::Duration TimerWheel::DEFAULT_RESOLUTION;
+constexpr TimerWheel::Index_t TimerWheel::INVALID_INDEX;
+
+TimerWheel::TimerWheel(const units::Duration resolution) noexcept
+    : m_resolutionInNanoseconds(std::max(resolution.toNanoseconds(), static_cast<uint64_t>(1U)))
+{
+    std::fill(std::begin(m_slots), std::end(m_slots), INVALID_INDEX);
+}
+
+bool TimerWheel::add(const uint64_t index,
+                     const units::Duration period,
+                     const units::Duration now,
+                     const std::atomic<uint64_t>* activityCounter) noexcept
+{
+    if (index >= CAPACITY)
+    {
+        return false;
+    }
+
+    remove(index);
+    if (period == units::Duration::zero())
+    {
+        return false;
+    }
+
+    if (m_numberOfArmedTimers == 0U)
+    {
+        // nothing can be skipped when the wheel is empty, this avoids iterating over all slots in the next advance
+        m_currentTick = toTicksRoundedDown(now);
+    }
+
+    auto& timer = m_timers[index];
+    timer.isArmed = true;
+    timer.periodInTicks = std::max(toTicksRoundedUp(period), static_cast<uint64_t>(1U));
+    timer.expiryTick = std::max(toTicksRoundedUp(now + period), m_currentTick + 1U);
+    timer.activityCounter = activityCounter;
+    timer.lastActivity = (activityCounter != nullptr) ? activityCounter->load(std::memory_order_relaxed) : 0U;
+
+    link(index);
+    ++m_numberOfArmedTimers;
+    return true;
+}
+
+void TimerWheel::remove(const uint64_t index) noexcept
+{
+    if (index >= CAPACITY || !m_timers[index].isArmed)
+    {
+        return;
+    }
+
+    unlink(index);
+    m_timers[index].isArmed = false;
+    --m_numberOfArmedTimers;
+}
+
+bool TimerWheel::empty() const noexcept
+{
+    return m_numberOfArmedTimers == 0U;
+}
+
+cxx::optional<units::Duration> TimerWheel::timeUntilNextExpiry(const units::Duration now) const noexcept
+{
+    if (empty())
+    {
+        return cxx::nullopt;
+    }
+
+    // the first slot which contains a timer of the current rotation contains the next expiry, timers of later
+    // rotations are only relevant when there is no timer in the current rotation
+    uint64_t nextExpiryTick = std::numeric_limits<uint64_t>::max();
+    for (uint64_t tick = m_currentTick + 1U; tick <= m_currentTick + NUMBER_OF_SLOTS; ++tick)
+    {
+        for (auto index = m_slots[tick % NUMBER_OF_SLOTS]; index != INVALID_INDEX; index = m_timers[index].next)
+        {
+            nextExpiryTick = std::min(nextExpiryTick, m_timers[index].expiryTick);
+        }
+
+        if (nextExpiryTick <= tick)
+        {
+            break;
+        }
+    }
+
+    const auto nextExpiry = units::Duration::fromNanoseconds(nextExpiryTick * m_resolutionInNanoseconds);
+    return (nextExpiry > now) ? nextExpiry - now : units::Duration::zero();
+}
+
+void TimerWheel::advance(const units::Duration now, const cxx::function_ref<void(uint64_t)>& onExpiry) noexcept
+{
+    const uint64_t nowTick = toTicksRoundedDown(now);
+    if (empty() || nowTick <= m_currentTick)
+    {
+        m_currentTick = std::max(m_currentTick, nowTick);
+        return;
+    }
+
+    // after a full rotation every slot was visited, the remaining timers belong to later rotations
+    const uint64_t numberOfSlotsToVisit = std::min(nowTick - m_currentTick, NUMBER_OF_SLOTS);
+    for (uint64_t tick = m_currentTick + 1U; tick <= m_currentTick + numberOfSlotsToVisit; ++tick)
+    {
+        auto index = m_slots[tick % NUMBER_OF_SLOTS];
+        while (index != INVALID_INDEX)
+        {
+            const auto nextIndex = m_timers[index].next;
+            auto& timer = m_timers[index];
+            if (timer.expiryTick <= nowTick)
+            {
+                bool hasExpired = true;
+                if (timer.activityCounter != nullptr)
+                {
+                    const uint64_t activity = timer.activityCounter->load(std::memory_order_relaxed);
+                    hasExpired = (activity == timer.lastActivity);
+                    timer.lastActivity = activity;
+                }
+
+                rearm(index, nowTick);
+
+                if (hasExpired)
+                {
+                    onExpiry(index);
+                }
+            }
+            index = nextIndex;
+        }
+    }
+
+    m_currentTick = nowTick;
+}
+
+uint64_t TimerWheel::toTicksRoundedDown(const units::Duration time) const noexcept
+{
+    return time.toNanoseconds() / m_resolutionInNanoseconds;
+}
+
+uint64_t TimerWheel::toTicksRoundedUp(const units::Duration time) const noexcept
+{
+    const uint64_t nanoseconds = time.toNanoseconds();
+    return nanoseconds / m_resolutionInNanoseconds + ((nanoseconds % m_resolutionInNanoseconds != 0U) ? 1U : 0U);
+}
+
+void TimerWheel::link(const uint64_t index) noexcept
+{
+    auto& timer = m_timers[index];
+    auto& head = m_slots[timer.expiryTick % NUMBER_OF_SLOTS];
+
+    timer.previous = INVALID_INDEX;
+    timer.next = head;
+    if (head != INVALID_INDEX)
+    {
+        m_timers[head].previous = static_cast<Index_t>(index);
+    }
+    head = static_cast<Index_t>(index);
+}
+
+void TimerWheel::unlink(const uint64_t index) noexcept
+{
+    auto& timer = m_timers[index];
+    if (timer.previous != INVALID_INDEX)
+    {
+        m_timers[timer.previous].next = timer.next;
+    }
+    else
+    {
+        m_slots[timer.expiryTick % NUMBER_OF_SLOTS] = timer.next;
+    }
+
+    if (timer.next != INVALID_INDEX)
+    {
+        m_timers[timer.next].previous = timer.previous;
+    }
+
+    timer.next = INVALID_INDEX;
+    timer.previous = INVALID_INDEX;
+}
+
+void TimerWheel::rearm(const uint64_t index, const uint64_t currentTick) noexcept
+{
+    unlink(index);
+
+    // keep the timer in its period grid, periods which were missed completely are skipped
+    auto& timer = m_timers[index];
+    timer.expiryTick += timer.periodInTicks;
+    if (timer.expiryTick <= currentTick)
+    {
+        timer.expiryTick += ((currentTick - timer.expiryTick) / timer.periodInTicks + 1U) * timer.periodInTicks;
+    }
+
+    link(index);
+}
+
+} // namespace popo
+} // namespace iox
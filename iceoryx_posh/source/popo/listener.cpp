@@ -25,8 +25,23 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariableData) noexcept
-    : Parent(conditionVariableData)
+Listener::Listener(const WaitOptions& waitOptions) noexcept
+    : Parent(waitOptions)
+{
+}
+
+Listener::Listener(const ListenerOptions& options) noexcept
+    : Parent(options)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariableData, const WaitOptions& waitOptions) noexcept
+    : Parent(conditionVariableData, waitOptions)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options) noexcept
+    : Parent(conditionVariableData, options)
 {
 }
 
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
 {
@@ -69,6 +70,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    notifyDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -76,5 +78,27 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::notifyDiscovery() noexcept
+{
+    // the port is added only once to the dirty port list, the discovery reads the latest state when it processes it
+    auto dirtyPortList = getMembers()->m_dirtyPortListPtr.get();
+    if (dirtyPortList != nullptr && !getMembers()->m_isDirty.exchange(true, std::memory_order_acq_rel))
+    {
+        dirtyPortList->push(getMembers()->m_dirtyPort);
+    }
+
+    auto discoveryConditionVariableData = getMembers()->m_discoveryConditionVariableDataPtr.get();
+    if (discoveryConditionVariableData != nullptr)
+    {
+        ConditionNotifier(*discoveryConditionVariableData, BasePortData::DISCOVERY_NOTIFICATION_INDEX).notify();
+    }
+}
+
+void BasePort::resetDirtyFlag() noexcept
+{
+    // acquire synchronizes with the port which set the flag, therefore its latest state change is visible afterwards
+    getMembers()->m_isDirty.exchange(false, std::memory_order_acq_rel);
+}
+
 } // namespace popo
 } // namespace iox
@@ -21,6 +21,8 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t BasePortData::DISCOVERY_NOTIFICATION_INDEX;
+
 BasePortData::BasePortData(const capro::ServiceDescription& serviceDescription,
                            const RuntimeName_t& runtimeName,
                            const NodeName_t& nodeName) noexcept
@@ -47,6 +47,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -55,6 +56,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -88,6 +90,11 @@ bool SubscriberPortUser::hasLostChunksSinceLastCall() noexcept
     return m_chunkReceiver.hasLostChunks();
 }
 
+const std::atomic<uint64_t>& SubscriberPortUser::getNumberOfReceivedChunks() const noexcept
+{
+    return m_chunkReceiver.getNumberOfPushedChunks();
+}
+
 void SubscriberPortUser::setConditionVariable(ConditionVariableData& conditionVariableData,
                                               const uint64_t notificationIndex) noexcept
 {
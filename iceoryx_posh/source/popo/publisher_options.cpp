@@ -52,5 +52,11 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
     publisherOptions.subscriberTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
     return cxx::success<PublisherOptions>(publisherOptions);
 }
+
+bool PublisherOptions::operator==(const PublisherOptions& rhs) const noexcept
+{
+    return historyCapacity == rhs.historyCapacity && nodeName == rhs.nodeName && offerOnCreate == rhs.offerOnCreate
+           && subscriberTooSlowPolicy == rhs.subscriberTooSlowPolicy;
+}
 } // namespace popo
 } // namespace iox
@@ -28,7 +28,9 @@ cxx::Serialization SubscriberOptions::serialize() const noexcept
                                       nodeName,
                                       subscribeOnCreate,
                                       static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
-                                      requiresPublisherHistorySupport);
+                                      requiresPublisherHistorySupport,
+                                      useShardedQueue,
+                                      deadline.toNanoseconds());
 }
 
 cxx::expected<SubscriberOptions, cxx::Serialization::Error>
@@ -38,13 +40,16 @@ SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
 
     SubscriberOptions subscriberOptions;
     QueueFullPolicyUT queueFullPolicy;
+    uint64_t deadlineInNanoseconds{0U};
 
     auto deserializationSuccessful = serialized.extract(subscriberOptions.queueCapacity,
                                                         subscriberOptions.historyRequest,
                                                         subscriberOptions.nodeName,
                                                         subscriberOptions.subscribeOnCreate,
                                                         queueFullPolicy,
-                                                        subscriberOptions.requiresPublisherHistorySupport);
+                                                        subscriberOptions.requiresPublisherHistorySupport,
+                                                        subscriberOptions.useShardedQueue,
+                                                        deadlineInNanoseconds);
 
     if (!deserializationSuccessful
         || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA))
@@ -53,7 +58,16 @@ SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
     }
 
     subscriberOptions.queueFullPolicy = static_cast<QueueFullPolicy>(queueFullPolicy);
+    subscriberOptions.deadline = units::Duration::fromNanoseconds(deadlineInNanoseconds);
     return cxx::success<SubscriberOptions>(subscriberOptions);
 }
+
+bool SubscriberOptions::operator==(const SubscriberOptions& rhs) const noexcept
+{
+    return queueCapacity == rhs.queueCapacity && historyRequest == rhs.historyRequest && nodeName == rhs.nodeName
+           && subscribeOnCreate == rhs.subscribeOnCreate && queueFullPolicy == rhs.queueFullPolicy
+           && requiresPublisherHistorySupport == rhs.requiresPublisherHistorySupport
+           && useShardedQueue == rhs.useShardedQueue && deadline == rhs.deadline;
+}
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,71 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+TimerTrigger::TimerTrigger(const units::Duration period) noexcept
+    : m_period(period)
+{
+}
+
+void TimerTrigger::setPeriod(const units::Duration period) noexcept
+{
+    m_period = period;
+    if (m_trigger)
+    {
+        m_trigger.enableTimer(m_period);
+    }
+}
+
+units::Duration TimerTrigger::getPeriod() const noexcept
+{
+    return m_period;
+}
+
+bool TimerTrigger::hasTriggered() const noexcept
+{
+    return m_trigger.wasTriggered();
+}
+
+void TimerTrigger::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        m_trigger.invalidate();
+    }
+}
+
+void TimerTrigger::enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept
+{
+    m_trigger = std::move(triggerHandle);
+    if (!m_trigger.enableTimer(m_period))
+    {
+        LogWarn() << "The TimerTrigger is never triggered since its period is zero.";
+    }
+}
+
+void TimerTrigger::disableEvent() noexcept
+{
+    m_trigger.reset();
+}
+
+} // namespace popo
+} // namespace iox
@@ -27,9 +27,11 @@ TriggerHandle::TriggerHandle() noexcept
 
 TriggerHandle::TriggerHandle(ConditionVariableData& conditionVariableData,
                              const cxx::function<void(uint64_t)>& resetCallback,
-                             const uint64_t uniqueTriggerId) noexcept
+                             const uint64_t uniqueTriggerId,
+                             const EnableTimerCallback& enableTimerCallback) noexcept
     : m_conditionVariableDataPtr(&conditionVariableData)
     , m_resetCallback(resetCallback)
+    , m_enableTimerCallback(enableTimerCallback)
     , m_uniqueTriggerId(uniqueTriggerId)
 {
 }
@@ -40,6 +42,7 @@ TriggerHandle::TriggerHandle(TriggerHandle&& rhs) noexcept
         return rhs.m_conditionVariableDataPtr;
     }()}
     , m_resetCallback{std::move(rhs.m_resetCallback)}
+    , m_enableTimerCallback{std::move(rhs.m_enableTimerCallback)}
     , m_uniqueTriggerId{rhs.m_uniqueTriggerId}
 {
     rhs.invalidate();
@@ -58,6 +61,7 @@ TriggerHandle& TriggerHandle::operator=(TriggerHandle&& rhs) noexcept
 
         m_conditionVariableDataPtr = rhs.m_conditionVariableDataPtr;
         m_resetCallback = std::move(rhs.m_resetCallback);
+        m_enableTimerCallback = std::move(rhs.m_enableTimerCallback);
         m_uniqueTriggerId = rhs.m_uniqueTriggerId;
 
         rhs.invalidate();
@@ -98,11 +102,23 @@ bool TriggerHandle::wasTriggered() const noexcept
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (m_conditionVariableDataPtr != nullptr)
     {
-        return m_conditionVariableDataPtr->m_activeNotifications[m_uniqueTriggerId].load(std::memory_order_relaxed);
+        return m_conditionVariableDataPtr->isNotificationActive(m_uniqueTriggerId);
     }
     return false;
 }
 
+bool TriggerHandle::enableTimer(const units::Duration& period, const std::atomic<uint64_t>* activityCounter) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    if (!isValid())
+    {
+        return false;
+    }
+
+    return m_enableTimerCallback(m_uniqueTriggerId, period, activityCounter);
+}
+
 void TriggerHandle::reset() noexcept
 {
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
@@ -123,6 +139,7 @@ void TriggerHandle::invalidate() noexcept
 
     m_conditionVariableDataPtr = nullptr;
     m_resetCallback = [](auto) {};
+    m_enableTimerCallback = [](auto, auto&, auto) { return false; };
     m_uniqueTriggerId = Trigger::INVALID_TRIGGER_ID;
 }
 
@@ -0,0 +1,113 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/chunk_garbage_collector.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint64_t ChunkGarbageCollector::MAX_NUMBER_OF_MEMORY_MANAGERS;
+
+bool ChunkGarbageCollector::addMemoryManager(mepoo::MemoryManager& memoryManager) noexcept
+{
+    return m_memoryManagers.push_back(&memoryManager);
+}
+
+void ChunkGarbageCollector::beginCollection() noexcept
+{
+    ++m_collection;
+    for (auto memoryManager : m_memoryManagers)
+    {
+        memoryManager->startGarbageCollection(m_collection);
+    }
+    m_transfersBeforeMarking = TransferRecord();
+    m_transfersAfterMarking = TransferRecord();
+    m_isMarkingFinished = false;
+}
+
+void ChunkGarbageCollector::recordTransfers(const popo::ChunkTransferTracker& transferTracker) noexcept
+{
+    auto& transferRecord = m_isMarkingFinished ? m_transfersAfterMarking : m_transfersBeforeMarking;
+    auto numberOfStartedTransfers = transferTracker.getNumberOfStartedTransfers();
+    if (numberOfStartedTransfers.has_value())
+    {
+        transferRecord.sumOfStartedTransfers += numberOfStartedTransfers.value();
+    }
+    else
+    {
+        transferRecord.hasTransferInProgress = true;
+    }
+}
+
+void ChunkGarbageCollector::endMarking() noexcept
+{
+    // pairs with the release fence at the start of a transfer, when the marking observed a modification of the port
+    // data by a transfer, the second recording observes the start of this transfer
+    std::atomic_thread_fence(std::memory_order_acquire);
+    m_isMarkingFinished = true;
+}
+
+void ChunkGarbageCollector::markReferenced(const mepoo::ShmSafeUnmanagedChunk& chunk) noexcept
+{
+    const auto* address = chunk.getChunkManagementAddress();
+    if (address == nullptr)
+    {
+        return;
+    }
+
+    // the address could be stale or garbage, it is only accessed when it belongs to one of the memory managers
+    for (auto memoryManager : m_memoryManagers)
+    {
+        auto chunkManagement = memoryManager->findChunkManagement(address);
+        if (chunkManagement != nullptr)
+        {
+            chunkManagement->m_referencedInCollection.store(m_collection, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+cxx::optional<uint64_t> ChunkGarbageCollector::finishCollection() noexcept
+{
+    // the chunks which were transferred while the port data was inspected could have been missed by the marking
+    if (m_transfersBeforeMarking.hasTransferInProgress || m_transfersAfterMarking.hasTransferInProgress
+        || m_transfersBeforeMarking.sumOfStartedTransfers != m_transfersAfterMarking.sumOfStartedTransfers)
+    {
+        return cxx::nullopt;
+    }
+
+    uint64_t numberOfReclaimedChunks{0U};
+    for (auto memoryManager : m_memoryManagers)
+    {
+        // a chunk which was obtained after the collection was started, e.g. by a publisher after the second
+        // recording of the transfers, was neither marked nor observed by the recordings and must survive
+        memoryManager->forEachChunkManagement([&](mepoo::ChunkManagement& chunkManagement) {
+            if (chunkManagement.m_referenceCounter.load(std::memory_order_acquire) != 0U
+                && chunkManagement.m_obtainedInCollection.load(std::memory_order_relaxed) < m_collection
+                && chunkManagement.m_referencedInCollection.load(std::memory_order_relaxed) != m_collection)
+            {
+                memoryManager->reclaimChunk(chunkManagement);
+                ++numberOfReclaimedChunks;
+            }
+        });
+    }
+
+    return numberOfReclaimedChunks;
+}
+
+} // namespace roudi
+} // namespace iox
@@ -37,6 +37,8 @@ IceOryxRouDiComponents::IceOryxRouDiComponents(const RouDiConfig_t& roudiConfig)
         return &rouDiMemoryManager;
     }())
 {
+    // the runtimes are started after RouDi, therefore they find the ports of the static topology already connected
+    portManager.createStaticTopology(roudiConfig.m_staticConnections);
 }
 
 } // namespace roudi
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 
 namespace iox
@@ -58,6 +59,12 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {cxx::align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    // the changes of the service registry are queued by every ServiceDiscovery, when the chunks run out the
+    // subscribers miss changes and fall back to the complete service registry
+    constexpr uint32_t SERVICE_REGISTRY_CHANGE_CHUNK_COUNT{16U * SERVICE_REGISTRY_CHANGE_QUEUE_CAPACITY};
+    mempoolConfig.m_mempoolConfig.push_back(
+        {cxx::align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryChange)), ALIGNMENT),
+         SERVICE_REGISTRY_CHANGE_CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -19,10 +19,18 @@
 
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace roudi
 {
+PortPoolMemoryBlock::PortPoolMemoryBlock(const config::RouDiConfig& config) noexcept
+    : m_config(config)
+{
+    m_config.optimize();
+}
+
 PortPoolMemoryBlock::~PortPoolMemoryBlock() noexcept
 {
     destroy();
@@ -30,17 +38,21 @@ PortPoolMemoryBlock::~PortPoolMemoryBlock() noexcept
 
 uint64_t PortPoolMemoryBlock::size() const noexcept
 {
-    return sizeof(PortPoolData);
+    // the port data are stored behind the PortPoolData with the number of ports from the config
+    return cxx::align(sizeof(PortPoolData), posix::Allocator::MEMORY_ALIGNMENT)
+           + PortPoolData::requiredArenaMemorySize(m_config);
 }
 
 uint64_t PortPoolMemoryBlock::alignment() const noexcept
 {
-    return alignof(PortPoolData);
+    return std::max(alignof(PortPoolData), posix::Allocator::MEMORY_ALIGNMENT);
 }
 
 void PortPoolMemoryBlock::onMemoryAvailable(cxx::not_null<void*> memory) noexcept
 {
-    m_portPoolData = new (memory) PortPoolData;
+    posix::Allocator allocator(memory, size());
+    auto portPoolDataMemory = allocator.allocate(sizeof(PortPoolData), alignof(PortPoolData));
+    m_portPoolData = new (portPoolDataMemory) PortPoolData(m_config, allocator);
 }
 
 void PortPoolMemoryBlock::destroy() noexcept
@@ -20,9 +20,11 @@
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
@@ -52,6 +54,7 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
         errorHandler(PoshError::PORT_MANAGER__PORT_POOL_UNAVAILABLE, iox::ErrorLevel::FATAL);
     }
     m_portPool = maybePortPool.value();
+    m_discoveryConditionListener.emplace(m_portPool->getDiscoveryConditionVariableData());
 
     auto maybeIntrospectionMemoryManager = m_roudiMemoryInterface->introspectionMemoryManager();
     if (!maybeIntrospectionMemoryManager.has_value())
@@ -61,6 +64,19 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     }
     auto introspectionMemoryManager = maybeIntrospectionMemoryManager.value();
 
+    // the chunks of all memory managers are inspected by the collection of leaked chunks
+    m_chunkGarbageCollector.addMemoryManager(*introspectionMemoryManager);
+    auto maybeSegmentManager = m_roudiMemoryInterface->segmentManager();
+    if (maybeSegmentManager.has_value())
+    {
+        maybeSegmentManager.value()->forEachMemoryManager([this](mepoo::MemoryManager& memoryManager) {
+            if (!m_chunkGarbageCollector.addMemoryManager(memoryManager))
+            {
+                LogWarn() << "Too many memory managers! The chunks of some segments are not reclaimed when they leak.";
+            }
+        });
+    }
+
     popo::PublisherOptions registryPortOptions;
     registryPortOptions.historyCapacity = 1U;
     registryPortOptions.nodeName = iox::NodeName_t("Service Registry");
@@ -72,9 +88,21 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
         registryPortOptions,
         introspectionMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    // the changes are only of interest after they were published, therefore no history is kept
+    popo::PublisherOptions registryChangePortOptions;
+    registryChangePortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryChangePortOptions.offerOnCreate = true;
+
+    m_serviceRegistryChangePublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGE_EVENT_NAME},
+        registryChangePortOptions,
+        introspectionMemoryManager);
+
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryChangePort(*m_serviceRegistryChangePublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryChangePort);
 
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
@@ -102,19 +130,134 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
-    handlePublisherPorts();
+    // the state changes of the ports which did not fit into the dirty port list are only found by visiting all ports
+    if (m_portPool->getDirtyPortList().checkAndResetOverflow())
+    {
+        handlePublisherPorts();
 
-    handleSubscriberPorts();
+        handleSubscriberPorts();
 
-    handleServerPorts();
+        handleServerPorts();
 
-    handleClientPorts();
+        handleClientPorts();
+    }
+
+    handleDirtyPorts();
 
     handleInterfaces();
 
     handleNodes();
 
     handleConditionVariables();
+
+    collectLeakedChunks();
+
+    // the changes are published immediately, the complete registry only once per discovery run
+    if (m_serviceRegistry.generation() != m_publishedServiceRegistryGeneration)
+    {
+        publishServiceRegistry();
+    }
+}
+
+void PortManager::collectLeakedChunks() noexcept
+{
+    if (!m_chunkGarbageCollectionRequested)
+    {
+        return;
+    }
+
+    // a collection is discarded as long as a port is blocked in a transfer, e.g. a publisher which waits for a full
+    // queue, the interval prevents that the ports are inspected in every discovery run in this case
+    auto now = mepoo::BaseClock_t::now();
+    if (units::Duration(now - m_lastChunkGarbageCollection) < CHUNK_GARBAGE_COLLECTION_INTERVAL)
+    {
+        return;
+    }
+    m_lastChunkGarbageCollection = now;
+
+    m_chunkGarbageCollector.beginCollection();
+    recordChunkTransfers();
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        m_chunkGarbageCollector.markChunksOfSender(publisherPortData->m_chunkSenderData);
+    }
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    {
+        m_chunkGarbageCollector.markChunksOfReceiver(subscriberPortData->m_chunkReceiverData);
+    }
+    for (auto clientPortData : m_portPool->getClientPortDataList())
+    {
+        m_chunkGarbageCollector.markChunksOfSender(clientPortData->m_chunkSenderData);
+        m_chunkGarbageCollector.markChunksOfReceiver(clientPortData->m_chunkReceiverData);
+    }
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        m_chunkGarbageCollector.markChunksOfSender(serverPortData->m_chunkSenderData);
+        m_chunkGarbageCollector.markChunksOfReceiver(serverPortData->m_chunkReceiverData);
+    }
+    m_chunkGarbageCollector.endMarking();
+    recordChunkTransfers();
+
+    m_chunkGarbageCollector.finishCollection().and_then([this](const uint64_t numberOfReclaimedChunks) {
+        m_chunkGarbageCollectionRequested = false;
+        if (numberOfReclaimedChunks > 0U)
+        {
+            LogWarn() << "Reclaimed " << numberOfReclaimedChunks
+                      << " chunks which were leaked by terminated processes";
+        }
+    });
+}
+
+void PortManager::recordChunkTransfers() noexcept
+{
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        m_chunkGarbageCollector.recordTransfers(publisherPortData->m_chunkSenderData.m_transferTracker);
+    }
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    {
+        m_chunkGarbageCollector.recordTransfers(subscriberPortData->m_chunkReceiverData.m_transferTracker);
+    }
+    for (auto clientPortData : m_portPool->getClientPortDataList())
+    {
+        m_chunkGarbageCollector.recordTransfers(clientPortData->m_chunkSenderData.m_transferTracker);
+        m_chunkGarbageCollector.recordTransfers(clientPortData->m_chunkReceiverData.m_transferTracker);
+    }
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        m_chunkGarbageCollector.recordTransfers(serverPortData->m_chunkSenderData.m_transferTracker);
+        m_chunkGarbageCollector.recordTransfers(serverPortData->m_chunkReceiverData.m_transferTracker);
+    }
+}
+
+bool PortManager::waitForDiscoveryRequest(const units::Duration& timeout) noexcept
+{
+    return !m_discoveryConditionListener->timedWait(timeout).empty();
+}
+
+void PortManager::requestDiscovery() noexcept
+{
+    popo::ConditionNotifier(m_portPool->getDiscoveryConditionVariableData(),
+                            popo::BasePortData::DISCOVERY_NOTIFICATION_INDEX)
+        .notify();
+}
+
+cxx::optional<runtime::CommandChannel*>
+PortManager::waitForCommandChannelRequest(const units::Duration& timeout) noexcept
+{
+    auto index = m_portPool->getCommandChannelQueue().timedPop(timeout);
+    if (!index.has_value())
+    {
+        return cxx::nullopt;
+    }
+
+    auto commandChannel = m_portPool->getCommandChannel(index.value());
+    if (commandChannel == nullptr)
+    {
+        LogWarn() << "A request was submitted to the invalid command channel " << index.value();
+        return cxx::nullopt;
+    }
+    return commandChannel;
 }
 
 void PortManager::handlePublisherPorts() noexcept
@@ -122,15 +265,21 @@ void PortManager::handlePublisherPorts() noexcept
     // get the changes of publisher port offer state
     for (auto publisherPortData : m_portPool->getPublisherPortDataList())
     {
-        PublisherPortRouDiType publisherPort(publisherPortData);
+        handlePublisherPort(publisherPortData);
+    }
+}
 
-        doDiscoveryForPublisherPort(publisherPort);
+void PortManager::handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
+{
+    PublisherPortRouDiType publisherPort(publisherPortData);
+    publisherPort.resetDirtyFlag();
 
-        // check if we have to destroy this publisher port
-        if (publisherPort.toBeDestroyed())
-        {
-            destroyPublisherPort(publisherPortData);
-        }
+    doDiscoveryForPublisherPort(publisherPort);
+
+    // check if we have to destroy this publisher port
+    if (publisherPort.toBeDestroyed())
+    {
+        destroyPublisherPort(publisherPortData);
     }
 }
 
@@ -167,15 +316,21 @@ void PortManager::handleSubscriberPorts() noexcept
     // get requests for change of subscription state of subscribers
     for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
     {
-        SubscriberPortType subscriberPort(subscriberPortData);
+        handleSubscriberPort(subscriberPortData);
+    }
+}
 
-        doDiscoveryForSubscriberPort(subscriberPort);
+void PortManager::handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    SubscriberPortType subscriberPort(subscriberPortData);
+    subscriberPort.resetDirtyFlag();
 
-        // check if we have to destroy this subscriber port
-        if (subscriberPort.toBeDestroyed())
-        {
-            destroySubscriberPort(subscriberPortData);
-        }
+    doDiscoveryForSubscriberPort(subscriberPort);
+
+    // check if we have to destroy this subscriber port
+    if (subscriberPort.toBeDestroyed())
+    {
+        destroySubscriberPort(subscriberPortData);
     }
 }
 
@@ -236,6 +391,8 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
                << "' and with service description '" << clientPortData->m_serviceDescription << "'";
 
     // delete client port from list after DISCONNECT was processed
+    m_clientIndex.remove(clientPortData);
+    m_clientsOfRuntime.remove(clientPortData);
     m_portPool->removeClientPort(clientPortData);
 }
 
@@ -244,15 +401,21 @@ void PortManager::handleClientPorts() noexcept
     // get requests for change of connection state of clients
     for (auto clientPortData : m_portPool->getClientPortDataList())
     {
-        popo::ClientPortRouDi clientPort(*clientPortData);
+        handleClientPort(clientPortData);
+    }
+}
 
-        doDiscoveryForClientPort(clientPort);
+void PortManager::handleClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
+    popo::ClientPortRouDi clientPort(*clientPortData);
+    clientPort.resetDirtyFlag();
 
-        // check if we have to destroy this clinet port
-        if (clientPort.toBeDestroyed())
-        {
-            destroyClientPort(clientPortData);
-        }
+    doDiscoveryForClientPort(clientPort);
+
+    // check if we have to destroy this clinet port
+    if (clientPort.toBeDestroyed())
+    {
+        destroyClientPort(clientPortData);
     }
 }
 
@@ -325,6 +488,8 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
                << "' and with service description '" << serverPortData->m_serviceDescription << "'";
 
     // delete server port from list after STOP_OFFER was processed
+    m_serverIndex.remove(serverPortData);
+    m_serversOfRuntime.remove(serverPortData);
     m_portPool->removeServerPort(serverPortData);
 }
 
@@ -333,15 +498,21 @@ void PortManager::handleServerPorts() noexcept
     // get the changes of server port offer state
     for (auto serverPortData : m_portPool->getServerPortDataList())
     {
-        popo::ServerPortRouDi serverPort(*serverPortData);
+        handleServerPort(serverPortData);
+    }
+}
 
-        doDiscoveryForServerPort(serverPort);
+void PortManager::handleServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
+    popo::ServerPortRouDi serverPort(*serverPortData);
+    serverPort.resetDirtyFlag();
 
-        // check if we have to destroy this server port
-        if (serverPort.toBeDestroyed())
-        {
-            destroyServerPort(serverPortData);
-        }
+    doDiscoveryForServerPort(serverPort);
+
+    // check if we have to destroy this server port
+    if (serverPort.toBeDestroyed())
+    {
+        destroyServerPort(serverPortData);
     }
 }
 
@@ -372,6 +543,65 @@ void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) no
     });
 }
 
+void PortManager::handleDirtyPorts() noexcept
+{
+    auto& dirtyPortList = m_portPool->getDirtyPortList();
+
+    // the ports can add themselves again while they are processed, the number of processed ports is therefore
+    // limited to keep the discovery run finite
+    for (uint64_t i = 0U; i < popo::DirtyPortList::CAPACITY; ++i)
+    {
+        auto dirtyPort = dirtyPortList.pop();
+        if (!dirtyPort.has_value())
+        {
+            return;
+        }
+
+        // a port which was removed in the meantime is skipped, when its slot is already reused the discovery
+        // just runs once more for the new port
+        const auto index = dirtyPort->index;
+        switch (dirtyPort->kind)
+        {
+        case popo::DirtyPortKind::PUBLISHER:
+        {
+            auto publisherPortData = m_portPool->getPublisherPortData(index);
+            if (publisherPortData != nullptr)
+            {
+                handlePublisherPort(publisherPortData);
+            }
+            break;
+        }
+        case popo::DirtyPortKind::SUBSCRIBER:
+        {
+            auto subscriberPortData = m_portPool->getSubscriberPortData(index);
+            if (subscriberPortData != nullptr)
+            {
+                handleSubscriberPort(subscriberPortData);
+            }
+            break;
+        }
+        case popo::DirtyPortKind::CLIENT:
+        {
+            auto clientPortData = m_portPool->getClientPortData(index);
+            if (clientPortData != nullptr)
+            {
+                handleClientPort(clientPortData);
+            }
+            break;
+        }
+        case popo::DirtyPortKind::SERVER:
+        {
+            auto serverPortData = m_portPool->getServerPortData(index);
+            if (serverPortData != nullptr)
+            {
+                handleServerPort(serverPortData);
+            }
+            break;
+        }
+        }
+    }
+}
+
 void PortManager::handleInterfaces() noexcept
 {
     // check if there are new interfaces that must get an initial offer information
@@ -391,6 +621,7 @@ void PortManager::handleInterfaces() noexcept
         {
             LogDebug() << "Destroy interface port from runtime '" << interfacePortData->m_runtimeName
                        << "' and with service description '" << interfacePortData->m_serviceDescription << "'";
+            m_interfacesOfRuntime.remove(interfacePortData);
             m_portPool->removeInterfacePort(interfacePortData);
         }
     }
@@ -455,6 +686,7 @@ void PortManager::handleNodes() noexcept
         {
             LogDebug() << "Destroy NodeData from runtime '" << nodeData->m_runtimeName << "' and node name '"
                        << nodeData->m_nodeName << "'";
+            m_nodesOfRuntime.remove(nodeData);
             m_portPool->removeNodeData(nodeData);
         }
     }
@@ -467,6 +699,7 @@ void PortManager::handleConditionVariables() noexcept
         if (conditionVariableData->m_toBeDestroyed.load(std::memory_order_relaxed))
         {
             LogDebug() << "Destroy ConditionVariableData from runtime '" << conditionVariableData->m_runtimeName << "'";
+            m_conditionVariablesOfRuntime.remove(conditionVariableData);
             m_portPool->removeConditionVariableData(conditionVariableData);
         }
     }
@@ -496,8 +729,8 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
-    {
+    // only the publishers with the service description of the subscriber can be compatible
+    m_publisherIndex.forEach(subscriberSource.getCaProServiceDescription(), [&](auto publisherPortData) {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
@@ -507,7 +740,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
         {
-            break;
+            return;
         }
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
@@ -527,15 +760,15 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
             }
             publisherFound = true;
         }
-    }
+    });
     return publisherFound;
 }
 
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
+    // only the subscribers with the service description of the publisher can be compatible
+    m_subscriberIndex.forEach(publisherSource.getCaProServiceDescription(), [&](auto subscriberPortData) {
         SubscriberPortType subscriberPort(subscriberPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
@@ -545,7 +778,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
-            break;
+            return;
         }
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
@@ -577,7 +810,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
@@ -600,8 +833,8 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto clientPortData : m_portPool->getClientPortDataList())
-    {
+    // only the clients with the service description of the server can be compatible
+    m_clientIndex.forEach(serverSource.getCaProServiceDescription(), [&](auto clientPortData) {
         popo::ClientPortRouDi clientPort(*clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
         {
@@ -630,15 +863,15 @@ void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& messag
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& message,
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto serverPortData : m_portPool->getServerPortDataList())
-    {
+    // only the servers with the service description of the client can be compatible
+    m_serverIndex.forEach(clientSource.getCaProServiceDescription(), [&](auto serverPortData) {
         popo::ServerPortRouDi serverPort(*serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
         {
@@ -658,7 +891,7 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
             }
             serverFound = true;
         }
-    }
+    });
     return serverFound;
 }
 
@@ -701,6 +934,8 @@ void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexc
 
 void PortManager::unblockRouDiShutdown() noexcept
 {
+    // the ports of the runtimes which terminate while RouDi shuts down must not be connected again
+    m_restoreStaticPorts = false;
     makeAllPublisherPortsToStopOffer();
     makeAllServerPortsToStopOffer();
 }
@@ -722,70 +957,65 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
-    }
-    for (auto port : m_portPool->getPublisherPortDataList())
-    {
-        PublisherPortRouDiType sender(port);
-        if (runtimeName == sender.getRuntimeName())
-        {
-            destroyPublisherPort(port);
-        }
+        m_serviceRegistryChangePublisherPortData.reset();
     }
 
-    for (auto port : m_portPool->getSubscriberPortDataList())
-    {
-        SubscriberPortUserType subscriber(port);
-        if (runtimeName == subscriber.getRuntimeName())
+    // the ports of the static topology are destroyed like the other ports and restored afterwards
+    auto removeUntakenStaticPortsOfRuntime = [&](auto& untakenStaticPorts) {
+        auto iter = untakenStaticPorts.begin();
+        while (iter != untakenStaticPorts.end())
         {
-            destroySubscriberPort(port);
+            if ((*iter)->m_runtimeName == runtimeName)
+            {
+                untakenStaticPorts.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
         }
-    }
+    };
+    removeUntakenStaticPortsOfRuntime(m_untakenStaticPublishers);
+    removeUntakenStaticPortsOfRuntime(m_untakenStaticSubscribers);
+
+    // only the data of the runtime is visited, independent of the number of ports of other runtimes
+    m_publishersOfRuntime.forEach(runtimeName, [&](auto port) { destroyPublisherPort(port); });
+    m_subscribersOfRuntime.forEach(runtimeName, [&](auto port) { destroySubscriberPort(port); });
+    m_serversOfRuntime.forEach(runtimeName, [&](auto port) { destroyServerPort(port); });
+    m_clientsOfRuntime.forEach(runtimeName, [&](auto port) { destroyClientPort(port); });
+
+    m_interfacesOfRuntime.forEach(runtimeName, [&](auto port) {
+        m_interfacesOfRuntime.remove(port);
+        m_portPool->removeInterfacePort(port);
+        LogDebug() << "Deleted Interface of application " << runtimeName;
+    });
 
-    for (auto port : m_portPool->getServerPortDataList())
-    {
-        popo::ServerPortRouDi server(*port);
-        if (runtimeName == server.getRuntimeName())
-        {
-            destroyServerPort(port);
-        }
-    }
+    m_nodesOfRuntime.forEach(runtimeName, [&](auto nodeData) {
+        m_nodesOfRuntime.remove(nodeData);
+        m_portPool->removeNodeData(nodeData);
+        LogDebug() << "Deleted node of application " << runtimeName;
+    });
 
-    for (auto port : m_portPool->getClientPortDataList())
-    {
-        popo::ClientPortRouDi client(*port);
-        if (runtimeName == client.getRuntimeName())
-        {
-            destroyClientPort(port);
-        }
-    }
+    m_conditionVariablesOfRuntime.forEach(runtimeName, [&](auto conditionVariableData) {
+        m_conditionVariablesOfRuntime.remove(conditionVariableData);
+        m_portPool->removeConditionVariableData(conditionVariableData);
+        LogDebug() << "Deleted condition variable of application" << runtimeName;
+    });
 
-    for (auto port : m_portPool->getInterfacePortDataList())
-    {
-        popo::InterfacePort interface(port);
-        if (runtimeName == interface.getRuntimeName())
-        {
-            m_portPool->removeInterfacePort(port);
-            LogDebug() << "Deleted Interface of application " << runtimeName;
-        }
-    }
+    m_heartbeatsOfRuntime.forEach(runtimeName, [&](auto heartbeat) {
+        m_heartbeatsOfRuntime.remove(heartbeat);
+        m_portPool->removeHeartbeat(heartbeat);
+        LogDebug() << "Deleted heartbeat of application " << runtimeName;
+    });
 
-    for (auto nodeData : m_portPool->getNodeDataList())
+    // a restarted runtime takes the connected ports again
+    if (m_restoreStaticPorts)
     {
-        if (runtimeName == nodeData->m_runtimeName)
-        {
-            m_portPool->removeNodeData(nodeData);
-            LogDebug() << "Deleted node of application " << runtimeName;
-        }
+        createStaticPortsOfRuntime(runtimeName);
     }
 
-    for (auto conditionVariableData : m_portPool->getConditionVariableDataList())
-    {
-        if (runtimeName == conditionVariableData->m_runtimeName)
-        {
-            m_portPool->removeConditionVariableData(conditionVariableData);
-            LogDebug() << "Deleted condition variable of application" << runtimeName;
-        }
-    }
+    // the process could have terminated while it held chunks which are not referenced by its port data
+    m_chunkGarbageCollectionRequested = true;
 }
 
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
@@ -813,6 +1043,8 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     LogDebug() << "Destroy publisher port from runtime '" << publisherPortData->m_runtimeName
                << "' and with service description '" << publisherPortData->m_serviceDescription << "'";
     // delete publisher port from list after STOP_OFFER was processed
+    m_publisherIndex.remove(publisherPortData);
+    m_publishersOfRuntime.remove(publisherPortData);
     m_portPool->removePublisherPort(publisherPortData);
 }
 
@@ -839,9 +1071,203 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
     LogDebug() << "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
                << "' and with service description '" << subscriberPortData->m_serviceDescription << "'";
     // delete subscriber port from list after UNSUB was processed
+    m_subscriberIndex.remove(subscriberPortData);
+    m_subscribersOfRuntime.remove(subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
+void PortManager::createStaticTopology(const config::RouDiConfig::StaticConnections_t& staticConnections) noexcept
+{
+    m_staticConnections = staticConnections;
+
+    // the publishers are created first, the subscribers are then connected when they are created
+    for (const auto& connection : m_staticConnections)
+    {
+        createStaticPublisherPort(connection);
+    }
+    for (const auto& connection : m_staticConnections)
+    {
+        for (const auto& subscriberRuntimeName : connection.m_subscriberRuntimeNames)
+        {
+            createStaticSubscriberPort(connection, subscriberRuntimeName);
+        }
+    }
+}
+
+void PortManager::createStaticPortsOfRuntime(const RuntimeName_t& runtimeName) noexcept
+{
+    for (const auto& connection : m_staticConnections)
+    {
+        if (connection.m_publisherRuntimeName == runtimeName)
+        {
+            createStaticPublisherPort(connection);
+        }
+    }
+    for (const auto& connection : m_staticConnections)
+    {
+        for (const auto& subscriberRuntimeName : connection.m_subscriberRuntimeNames)
+        {
+            if (subscriberRuntimeName == runtimeName)
+            {
+                createStaticSubscriberPort(connection, subscriberRuntimeName);
+            }
+        }
+    }
+}
+
+void PortManager::createStaticPublisherPort(const config::StaticConnection& connection) noexcept
+{
+    // the user of the runtime is not known before it registers, therefore the publisher is created in the segment
+    // RouDi can write to and is replaced by a new port if the runtime writes to another segment
+    auto maybeSegmentManager = m_roudiMemoryInterface->segmentManager();
+    if (!maybeSegmentManager.has_value())
+    {
+        LogWarn() << "Could not create the static publisher port of '" << connection.m_publisherRuntimeName
+                  << "' with service description '" << connection.m_service << "' without a segment manager";
+        return;
+    }
+    auto segmentInfo = maybeSegmentManager.value()->getSegmentInformationWithWriteAccessForUser(
+        posix::PosixUser::getUserOfCurrentProcess());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        LogWarn() << "Could not create the static publisher port of '" << connection.m_publisherRuntimeName
+                  << "' with service description '" << connection.m_service << "' without a writable segment";
+        return;
+    }
+
+    popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = connection.m_historyCapacity;
+
+    acquirePublisherPortDataWithoutDiscovery(connection.m_service,
+                                             publisherOptions,
+                                             connection.m_publisherRuntimeName,
+                                             &segmentInfo.m_memoryManager.value().get(),
+                                             PortConfigInfo())
+        .and_then([&](auto publisherPortData) {
+            PublisherPortRouDiType port(publisherPortData);
+            this->doDiscoveryForPublisherPort(port);
+            m_untakenStaticPublishers.push_back(publisherPortData);
+        })
+        .or_else([&](auto&) {
+            LogWarn() << "Could not create the static publisher port of '" << connection.m_publisherRuntimeName
+                      << "' with service description '" << connection.m_service << "'";
+        });
+}
+
+void PortManager::createStaticSubscriberPort(const config::StaticConnection& connection,
+                                             const RuntimeName_t& runtimeName) noexcept
+{
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = connection.m_queueCapacity;
+    subscriberOptions.historyRequest = connection.m_historyCapacity;
+
+    acquireNewSubscriberPortData(connection.m_service, subscriberOptions, runtimeName, PortConfigInfo())
+        .and_then([&](auto subscriberPortData) { m_untakenStaticSubscribers.push_back(subscriberPortData); })
+        .or_else([&](auto&) {
+            LogWarn() << "Could not create the static subscriber port of '" << runtimeName
+                      << "' with service description '" << connection.m_service << "'";
+        });
+}
+
+cxx::optional<PublisherPortRouDiType::MemberType_t*>
+PortManager::takeStaticPublisherPortData(const capro::ServiceDescription& service,
+                                         const popo::PublisherOptions& publisherOptions,
+                                         const RuntimeName_t& runtimeName,
+                                         mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto iter = std::find_if(m_untakenStaticPublishers.begin(), m_untakenStaticPublishers.end(), [&](auto port) {
+        return port->m_runtimeName == runtimeName && port->m_serviceDescription == service;
+    });
+    if (iter == m_untakenStaticPublishers.end())
+    {
+        return cxx::nullopt;
+    }
+    auto publisherPortData = *iter;
+    m_untakenStaticPublishers.erase(iter);
+
+    if (publisherPortData->m_chunkSenderData.m_memoryMgr.get() != payloadDataSegmentMemoryManager)
+    {
+        LogWarn() << "The static publisher port of '" << runtimeName << "' with service description '" << service
+                  << "' is not in the segment of the runtime and is replaced by a new port";
+        destroyPublisherPort(publisherPortData);
+        return cxx::nullopt;
+    }
+
+    // the runtime decides whether the port is offered, every other option must match the options of the connection
+    auto requestedOptions = publisherOptions;
+    requestedOptions.offerOnCreate = publisherPortData->m_options.offerOnCreate;
+    if (!(requestedOptions == publisherPortData->m_options)
+        || !isPortConfigInfoOfStaticPort(portConfigInfo, publisherPortData->m_chunkSenderData.m_memoryInfo))
+    {
+        LogWarn() << "The static publisher port of '" << runtimeName << "' with service description '" << service
+                  << "' does not match the requested options and is replaced by a new port";
+        destroyPublisherPort(publisherPortData);
+        return cxx::nullopt;
+    }
+
+    // the port was offered when it was created, the runtime decides whether it stays offered
+    if (!publisherOptions.offerOnCreate)
+    {
+        publisherPortData->m_offeringRequested.store(false, std::memory_order_relaxed);
+        PublisherPortRouDiType port(publisherPortData);
+        doDiscoveryForPublisherPort(port);
+    }
+
+    LogDebug() << "Handed over the static publisher port with service description '" << service << "' to '"
+               << runtimeName << "'";
+    return publisherPortData;
+}
+
+cxx::optional<SubscriberPortType::MemberType_t*>
+PortManager::takeStaticSubscriberPortData(const capro::ServiceDescription& service,
+                                          const popo::SubscriberOptions& subscriberOptions,
+                                          const RuntimeName_t& runtimeName,
+                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto iter = std::find_if(m_untakenStaticSubscribers.begin(), m_untakenStaticSubscribers.end(), [&](auto port) {
+        return port->m_runtimeName == runtimeName && port->m_serviceDescription == service;
+    });
+    if (iter == m_untakenStaticSubscribers.end())
+    {
+        return cxx::nullopt;
+    }
+    auto subscriberPortData = *iter;
+    m_untakenStaticSubscribers.erase(iter);
+
+    // the runtime decides whether the port is subscribed, every other option must match the options of the connection
+    auto requestedOptions = subscriberOptions;
+    requestedOptions.subscribeOnCreate = subscriberPortData->m_options.subscribeOnCreate;
+    if (!(requestedOptions == subscriberPortData->m_options)
+        || !isPortConfigInfoOfStaticPort(portConfigInfo, subscriberPortData->m_chunkReceiverData.m_memoryInfo))
+    {
+        LogWarn() << "The static subscriber port of '" << runtimeName << "' with service description '" << service
+                  << "' does not match the requested options and is replaced by a new port";
+        destroySubscriberPort(subscriberPortData);
+        return cxx::nullopt;
+    }
+
+    // the port was subscribed when it was created, the runtime decides whether it stays subscribed
+    if (!subscriberOptions.subscribeOnCreate)
+    {
+        subscriberPortData->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        SubscriberPortType port(subscriberPortData);
+        doDiscoveryForSubscriberPort(port);
+    }
+
+    LogDebug() << "Handed over the static subscriber port with service description '" << service << "' to '"
+               << runtimeName << "'";
+    return subscriberPortData;
+}
+
+bool PortManager::isPortConfigInfoOfStaticPort(const PortConfigInfo& portConfigInfo,
+                                               const mepoo::MemoryInfo& memoryInfoOfStaticPort) noexcept
+{
+    // the port type is not stored in the port data, the ports of the static topology have the default port type
+    return portConfigInfo.portType == PortConfigInfo::DEFAULT_PORT_TYPE
+           && portConfigInfo.memoryInfo == memoryInfoOfStaticPort;
+}
+
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       const popo::PublisherOptions& publisherOptions,
@@ -849,6 +1275,13 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                       const PortConfigInfo& portConfigInfo) noexcept
 {
+    auto staticPublisherPortData = takeStaticPublisherPortData(
+        service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo);
+    if (staticPublisherPortData.has_value())
+    {
+        return cxx::success<PublisherPortRouDiType::MemberType_t*>(staticPublisherPortData.value());
+    }
+
     return acquirePublisherPortDataWithoutDiscovery(
                service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo)
         .and_then([&](auto publisherPortData) {
@@ -895,6 +1328,9 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            const bool isIndexed =
+                m_publisherIndex.add(publisherPortData) && m_publishersOfRuntime.add(publisherPortData);
+            cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
             m_portIntrospection.addPublisher(*publisherPortData);
         }
     }
@@ -940,6 +1376,22 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
                                        const popo::SubscriberOptions& subscriberOptions,
                                        const RuntimeName_t& runtimeName,
                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto staticSubscriberPortData =
+        takeStaticSubscriberPortData(service, subscriberOptions, runtimeName, portConfigInfo);
+    if (staticSubscriberPortData.has_value())
+    {
+        return cxx::success<SubscriberPortType::MemberType_t*>(staticSubscriberPortData.value());
+    }
+
+    return acquireNewSubscriberPortData(service, subscriberOptions, runtimeName, portConfigInfo);
+}
+
+cxx::expected<SubscriberPortType::MemberType_t*, PortPoolError>
+PortManager::acquireNewSubscriberPortData(const capro::ServiceDescription& service,
+                                          const popo::SubscriberOptions& subscriberOptions,
+                                          const RuntimeName_t& runtimeName,
+                                          const PortConfigInfo& portConfigInfo) noexcept
 {
     auto maybeSubscriberPortData =
         m_portPool->addSubscriberPort(service, runtimeName, subscriberOptions, portConfigInfo.memoryInfo);
@@ -948,6 +1400,9 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         auto subscriberPortData = maybeSubscriberPortData.value();
         if (subscriberPortData)
         {
+            const bool isIndexed =
+                m_subscriberIndex.add(subscriberPortData) && m_subscribersOfRuntime.add(subscriberPortData);
+            cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
@@ -970,6 +1425,8 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
     return m_portPool
         ->addClientPort(service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto clientPortData) {
+            const bool isIndexed = m_clientIndex.add(clientPortData) && m_clientsOfRuntime.add(clientPortData);
+            cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the client if offer on create is desired
@@ -987,28 +1444,33 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
 {
     // it is not allowed to have two servers with the same ServiceDescription;
     // check if the server is already in the list
-    for (const auto serverPortData : m_portPool->getServerPortDataList())
-    {
-        if (service == serverPortData->m_serviceDescription)
+    cxx::optional<RuntimeName_t> usedByProcess;
+    m_serverIndex.forEach(service, [&](auto serverPortData) {
+        if (serverPortData->m_toBeDestroyed)
         {
-            if (serverPortData->m_toBeDestroyed)
-            {
-                destroyServerPort(serverPortData);
-                continue;
-            }
-            LogWarn() << "Process '" << runtimeName
-                      << "' violates the communication policy by requesting a ServerPort which is already used by '"
-                      << serverPortData->m_runtimeName << "' with service '"
-                      << service.operator cxx::Serialization().toString() << "'.";
-            errorHandler(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, ErrorLevel::MODERATE);
-            return cxx::error<PortPoolError>(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
+            destroyServerPort(serverPortData);
+        }
+        else if (!usedByProcess.has_value())
+        {
+            usedByProcess.emplace(serverPortData->m_runtimeName);
         }
+    });
+    if (usedByProcess.has_value())
+    {
+        LogWarn() << "Process '" << runtimeName
+                  << "' violates the communication policy by requesting a ServerPort which is already used by '"
+                  << usedByProcess.value() << "' with service '" << service.operator cxx::Serialization().toString()
+                  << "'.";
+        errorHandler(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, ErrorLevel::MODERATE);
+        return cxx::error<PortPoolError>(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
     }
 
     // we can create a new port
     return m_portPool
         ->addServerPort(service, payloadDataSegmentMemoryManager, runtimeName, serverOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto serverPortData) {
+            const bool isIndexed = m_serverIndex.add(serverPortData) && m_serversOfRuntime.add(serverPortData);
+            cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the waiting client if offer on create is desired
@@ -1025,6 +1487,8 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     auto result = m_portPool->addInterfacePort(runtimeName, interface);
     if (!result.has_error())
     {
+        const bool isIndexed = m_interfacesOfRuntime.add(result.value());
+        cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
         return result.value();
     }
     else
@@ -1033,7 +1497,7 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     }
 }
 
-void PortManager::publishServiceRegistry() const noexcept
+void PortManager::publishServiceRegistry() noexcept
 {
     if (!m_serviceRegistryPublisherPortData.has_value())
     {
@@ -1053,10 +1517,48 @@ void PortManager::publishServiceRegistry() const noexcept
             new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry);
 
             publisher.sendChunk(chunk);
+            m_publishedServiceRegistryGeneration = m_serviceRegistry.generation();
         })
         .or_else([](auto&) { LogWarn() << "Could not allocate a chunk for the service registry!"; });
 }
 
+void PortManager::publishServiceRegistryChange(const ServiceRegistryChange::Type type,
+                                               const capro::ServiceDescription& service) noexcept
+{
+    // e.g. a full registry or the removal of a service which was not registered does not modify the registry
+    if (m_serviceRegistry.generation() == m_publishedServiceRegistryChangeGeneration)
+    {
+        return;
+    }
+    m_publishedServiceRegistryChangeGeneration = m_serviceRegistry.generation();
+
+    if (!m_serviceRegistryChangePublisherPortData.has_value())
+    {
+        // should not happen (except during RouDi shutdown)
+        LogWarn() << "Could not publish service registry change!";
+        return;
+    }
+    // a change which is not published is detected as gap by the subscribers which then use the complete registry
+    PublisherPortUserType publisher(m_serviceRegistryChangePublisherPortData.value());
+    publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryChange),
+                          alignof(ServiceRegistryChange),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            auto change = new (chunk->userPayload()) ServiceRegistryChange();
+            change->generation = m_serviceRegistry.generation();
+            change->type = type;
+            change->serviceDescription = service;
+
+            publisher.sendChunk(chunk);
+        })
+        .or_else([](auto&) { LogWarn() << "Could not allocate a chunk for the service registry change!"; });
+
+    // the complete registry is published by the next discovery run, the change may have happened outside of it
+    requestDiscovery();
+}
+
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 {
     return m_serviceRegistry;
@@ -1068,13 +1570,13 @@ void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription&
         LogWarn() << "Could not add publisher with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChange::Type::ADD_PUBLISHER, service);
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChange::Type::REMOVE_PUBLISHER, service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
@@ -1083,25 +1585,54 @@ void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& se
         LogWarn() << "Could not add server with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChange::Type::ADD_SERVER, service);
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChange::Type::REMOVE_SERVER, service);
 }
 
 cxx::expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
                                                                               const NodeName_t& nodeName) noexcept
 {
-    return m_portPool->addNodeData(runtimeName, nodeName, 0);
+    return m_portPool->addNodeData(runtimeName, nodeName, 0).and_then([this](auto nodeData) {
+        const bool isIndexed = m_nodesOfRuntime.add(nodeData);
+        cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
+    });
 }
 
 cxx::expected<popo::ConditionVariableData*, PortPoolError>
 PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
-    return m_portPool->addConditionVariableData(runtimeName);
+    return m_portPool->addConditionVariableData(runtimeName).and_then([this](auto conditionVariableData) {
+        const bool isIndexed = m_conditionVariablesOfRuntime.add(conditionVariableData);
+        cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
+    });
+}
+
+cxx::expected<runtime::Heartbeat*, PortPoolError>
+PortManager::acquireHeartbeat(const RuntimeName_t& runtimeName) noexcept
+{
+    return m_portPool->addHeartbeat(runtimeName).and_then([this](auto heartbeat) {
+        const bool isIndexed = m_heartbeatsOfRuntime.add(heartbeat);
+        cxx::Ensures(isIndexed && "The index has the capacity of the port pool");
+    });
+}
+
+cxx::expected<runtime::CommandChannel*, PortPoolError>
+PortManager::acquireCommandChannel(const RuntimeName_t& runtimeName) noexcept
+{
+    return m_portPool->addCommandChannel(runtimeName);
+}
+
+void PortManager::releaseCommandChannel(runtime::CommandChannel* const commandChannel) noexcept
+{
+    if (commandChannel != nullptr)
+    {
+        m_portPool->removeCommandChannel(commandChannel);
+    }
 }
 
 bool PortManager::isInternal(const capro::ServiceDescription& service) const noexcept
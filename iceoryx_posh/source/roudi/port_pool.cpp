@@ -43,6 +43,62 @@ PortPool::getConditionVariableDataList() noexcept
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+cxx::vector<runtime::Heartbeat*, MAX_PROCESS_NUMBER> PortPool::getHeartbeatList() noexcept
+{
+    return m_portPoolData->m_heartbeatMembers.content();
+}
+
+popo::ConditionVariableData& PortPool::getDiscoveryConditionVariableData() noexcept
+{
+    return m_portPoolData->m_discoveryConditionVariableData;
+}
+
+popo::DirtyPortList& PortPool::getDirtyPortList() noexcept
+{
+    return m_portPoolData->m_dirtyPortList;
+}
+
+runtime::CommandChannelQueue& PortPool::getCommandChannelQueue() noexcept
+{
+    return m_portPoolData->m_commandChannelQueue;
+}
+
+runtime::CommandChannel* PortPool::getCommandChannel(const uint64_t index) noexcept
+{
+    if (index >= m_portPoolData->m_commandChannels.size())
+    {
+        return nullptr;
+    }
+    return &m_portPoolData->m_commandChannels[index];
+}
+
+PublisherPortRouDiType::MemberType_t* PortPool::getPublisherPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_publisherPortMembers.get(index);
+}
+
+SubscriberPortType::MemberType_t* PortPool::getSubscriberPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_subscriberPortMembers.get(index);
+}
+
+popo::ClientPortData* PortPool::getClientPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_clientPortMembers.get(index);
+}
+
+popo::ServerPortData* PortPool::getServerPortData(const uint64_t index) noexcept
+{
+    return m_portPoolData->m_serverPortMembers.get(index);
+}
+
+void PortPool::enableDiscoveryRequests(popo::BasePortData& portData, const popo::DirtyPort& dirtyPort) noexcept
+{
+    portData.m_discoveryConditionVariableDataPtr = &m_portPoolData->m_discoveryConditionVariableData;
+    portData.m_dirtyPortListPtr = &m_portPoolData->m_dirtyPortList;
+    portData.m_dirtyPort = dirtyPort;
+}
+
 cxx::expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces interface) noexcept
 {
@@ -93,6 +149,39 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     }
 }
 
+cxx::expected<runtime::Heartbeat*, PortPoolError> PortPool::addHeartbeat(const RuntimeName_t& runtimeName) noexcept
+{
+    if (m_portPoolData->m_heartbeatMembers.hasFreeSpace())
+    {
+        auto heartbeat = m_portPoolData->m_heartbeatMembers.insert(runtimeName);
+        return cxx::success<runtime::Heartbeat*>(heartbeat);
+    }
+    else
+    {
+        LogWarn() << "Out of heartbeats! Requested by runtime '" << runtimeName << "'";
+        errorHandler(PoshError::PORT_POOL__HEARTBEAT_LIST_OVERFLOW, ErrorLevel::MODERATE);
+        return cxx::error<PortPoolError>(PortPoolError::HEARTBEAT_LIST_FULL);
+    }
+}
+
+cxx::expected<runtime::CommandChannel*, PortPoolError>
+PortPool::addCommandChannel(const RuntimeName_t& runtimeName) noexcept
+{
+    auto& commandChannels = m_portPoolData->m_commandChannels;
+    for (uint32_t index = 0U; index < commandChannels.size(); ++index)
+    {
+        if (!commandChannels[index].isOpen())
+        {
+            commandChannels[index].open(runtimeName, m_portPoolData->m_commandChannelQueue, index);
+            return cxx::success<runtime::CommandChannel*>(&commandChannels[index]);
+        }
+    }
+
+    LogWarn() << "Out of command channels! Requested by runtime '" << runtimeName << "'";
+    errorHandler(PoshError::PORT_POOL__COMMAND_CHANNEL_LIST_OVERFLOW, ErrorLevel::MODERATE);
+    return cxx::error<PortPoolError>(PortPoolError::COMMAND_CHANNEL_LIST_FULL);
+}
+
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
     m_portPoolData->m_interfacePortMembers.erase(portData);
@@ -108,6 +197,16 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+void PortPool::removeHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept
+{
+    m_portPoolData->m_heartbeatMembers.erase(heartbeat);
+}
+
+void PortPool::removeCommandChannel(runtime::CommandChannel* const commandChannel) noexcept
+{
+    commandChannel->close();
+}
+
 cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers.content();
@@ -129,6 +228,8 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        const auto index = m_portPoolData->m_publisherPortMembers.indexOf(publisherPortData);
+        enableDiscoveryRequests(*publisherPortData, {popo::DirtyPortKind::PUBLISHER, static_cast<uint32_t>(index)});
         return cxx::success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -150,6 +251,8 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
             serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+        const auto index = m_portPoolData->m_subscriberPortMembers.indexOf(subscriberPortData);
+        enableDiscoveryRequests(*subscriberPortData, {popo::DirtyPortKind::SUBSCRIBER, static_cast<uint32_t>(index)});
 
         return cxx::success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -189,6 +292,8 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
 
     auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
         serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+    const auto index = m_portPoolData->m_clientPortMembers.indexOf(clientPortData);
+    enableDiscoveryRequests(*clientPortData, {popo::DirtyPortKind::CLIENT, static_cast<uint32_t>(index)});
     return cxx::success<popo::ClientPortData*>(clientPortData);
 }
 
@@ -209,6 +314,8 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
 
     auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
         serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+    const auto index = m_portPoolData->m_serverPortMembers.indexOf(serverPortData);
+    enableDiscoveryRequests(*serverPortData, {popo::DirtyPortKind::SERVER, static_cast<uint32_t>(index)});
     return cxx::success<popo::ServerPortData*>(serverPortData);
 }
 
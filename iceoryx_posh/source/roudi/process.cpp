@@ -29,16 +29,29 @@ Process::Process(const RuntimeName_t& name,
                  const uint32_t pid,
                  const posix::PosixUser& user,
                  const bool isMonitored,
-                 const uint64_t sessionId) noexcept
+                 const uint64_t sessionId,
+                 runtime::Heartbeat* const heartbeat,
+                 const int32_t pidfd,
+                 runtime::CommandChannel* const commandChannel,
+                 const bool isInProcess) noexcept
     : m_pid(pid)
-    , m_ipcChannel(name)
+    , m_name(name)
     , m_timestamp(mepoo::BaseClock_t::now())
     , m_user(user)
     , m_isMonitored(isMonitored)
     , m_sessionId(sessionId)
+    , m_heartbeat(heartbeat)
+    , m_pidfd(pidfd)
+    , m_commandChannel(commandChannel)
+    , m_isInProcess(isInProcess)
 {
 }
 
+Process::~Process() noexcept
+{
+    ProcessTerminationMonitor::closePidfd(m_pidfd);
+}
+
 uint32_t Process::getPid() const noexcept
 {
     return m_pid;
@@ -46,12 +59,24 @@ uint32_t Process::getPid() const noexcept
 
 const RuntimeName_t Process::getName() const noexcept
 {
-    return RuntimeName_t(cxx::TruncateToCapacity, m_ipcChannel.getRuntimeName());
+    return m_name;
 }
 
 void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
 {
-    bool sendSuccess = m_ipcChannel.send(data);
+    if (m_commandChannel != nullptr && m_commandChannel->sendResponse(data))
+    {
+        return;
+    }
+
+    // the ProcessManager sends the REG_ACK with its own IPC channel, therefore the channel is opened with the first
+    // message afterwards and a process which uses only the command channel never opens it
+    if (!m_isInProcess && !m_ipcChannel.has_value())
+    {
+        m_ipcChannel.emplace(m_name);
+    }
+
+    bool sendSuccess = m_ipcChannel.has_value() && m_ipcChannel->send(data);
     if (!sendSuccess)
     {
         LogWarn() << "Process cannot send message over communication channel";
@@ -74,6 +99,31 @@ mepoo::TimePointNs_t Process::getTimestamp() noexcept
     return m_timestamp;
 }
 
+void Process::updateTimestampFromHeartbeat(const mepoo::TimePointNs_t now) noexcept
+{
+    if (m_heartbeat == nullptr)
+    {
+        return;
+    }
+
+    const auto counter = m_heartbeat->counter();
+    if (counter != m_lastHeartbeatCounter)
+    {
+        m_lastHeartbeatCounter = counter;
+        m_timestamp = now;
+    }
+}
+
+runtime::Heartbeat* Process::getHeartbeat() const noexcept
+{
+    return m_heartbeat;
+}
+
+runtime::CommandChannel* Process::getCommandChannel() const noexcept
+{
+    return m_commandChannel;
+}
+
 posix::PosixUser Process::getUser() const noexcept
 {
     return m_user;
@@ -84,5 +134,15 @@ bool Process::isMonitored() const noexcept
     return m_isMonitored;
 }
 
+bool Process::isInProcess() const noexcept
+{
+    return m_isInProcess;
+}
+
+bool Process::hasTerminated() const noexcept
+{
+    return ProcessTerminationMonitor::hasTerminated(m_pidfd);
+}
+
 } // namespace roudi
 } // namespace iox
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
@@ -36,6 +37,8 @@ namespace iox
 {
 namespace roudi
 {
+thread_local runtime::IpcMessage* ProcessManager::t_inProcessResponse{nullptr};
+
 ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
                                PortManager& portManager,
                                const version::CompatibilityCheckLevel compatibilityCheckLevel) noexcept
@@ -78,19 +81,21 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
-            m_portManager.unblockProcessShutdown(name);
+            withPortManager([&](PortManager& portManager) { portManager.unblockProcessShutdown(name); });
             // Reply with PREPARE_APP_TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::PREPARE_APP_TERMINATION_ACK);
-            process->sendViaIpcChannel(sendBuffer);
+            sendToProcess(*process, sendBuffer);
         })
         .or_else([&]() { LogWarn() << "Unknown application " << name << " requested shutdown preparation."; });
 }
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
     for (auto& process : m_processList)
     {
@@ -98,11 +103,12 @@ void ProcessManager::requestShutdownOfAllProcesses() noexcept
     }
 
     // this unblocks the RouDi shutdown if a publisher port is blocked by a full subscriber queue
-    m_portManager.unblockRouDiShutdown();
+    withPortManager([](PortManager& portManager) { portManager.unblockRouDiShutdown(); });
 }
 
 bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (isProcessAlive(process))
@@ -115,6 +121,7 @@ bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         LogWarn() << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -125,10 +132,12 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         LogWarn() << "Process ID " << process.getPid() << " named '" << process.getName()
                   << "' is still running after SIGKILL was sent. RouDi is ignoring this process.";
+        m_processIndex.remove(&process);
     }
     m_processList.clear();
 }
@@ -137,6 +146,12 @@ bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy s
 {
     static constexpr int32_t ERROR_CODE = -1;
 
+    // the signal would terminate RouDi itself, the runtime is shut down by its owner in the same process
+    if (process.isInProcess())
+    {
+        return true;
+    }
+
     return !posix::posixCall(kill)(static_cast<pid_t>(process.getPid()),
                                    (shutdownPolicy == ShutdownPolicy::SIG_KILL) ? SIGKILL : SIGTERM)
                 .failureReturnValue(ERROR_CODE)
@@ -150,6 +165,12 @@ bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy s
 bool ProcessManager::isProcessAlive(const Process& process) noexcept
 {
     static constexpr int32_t ERROR_CODE = -1;
+
+    // RouDi cannot wait for a runtime in its own process to terminate
+    if (process.isInProcess())
+    {
+        return false;
+    }
     auto checkCommand = posix::posixCall(kill)(static_cast<pid_t>(process.getPid()), SIGTERM)
                             .failureReturnValue(ERROR_CODE)
                             .ignoreErrnos(ESRCH)
@@ -192,10 +213,15 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const bool isMonitored,
                                      const int64_t transmissionTimestamp,
                                      const uint64_t sessionId,
-                                     const version::VersionInfo& versionInfo) noexcept
+                                     const version::VersionInfo& versionInfo,
+                                     const uint16_t binaryProtocolVersion) noexcept
 {
     bool returnValue{false};
+    runtime::IpcMessage registrationAck;
 
+    // only the bookkeeping is done under the lock, the syscalls to open the IPC channel and to send the REG_ACK
+    // would otherwise block the requests of all other processes
+    std::unique_lock<std::mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // process is already in list (i.e. registered)
@@ -221,25 +247,67 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
             else
             {
                 // try registration again, should succeed since removal was successful
-                returnValue =
-                    this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+                returnValue = this->addProcess(name,
+                                               pid,
+                                               user,
+                                               isMonitored,
+                                               transmissionTimestamp,
+                                               sessionId,
+                                               versionInfo,
+                                               binaryProtocolVersion,
+                                               registrationAck);
             }
         })
         .or_else([&]() {
             // process does not exist in list and can be added
-            returnValue = this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+            returnValue = this->addProcess(name,
+                                           pid,
+                                           user,
+                                           isMonitored,
+                                           transmissionTimestamp,
+                                           sessionId,
+                                           versionInfo,
+                                           binaryProtocolVersion,
+                                           registrationAck);
         });
+    lock.unlock();
+
+    if (returnValue)
+    {
+        sendRegistrationAck(name, registrationAck);
+    }
 
     return returnValue;
 }
 
+void ProcessManager::sendRegistrationAck(const RuntimeName_t& name, const runtime::IpcMessage& registrationAck) noexcept
+{
+    // a runtime in the same process like RouDi receives the REG_ACK as response to its in-process request
+    if (t_inProcessResponse != nullptr)
+    {
+        *t_inProcessResponse = registrationAck;
+        return;
+    }
+
+    // the Process opens its own IPC channel with the first message which is not a response via the command channel,
+    // it cannot be used here since the process may be removed as soon as the lock of the process list is released
+    runtime::IpcInterfaceUser ipcChannel(name);
+    if (!ipcChannel.send(registrationAck))
+    {
+        LogWarn() << "Unable to send the REG_ACK to application " << name;
+        errorHandler(PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED, ErrorLevel::MODERATE);
+    }
+}
+
 bool ProcessManager::addProcess(const RuntimeName_t& name,
                                 const uint32_t pid,
                                 const posix::PosixUser& user,
                                 const bool isMonitored,
                                 const int64_t transmissionTimestamp,
                                 const uint64_t sessionId,
-                                const version::VersionInfo& versionInfo) noexcept
+                                const version::VersionInfo& versionInfo,
+                                const uint16_t binaryProtocolVersion,
+                                runtime::IpcMessage& registrationAck) noexcept
 {
     if (!version::VersionInfo::getCurrentVersion().checkCompatibility(versionInfo, m_compatibilityCheckLevel))
     {
@@ -256,21 +324,76 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         LogError() << "Could not register process '" << name << "' - too many processes";
         return false;
     }
-    m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
-
-    // send REG_ACK and BaseAddrString
-    runtime::IpcMessage sendBuffer;
-    const bool sendKeepAlive = isMonitored;
+    // a runtime which registers while an in-process request is processed lives in the same process like RouDi, it is
+    // not monitored since it terminates together with RouDi and it has no IPC channel
+    const bool isInProcess{t_inProcessResponse != nullptr};
+    const bool isProcessMonitored{isMonitored && !isInProcess};
+    // runtimes which speak the binary protocol signal their liveliness with a heartbeat in the management segment
+    // instead of sending KEEPALIVE messages
+    runtime::Heartbeat* heartbeat{nullptr};
+    if (isProcessMonitored && binaryProtocolVersion > 0U)
+    {
+        withPortManager([&](PortManager& portManager) { return portManager.acquireHeartbeat(name); })
+            .and_then([&](auto heartbeatPtr) { heartbeat = heartbeatPtr; })
+            .or_else([&](auto&) { LogWarn() << "Application " << name << " falls back to KEEPALIVE messages"; });
+    }
+    // runtimes which speak the binary protocol send their requests after the registration via a command channel in
+    // the management segment instead of the IPC channel
+    runtime::CommandChannel* commandChannel{nullptr};
+    if (binaryProtocolVersion > 0U)
+    {
+        withPortManager([&](PortManager& portManager) { return portManager.acquireCommandChannel(name); })
+            .and_then([&](auto commandChannelPtr) { commandChannel = commandChannelPtr; })
+            .or_else([&](auto&) { LogWarn() << "Application " << name << " falls back to the IPC channel"; });
+    }
+    // the pidfd allows to detect the termination immediately, the keep alive mechanism is the fallback
+    cxx::optional<int32_t> pidfd;
+    if (isProcessMonitored)
+    {
+        pidfd = m_processTerminationMonitor.watch(pid);
+    }
+    m_processList.emplace_back(name,
+                               pid,
+                               user,
+                               isProcessMonitored,
+                               sessionId,
+                               heartbeat,
+                               pidfd.value_or(ProcessTerminationMonitor::INVALID_PIDFD),
+                               commandChannel,
+                               isInProcess);
+    const bool isIndexed = m_processIndex.add(&m_processList.back());
+    cxx::Ensures(isIndexed && "The index has the capacity of the process list");
+
+    // the REG_ACK is sent by the caller after the lock of the process list was released
+    runtime::IpcMessage& sendBuffer = registrationAck;
+    const bool sendKeepAlive = isProcessMonitored;
 
     auto offset = memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
                << m_mgmtSegmentId << sendKeepAlive;
-
-    m_processList.back().sendViaIpcChannel(sendBuffer);
-
-    // set current timestamp again (already done in Process's constructor
-    m_processList.back().setTimestamp(mepoo::BaseClock_t::now());
+    // runtimes which do not know the binary protocol do not send a version and do not expect one in the REG_ACK
+    if (binaryProtocolVersion > 0U)
+    {
+        sendBuffer << algorithm::minVal(binaryProtocolVersion, runtime::IPC_BINARY_PROTOCOL_VERSION);
+        if (heartbeat != nullptr || commandChannel != nullptr)
+        {
+            // the offset of the heartbeat precedes the one of the command channel, a runtime without heartbeat
+            // receives the null pointer offset
+            using RelativePointer_t = memory::UntypedRelativePointer;
+            RelativePointer_t::offset_t heartbeatOffset{RelativePointer_t::NULL_POINTER_OFFSET};
+            if (heartbeat != nullptr)
+            {
+                heartbeatOffset = RelativePointer_t::getOffset(memory::segment_id_t{m_mgmtSegmentId}, heartbeat);
+            }
+            sendBuffer << heartbeatOffset;
+        }
+        if (commandChannel != nullptr)
+        {
+            sendBuffer << memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId},
+                                                                    commandChannel);
+        }
+    }
 
     m_processIntrospection->addProcess(static_cast<int>(pid), RuntimeName_t(cxx::TruncateToCapacity, name.c_str()));
 
@@ -280,6 +403,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
@@ -291,22 +415,23 @@ bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 
 bool ProcessManager::searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept
 {
-    // we need to search for the process (currently linear search)
+    auto process = findProcess(name);
+    if (!process.has_value())
+    {
+        return false;
+    }
+
+    // the list can only erase by iterator, comparing the addresses is cheap compared to deleting the ports
     auto it = m_processList.begin();
-    while (it != m_processList.end())
+    while (&(*it) != process.value())
     {
-        auto otherName = it->getName();
-        if (name == otherName)
-        {
-            if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
-            {
-                LogDebug() << "Removed existing application " << name;
-            }
-            return true; // we can assume there are no other processes with this name
-        }
         ++it;
     }
-    return false;
+    if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
+    {
+        LogDebug() << "Removed existing application " << name;
+    }
+    return true; // we can assume there are no other processes with this name
 }
 
 bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(ProcessList_t::iterator& processIter,
@@ -314,7 +439,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
-        m_portManager.deletePortsOfProcess(processIter->getName());
+        withPortManager([&](PortManager& portManager) { portManager.deletePortsOfProcess(processIter->getName()); });
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
         if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
@@ -322,9 +447,14 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
             // Reply with TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION_ACK);
-            processIter->sendViaIpcChannel(sendBuffer);
+            sendToProcess(*processIter, sendBuffer);
         }
 
+        // the response to a request from the command channel was already sent
+        withPortManager(
+            [&](PortManager& portManager) { portManager.releaseCommandChannel(processIter->getCommandChannel()); });
+
+        m_processIndex.remove(&(*processIter));
         processIter = m_processList.erase(processIter); // delete application
         return true;
     }
@@ -333,6 +463,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 
 void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // reset timestamp
@@ -345,64 +476,28 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) {
-            // create a ReceiverPort
-            popo::InterfacePortData* port = m_portManager.acquireInterfacePortData(interface, name, node);
-
-            // send ReceiverPort to app as a serialized relative pointer
-            auto offset = memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, port);
-
-            runtime::IpcMessage sendBuffer;
-            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_INTERFACE_ACK)
-                       << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-            process->sendViaIpcChannel(sendBuffer);
-
-            LogDebug() << "Created new interface for application " << name;
-        })
-        .or_else([&]() { LogWarn() << "Unknown application " << name << " requested an interface."; });
+    runtime::IpcPortRequest request;
+    request.type = runtime::IpcMessageType::CREATE_INTERFACE;
+    request.interface = interface;
+    request.nodeName = node;
+    addPortForProcessAndSendResponse(name, request);
 }
 
 void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const NodeName_t& nodeName) noexcept
 {
-    findProcess(runtimeName)
-        .and_then([&](auto& process) {
-            m_portManager.acquireNodeData(runtimeName, nodeName)
-                .and_then([&](auto nodeData) {
-                    auto offset =
-                        memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, nodeData);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_NODE_ACK)
-                               << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-
-                    process->sendViaIpcChannel(sendBuffer);
-                    m_processIntrospection->addNode(RuntimeName_t(cxx::TruncateToCapacity, runtimeName.c_str()),
-                                                    NodeName_t(cxx::TruncateToCapacity, nodeName.c_str()));
-                    LogDebug() << "Created new node " << nodeName << " for process " << runtimeName;
-                })
-                .or_else([&](PortPoolError error) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    if (error == PortPoolError::NODE_DATA_LIST_FULL)
-                    {
-                        sendBuffer << runtime::IpcMessageErrorTypeToString(
-                            runtime::IpcMessageErrorType::NODE_DATA_LIST_FULL);
-                    }
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    LogDebug() << "Could not create new node for process " << runtimeName;
-                });
-        })
-        .or_else([&]() { LogWarn() << "Unknown process " << runtimeName << " requested a node."; });
+    runtime::IpcPortRequest request;
+    request.type = runtime::IpcMessageType::CREATE_NODE;
+    request.nodeName = nodeName;
+    addPortForProcessAndSendResponse(runtimeName, request);
 }
 
 void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
         sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
-        process->sendViaIpcChannel(sendBuffer);
+        sendToProcess(*process, sendBuffer);
 
         LogError() << "Application " << name << " sent a message, which is not supported by this RouDi";
     });
@@ -413,40 +508,12 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                                              const popo::SubscriberOptions& subscriberOptions,
                                              const PortConfigInfo& portConfigInfo) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (!maybeSubscriber.has_error())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId},
-                                                                        maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                LogDebug() << "Created new SubscriberPort for application '" << name << "' with service description '"
-                           << service << "'";
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                LogError() << "Could not create SubscriberPort for application '" << name
-                           << "' with service description '" << service << "'";
-            }
-        })
-        .or_else([&]() {
-            LogWarn() << "Unknown application '" << name << "' requested a SubscriberPort with service description '"
-                      << service << "'";
-        });
+    runtime::IpcPortRequest request;
+    request.type = runtime::IpcMessageType::CREATE_SUBSCRIBER;
+    request.service = service;
+    request.subscriberOptions = subscriberOptions;
+    request.portConfigInfo = portConfigInfo;
+    addPortForProcessAndSendResponse(name, request);
 }
 
 void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
@@ -454,211 +521,384 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
+    runtime::IpcPortRequest request;
+    request.type = runtime::IpcMessageType::CREATE_PUBLISHER;
+    request.service = service;
+    request.publisherOptions = publisherOptions;
+    request.portConfigInfo = portConfigInfo;
+    addPortForProcessAndSendResponse(name, request);
+}
 
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+void ProcessManager::addClientForProcess(const RuntimeName_t& name,
+                                         const capro::ServiceDescription& service,
+                                         const popo::ClientOptions& clientOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    runtime::IpcPortRequest request;
+    request.type = runtime::IpcMessageType::CREATE_CLIENT;
+    request.service = service;
+    request.clientOptions = clientOptions;
+    request.portConfigInfo = portConfigInfo;
+    addPortForProcessAndSendResponse(name, request);
+}
 
-            if (!maybePublisher.has_error())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId},
-                                                                        maybePublisher.value());
+void ProcessManager::addServerForProcess(const RuntimeName_t& name,
+                                         const capro::ServiceDescription& service,
+                                         const popo::ServerOptions& serverOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    runtime::IpcPortRequest request;
+    request.type = runtime::IpcMessageType::CREATE_SERVER;
+    request.service = service;
+    request.serverOptions = serverOptions;
+    request.portConfigInfo = portConfigInfo;
+    addPortForProcessAndSendResponse(name, request);
+}
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
+{
+    runtime::IpcPortRequest request;
+    request.type = runtime::IpcMessageType::CREATE_CONDITION_VARIABLE;
+    addPortForProcessAndSendResponse(runtimeName, request);
+}
 
-                LogDebug() << "Created new PublisherPort for application '" << name << "' with service description '"
-                           << service << "'";
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name,
+                                        const uint16_t numberOfRequests,
+                                        runtime::IpcBinaryFrame& requests) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_processListMutex);
+    findProcess(name)
+        .and_then([&](auto& process) {
+            runtime::IpcBinaryFrame responses;
+            if (numberOfRequests > runtime::MAX_PORT_REQUESTS_PER_FRAME)
+            {
+                LogError() << "Application " << name << " sent " << numberOfRequests
+                           << " port requests in one message, at most " << runtime::MAX_PORT_REQUESTS_PER_FRAME
+                           << " are supported";
+                responses << runtime::IPC_BINARY_PROTOCOL_VERSION << static_cast<uint16_t>(0U);
             }
             else
             {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-
-                std::string error;
-                switch (maybePublisher.get_error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+                responses << runtime::IPC_BINARY_PROTOCOL_VERSION << numberOfRequests;
+                for (uint16_t i = 0U; i < numberOfRequests; ++i)
                 {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
+                    runtime::IpcPortRequest request;
+                    requests >> request;
 
-                process->sendViaIpcChannel(sendBuffer);
-                LogError() << "Could not create PublisherPort for application '" << name
-                           << "' with service description '" << service << "'";
+                    runtime::IpcPortResponse response;
+                    if (requests.isValid())
+                    {
+                        response = this->createPortForProcess(*process, request);
+                    }
+                    else
+                    {
+                        LogError() << "Application " << name << " sent an invalid port request";
+                        response.type = runtime::IpcMessageType::ERROR;
+                    }
+                    responses << response;
+                }
             }
+
+            runtime::IpcMessage sendBuffer;
+            responses.encode(sendBuffer);
+            sendToProcess(*process, sendBuffer);
         })
         .or_else([&]() {
-            LogWarn() << "Unknown application '" << name << "' requested a PublisherPort with service description '"
-                      << service << "'";
+            LogWarn() << "Unknown application " << name << " requested " << numberOfRequests << " resources.";
         });
 }
 
-void ProcessManager::addClientForProcess(const RuntimeName_t& name,
-                                         const capro::ServiceDescription& service,
-                                         const popo::ClientOptions& clientOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+void ProcessManager::addPortForProcessAndSendResponse(const RuntimeName_t& name,
+                                                      const runtime::IpcPortRequest& request) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_processListMutex);
     findProcess(name)
-        .and_then([&](auto& process) { // create a ClientPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+        .and_then([&](auto& process) {
+            const auto response = this->createPortForProcess(*process, request);
 
-            if (!segmentInfo.m_memoryManager.has_value())
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(response.type);
+            if (response.type == runtime::IpcMessageType::ERROR)
             {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
+                if (response.error != runtime::IpcMessageErrorType::NOTYPE)
+                {
+                    sendBuffer << runtime::IpcMessageErrorTypeToString(response.error);
+                }
             }
-
-            m_portManager
-                .acquireClientPortData(
-                    service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& clientPort) {
-                    auto relativePtrToClientPort =
-                        memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, clientPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << cxx::convert::toString(relativePtrToClientPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    LogDebug() << "Created new ClientPort for application '" << name << "' with service description '"
-                               << service << "'";
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    LogError() << "Could not create ClientPort for application '" << name
-                               << "' with service description '" << service << "'";
-                });
+            else
+            {
+                sendBuffer << cxx::convert::toString(response.offset) << cxx::convert::toString(response.segmentId);
+            }
+            sendToProcess(*process, sendBuffer);
         })
         .or_else([&]() {
-            LogWarn() << "Unknown application '" << name << "' requested a ClientPort with service description '"
-                      << service << "'";
+            LogWarn() << "Unknown application '" << name << "' requested a resource of type '"
+                      << runtime::IpcMessageTypeToString(request.type) << "'";
         });
 }
 
-void ProcessManager::addServerForProcess(const RuntimeName_t& name,
-                                         const capro::ServiceDescription& service,
-                                         const popo::ServerOptions& serverOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+runtime::IpcPortResponse ProcessManager::addPortForProcess(const RuntimeName_t& name,
+                                                           const runtime::IpcPortRequest& request) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) { // create a ServerPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+    std::lock_guard<std::mutex> lock(m_processListMutex);
+    auto process = findProcess(name);
+    if (!process.has_value())
+    {
+        LogWarn() << "Unknown application '" << name << "' requested a resource of type '"
+                  << runtime::IpcMessageTypeToString(request.type) << "'";
+        return errorResponse(runtime::IpcMessageErrorType::NOTYPE);
+    }
+    return createPortForProcess(*process.value(), request);
+}
 
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
+void ProcessManager::processInProcessRequest(runtime::IpcMessage& response,
+                                             const cxx::function_ref<void()> callable) noexcept
+{
+    auto previousResponse = t_inProcessResponse;
+    t_inProcessResponse = &response;
+    callable();
+    t_inProcessResponse = previousResponse;
+}
 
-            m_portManager
-                .acquireServerPortData(
-                    service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& serverPort) {
-                    auto relativePtrToServerPort =
-                        memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, serverPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << cxx::convert::toString(relativePtrToServerPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    LogDebug() << "Created new ServerPort for application '" << name << "' with service description '"
-                               << service << "'";
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    LogError() << "Could not create ServerPort for application '" << name
-                               << "' with service description '" << service << "'";
-                });
-        })
-        .or_else([&]() {
-            LogWarn() << "Unknown application '" << name << "' requested a ServerPort with service description '"
-                      << service << "'";
-        });
+void ProcessManager::sendToProcess(Process& process, const runtime::IpcMessage& message) noexcept
+{
+    if (process.isInProcess())
+    {
+        if (t_inProcessResponse == nullptr)
+        {
+            LogWarn() << "Application " << process.getName() << " runs in the same process like RouDi and receives "
+                      << "only responses to its requests";
+            return;
+        }
+        *t_inProcessResponse = message;
+        return;
+    }
+    process.sendViaIpcChannel(message);
 }
 
-void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
+runtime::IpcPortResponse ProcessManager::createPortForProcess(Process& process,
+                                                              const runtime::IpcPortRequest& request) noexcept
+{
+    switch (request.type)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+        return createPublisherForProcess(process, request);
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+        return createSubscriberForProcess(process, request);
+    case runtime::IpcMessageType::CREATE_CLIENT:
+        return createClientForProcess(process, request);
+    case runtime::IpcMessageType::CREATE_SERVER:
+        return createServerForProcess(process, request);
+    case runtime::IpcMessageType::CREATE_INTERFACE:
+        return createInterfaceForProcess(process, request);
+    case runtime::IpcMessageType::CREATE_NODE:
+        return createNodeForProcess(process, request);
+    case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
+        return createConditionVariableForProcess(process);
+    default:
+        return errorResponse(runtime::IpcMessageErrorType::NOTYPE);
+    }
+}
+
+runtime::IpcPortResponse ProcessManager::ackResponse(const runtime::IpcMessageType requestType,
+                                                     void* const resource) const noexcept
 {
-    findProcess(runtimeName)
-        .and_then([&](auto& process) { // Try to create a condition variable
-            m_portManager.acquireConditionVariableData(runtimeName)
-                .and_then([&](auto condVar) {
-                    auto offset =
-                        memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, condVar);
+    runtime::IpcPortResponse response;
+    response.type = runtime::getAckForPortRequest(requestType);
+    response.offset = memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, resource);
+    response.segmentId = m_mgmtSegmentId;
+    return response;
+}
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(
-                        runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
-                               << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+runtime::IpcPortResponse ProcessManager::errorResponse(const runtime::IpcMessageErrorType error) noexcept
+{
+    runtime::IpcPortResponse response;
+    response.type = runtime::IpcMessageType::ERROR;
+    response.error = error;
+    return response;
+}
 
-                    LogDebug() << "Created new ConditionVariable for application " << runtimeName;
-                })
-                .or_else([&](PortPoolError error) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    if (error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
-                    {
-                        sendBuffer << runtime::IpcMessageErrorTypeToString(
-                            runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
-                    }
-                    process->sendViaIpcChannel(sendBuffer);
+runtime::IpcPortResponse ProcessManager::createInterfaceForProcess(Process& process,
+                                                                   const runtime::IpcPortRequest& request) noexcept
+{
+    const auto name = process.getName();
+    // create a ReceiverPort
+    popo::InterfacePortData* port = withPortManager([&](PortManager& portManager) {
+        return portManager.acquireInterfacePortData(request.interface, name, request.nodeName);
+    });
 
-                    LogDebug() << "Could not create new ConditionVariable for application " << runtimeName;
-                });
-        })
-        .or_else([&]() { LogWarn() << "Unknown application " << runtimeName << " requested a ConditionVariable."; });
+    LogDebug() << "Created new interface for application " << name;
+    // send ReceiverPort to app as a serialized relative pointer
+    return ackResponse(request.type, port);
+}
+
+runtime::IpcPortResponse ProcessManager::createNodeForProcess(Process& process,
+                                                              const runtime::IpcPortRequest& request) noexcept
+{
+    const auto runtimeName = process.getName();
+    const auto& nodeName = request.nodeName;
+    auto maybeNodeData =
+        withPortManager([&](PortManager& portManager) { return portManager.acquireNodeData(runtimeName, nodeName); });
+
+    if (maybeNodeData.has_error())
+    {
+        LogDebug() << "Could not create new node for process " << runtimeName;
+        return errorResponse((maybeNodeData.get_error() == PortPoolError::NODE_DATA_LIST_FULL)
+                                 ? runtime::IpcMessageErrorType::NODE_DATA_LIST_FULL
+                                 : runtime::IpcMessageErrorType::NOTYPE);
+    }
+
+    m_processIntrospection->addNode(RuntimeName_t(cxx::TruncateToCapacity, runtimeName.c_str()),
+                                    NodeName_t(cxx::TruncateToCapacity, nodeName.c_str()));
+    LogDebug() << "Created new node " << nodeName << " for process " << runtimeName;
+    return ackResponse(request.type, maybeNodeData.value());
+}
+
+runtime::IpcPortResponse ProcessManager::createSubscriberForProcess(Process& process,
+                                                                    const runtime::IpcPortRequest& request) noexcept
+{
+    const auto name = process.getName();
+    // create a SubscriberPort
+    auto maybeSubscriber = withPortManager([&](PortManager& portManager) {
+        return portManager.acquireSubscriberPortData(
+            request.service, request.subscriberOptions, name, request.portConfigInfo);
+    });
+
+    if (maybeSubscriber.has_error())
+    {
+        LogError() << "Could not create SubscriberPort for application '" << name << "' with service description '"
+                   << request.service << "'";
+        return errorResponse(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+    }
+
+    LogDebug() << "Created new SubscriberPort for application '" << name << "' with service description '"
+               << request.service << "'";
+    // send SubscriberPort to app as a serialized relative pointer
+    return ackResponse(request.type, maybeSubscriber.value());
+}
+
+runtime::IpcPortResponse ProcessManager::createPublisherForProcess(Process& process,
+                                                                   const runtime::IpcPortRequest& request) noexcept
+{
+    const auto name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return errorResponse(runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    // create a PublisherPort
+    auto maybePublisher = withPortManager([&](PortManager& portManager) {
+        return portManager.acquirePublisherPortData(request.service,
+                                                    request.publisherOptions,
+                                                    name,
+                                                    &segmentInfo.m_memoryManager.value().get(),
+                                                    request.portConfigInfo);
+    });
+
+    if (maybePublisher.has_error())
+    {
+        LogError() << "Could not create PublisherPort for application '" << name << "' with service description '"
+                   << request.service << "'";
+        switch (maybePublisher.get_error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+            return errorResponse(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+            return errorResponse(runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+        default:
+            return errorResponse(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+        }
+    }
+
+    LogDebug() << "Created new PublisherPort for application '" << name << "' with service description '"
+               << request.service << "'";
+    // send PublisherPort to app as a serialized relative pointer
+    return ackResponse(request.type, maybePublisher.value());
+}
+
+runtime::IpcPortResponse ProcessManager::createClientForProcess(Process& process,
+                                                                const runtime::IpcPortRequest& request) noexcept
+{
+    const auto name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return errorResponse(runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    // create a ClientPort
+    auto maybeClient = withPortManager([&](PortManager& portManager) {
+        return portManager.acquireClientPortData(request.service,
+                                                 request.clientOptions,
+                                                 name,
+                                                 &segmentInfo.m_memoryManager.value().get(),
+                                                 request.portConfigInfo);
+    });
+
+    if (maybeClient.has_error())
+    {
+        LogError() << "Could not create ClientPort for application '" << name << "' with service description '"
+                   << request.service << "'";
+        return errorResponse(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+    }
+
+    LogDebug() << "Created new ClientPort for application '" << name << "' with service description '"
+               << request.service << "'";
+    return ackResponse(request.type, maybeClient.value());
+}
+
+runtime::IpcPortResponse ProcessManager::createServerForProcess(Process& process,
+                                                                const runtime::IpcPortRequest& request) noexcept
+{
+    const auto name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return errorResponse(runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    // create a ServerPort
+    auto maybeServer = withPortManager([&](PortManager& portManager) {
+        return portManager.acquireServerPortData(request.service,
+                                                 request.serverOptions,
+                                                 name,
+                                                 &segmentInfo.m_memoryManager.value().get(),
+                                                 request.portConfigInfo);
+    });
+
+    if (maybeServer.has_error())
+    {
+        LogError() << "Could not create ServerPort for application '" << name << "' with service description '"
+                   << request.service << "'";
+        return errorResponse(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+    }
+
+    LogDebug() << "Created new ServerPort for application '" << name << "' with service description '"
+               << request.service << "'";
+    return ackResponse(request.type, maybeServer.value());
+}
+
+runtime::IpcPortResponse ProcessManager::createConditionVariableForProcess(Process& process) noexcept
+{
+    const auto runtimeName = process.getName();
+    // Try to create a condition variable
+    auto maybeConditionVariable = withPortManager(
+        [&](PortManager& portManager) { return portManager.acquireConditionVariableData(runtimeName); });
+
+    if (maybeConditionVariable.has_error())
+    {
+        LogDebug() << "Could not create new ConditionVariable for application " << runtimeName;
+        return errorResponse((maybeConditionVariable.get_error() == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
+                                 ? runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL
+                                 : runtime::IpcMessageErrorType::NOTYPE);
+    }
+
+    LogDebug() << "Created new ConditionVariable for application " << runtimeName;
+    return ackResponse(runtime::IpcMessageType::CREATE_CONDITION_VARIABLE, maybeConditionVariable.value());
 }
 
 void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept
@@ -668,30 +908,58 @@ void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospe
 
 void ProcessManager::run() noexcept
 {
-    monitorProcesses();
+    {
+        std::lock_guard<std::mutex> lock(m_processListMutex);
+        monitorProcesses();
+    }
+    // the discovery does not access the process list, therefore the runtime messages are processed meanwhile
     discoveryUpdate();
 }
 
+bool ProcessManager::isProcessTerminationMonitoringSupported() const noexcept
+{
+    return m_processTerminationMonitor.isSupported();
+}
+
+void ProcessManager::handleProcessTermination(const units::Duration timeout) noexcept
+{
+    if (!m_processTerminationMonitor.waitForTermination(timeout))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_processListMutex);
+    auto processIterator = m_processList.begin();
+    while (processIterator != m_processList.end())
+    {
+        if (processIterator->hasTerminated())
+        {
+            LogWarn() << "Application " << processIterator->getName() << " terminated without unregistering"
+                      << " --> removing it";
+            constexpr TerminationFeedback FEEDBACK{TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS};
+            removeProcessAndDeleteRespectiveSharedMemoryObjects(processIterator, FEEDBACK);
+            continue; // the iterator points already to the next process
+        }
+        ++processIterator;
+    }
+}
+
 popo::PublisherPortData*
 ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept
 {
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
     options.nodeName = INTROSPECTION_NODE_NAME;
-    return m_portManager.acquireInternalPublisherPortData(service, options, m_introspectionMemoryManager);
+    return withPortManager([&](PortManager& portManager) {
+        return portManager.acquireInternalPublisherPortData(service, options, m_introspectionMemoryManager);
+    });
 }
 
 cxx::optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexcept
 {
-    for (auto& process : m_processList)
-    {
-        if (process.getName() == name)
-        {
-            return cxx::make_optional<Process*>(&process);
-        }
-    }
-
-    return cxx::nullopt;
+    cxx::optional<Process*> foundProcess;
+    m_processIndex.forEach(name, [&](Process* process) { foundProcess.emplace(process); });
+    return foundProcess;
 }
 
 void ProcessManager::monitorProcesses() noexcept
@@ -703,6 +971,7 @@ void ProcessManager::monitorProcesses() noexcept
     {
         if (processIterator->isMonitored())
         {
+            processIterator->updateTimestampFromHeartbeat(currentTimestamp);
             auto timediff = units::Duration(currentTimestamp - processIterator->getTimestamp());
 
             static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
@@ -718,11 +987,15 @@ void ProcessManager::monitorProcesses() noexcept
                 // delete all associated subscriber and publisher ports in shared
                 // memory and the associated RouDi discovery ports
                 // @todo iox-#539 Check if ShmManager and Process Manager end up in unintended condition
-                m_portManager.deletePortsOfProcess(processIterator->getName());
+                withPortManager([&](PortManager& portManager) {
+                    portManager.deletePortsOfProcess(processIterator->getName());
+                    portManager.releaseCommandChannel(processIterator->getCommandChannel());
+                });
 
                 m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
 
                 // delete application
+                m_processIndex.remove(&(*processIterator));
                 processIterator = m_processList.erase(processIterator);
                 continue; // erase returns first element after the removed one --> skip iterator increment
             }
@@ -733,7 +1006,7 @@ void ProcessManager::monitorProcesses() noexcept
 
 void ProcessManager::discoveryUpdate() noexcept
 {
-    m_portManager.doDiscovery();
+    withPortManager([](PortManager& portManager) { portManager.doDiscovery(); });
 }
 
 } // namespace roudi
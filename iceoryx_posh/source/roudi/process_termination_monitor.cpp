@@ -0,0 +1,123 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/pidfd.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr int32_t ProcessTerminationMonitor::INVALID_PIDFD;
+
+ProcessTerminationMonitor::ProcessTerminationMonitor() noexcept
+{
+    if (!platform::IOX_SUPPORT_PIDFD)
+    {
+        return;
+    }
+
+    posix::posixCall(iox_pidfd_set_create)()
+        .failureReturnValue(INVALID_PIDFD)
+        .evaluate()
+        .and_then([&](auto& r) { m_pidfdSet = r.value; })
+        .or_else([](auto& r) {
+            LogWarn() << "Unable to create the pidfd set, the termination of processes is only detected with the "
+                         "keep alive mechanism: "
+                      << r.getHumanReadableErrnum();
+        });
+}
+
+ProcessTerminationMonitor::~ProcessTerminationMonitor() noexcept
+{
+    closePidfd(m_pidfdSet);
+}
+
+bool ProcessTerminationMonitor::isSupported() const noexcept
+{
+    return m_pidfdSet != INVALID_PIDFD;
+}
+
+cxx::optional<int32_t> ProcessTerminationMonitor::watch(const uint32_t pid) noexcept
+{
+    if (!isSupported())
+    {
+        return cxx::nullopt;
+    }
+
+    auto pidfd = posix::posixCall(iox_pidfd_open)(pid).failureReturnValue(INVALID_PIDFD).evaluate();
+    if (pidfd.has_error())
+    {
+        LogWarn() << "Unable to open a pidfd for the process with the pid " << pid
+                  << ", its termination is only detected with the keep alive mechanism: "
+                  << pidfd.get_error().getHumanReadableErrnum();
+        return cxx::nullopt;
+    }
+
+    if (posix::posixCall(iox_pidfd_set_add)(m_pidfdSet, pidfd->value).failureReturnValue(-1).evaluate().has_error())
+    {
+        LogWarn() << "Unable to watch the pidfd of the process with the pid " << pid;
+        closePidfd(pidfd->value);
+        return cxx::nullopt;
+    }
+
+    return cxx::make_optional<int32_t>(pidfd->value);
+}
+
+bool ProcessTerminationMonitor::waitForTermination(const units::Duration timeout) noexcept
+{
+    if (!isSupported())
+    {
+        return false;
+    }
+
+    auto result = posix::posixCall(iox_pidfd_set_wait)(m_pidfdSet, static_cast<int>(timeout.toMilliseconds()))
+                      .failureReturnValue(-1)
+                      .ignoreErrnos(EINTR)
+                      .evaluate();
+    return !result.has_error() && result->value > 0;
+}
+
+bool ProcessTerminationMonitor::hasTerminated(const int32_t pidfd) noexcept
+{
+    if (pidfd == INVALID_PIDFD)
+    {
+        return false;
+    }
+
+    auto result = posix::posixCall(iox_pidfd_has_terminated)(pidfd).failureReturnValue(-1).evaluate();
+    return !result.has_error() && result->value > 0;
+}
+
+void ProcessTerminationMonitor::closePidfd(const int32_t pidfd) noexcept
+{
+    if (pidfd == INVALID_PIDFD)
+    {
+        return;
+    }
+
+    if (posix::posixCall(iox_close)(pidfd).failureReturnValue(-1).evaluate().has_error())
+    {
+        LogWarn() << "Unable to close the pidfd " << pidfd;
+    }
+}
+} // namespace roudi
+} // namespace iox
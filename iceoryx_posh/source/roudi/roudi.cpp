@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
@@ -26,6 +27,8 @@
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -36,16 +39,16 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     : m_killProcessesInDestructor(roudiStartupParameters.m_killProcessesInDestructor)
     , m_runMonitoringAndDiscoveryThread(true)
     , m_runHandleRuntimeMessageThread(true)
+    , m_runtimeMessagesThreadCount(
+          algorithm::minVal(algorithm::maxVal(roudiStartupParameters.m_runtimeMessagesThreadCount, 1U),
+                            MAX_RUNTIME_MESSAGES_THREAD_COUNT))
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, roudiStartupParameters.m_compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
 {
@@ -54,10 +57,13 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
         LogWarn() << "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!";
     }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
+    m_runtimeMessageIntrospection.registerPublisherPort(
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionRuntimeMessageService)));
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
+    m_runtimeMessageIntrospection.run();
 
     // since RouDi offers the introspection services, also add it to the list of processes
     m_processIntrospection.addProcess(getpid(), IPC_CHANNEL_ROUDI_NAME);
@@ -66,6 +72,12 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     m_monitoringAndDiscoveryThread = std::thread(&RouDi::monitorAndDiscoveryUpdate, this);
     posix::setThreadName(m_monitoringAndDiscoveryThread.native_handle(), "Mon+Discover");
 
+    if (m_monitoringMode == roudi::MonitoringMode::ON && m_prcMgr.isProcessTerminationMonitoringSupported())
+    {
+        m_processTerminationThread = std::thread(&RouDi::monitorProcessTermination, this);
+        posix::setThreadName(m_processTerminationThread.native_handle(), "ProcTermination");
+    }
+
     if (roudiStartupParameters.m_runtimesMessagesThreadStart == RuntimeMessagesThreadStart::IMMEDIATE)
     {
         startProcessRuntimeMessagesThread();
@@ -77,35 +89,74 @@ RouDi::~RouDi() noexcept
     shutdown();
 }
 
+bool RouDi::processRequest(const runtime::IpcMessage& request, runtime::IpcMessage& response) noexcept
+{
+    response.clearMessage();
+    m_prcMgr.processInProcessRequest(response, [&] { processRuntimeMessage(request); });
+    return response.isValid() && response.getNumberOfElements() > 0U;
+}
+
+runtime::IpcPortResponse RouDi::processPortRequest(const RuntimeName_t& runtimeName,
+                                                   const runtime::IpcPortRequest& request) noexcept
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // the PortManager runs the discovery for a new port while it creates it, the port is connected to the matching
+    // ports when it is returned
+    auto response = m_prcMgr.addPortForProcess(runtimeName, request);
+
+    m_runtimeMessageIntrospection.addMessage(request.type,
+                                             units::Duration(std::chrono::steady_clock::now() - startTime));
+    return response;
+}
+
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
-    m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
-    posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
+    m_roudiIpcInterface.emplace(IPC_CHANNEL_ROUDI_NAME);
+
+    // the logger is intentionally not used, to ensure that this message is always printed
+    std::cout << "RouDi is ready for clients" << std::endl;
+
+    for (uint32_t i = 0U; i < m_runtimeMessagesThreadCount; ++i)
+    {
+        m_handleRuntimeMessageThreads.emplace_back(&RouDi::processRuntimeMessages, this);
+        posix::setThreadName(m_handleRuntimeMessageThreads.back().native_handle(), "IPC-msg-process");
+        m_handleCommandChannelThreads.emplace_back(&RouDi::processCommandChannelRequests, this);
+        posix::setThreadName(m_handleCommandChannelThreads.back().native_handle(), "IPC-cmd-process");
+    }
 }
 
 void RouDi::shutdown() noexcept
 {
     m_processIntrospection.stop();
+    m_runtimeMessageIntrospection.stop();
     m_portManager->stopPortIntrospection();
 
     // stop the process management thread in order to prevent application to register while shutting down
     m_runMonitoringAndDiscoveryThread = false;
+    m_portManager->requestDiscovery();
     if (m_monitoringAndDiscoveryThread.joinable())
     {
         LogDebug() << "Joining 'Mon+Discover' thread...";
         m_monitoringAndDiscoveryThread.join();
         LogDebug() << "...'Mon+Discover' thread joined.";
     }
+    if (m_processTerminationThread.joinable())
+    {
+        LogDebug() << "Joining 'ProcTermination' thread...";
+        m_processTerminationThread.join();
+        LogDebug() << "...'ProcTermination' thread joined.";
+    }
 
     if (m_killProcessesInDestructor)
     {
         cxx::DeadlineTimer finalKillTimer(m_processKillDelay);
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         using namespace units::duration_literals;
         auto remainingDurationForWarnPrint = m_processKillDelay - 2_s;
-        while (m_prcMgr->isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -118,27 +169,43 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
     // Postpone the IpcChannelThread in order to receive TERMINATION
     m_runHandleRuntimeMessageThread = false;
 
-    if (m_handleRuntimeMessageThread.joinable())
+    for (auto& thread : m_handleRuntimeMessageThreads)
     {
-        LogDebug() << "Joining 'IPC-msg-process' thread...";
-        m_handleRuntimeMessageThread.join();
-        LogDebug() << "...'IPC-msg-process' thread joined.";
+        if (thread.joinable())
+        {
+            LogDebug() << "Joining 'IPC-msg-process' thread...";
+            thread.join();
+            LogDebug() << "...'IPC-msg-process' thread joined.";
+        }
+    }
+    m_handleRuntimeMessageThreads.clear();
+
+    for (auto& thread : m_handleCommandChannelThreads)
+    {
+        if (thread.joinable())
+        {
+            LogDebug() << "Joining 'IPC-cmd-process' thread...";
+            thread.join();
+            LogDebug() << "...'IPC-cmd-process' thread joined.";
+        }
     }
+    m_handleCommandChannelThreads.clear();
+    m_roudiIpcInterface.reset();
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -150,35 +217,104 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        m_prcMgr.run();
 
         cyclicUpdateHook();
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        // the ports wake up the discovery when they change their state, the process monitoring still requires the
+        // cyclic wake up
+        m_portManager->waitForDiscoveryRequest(DISCOVERY_INTERVAL);
     }
 }
 
-void RouDi::processRuntimeMessages() noexcept
+void RouDi::monitorProcessTermination() noexcept
 {
-    runtime::IpcInterfaceCreator roudiIpcInterface{IPC_CHANNEL_ROUDI_NAME};
-
-    // the logger is intentionally not used, to ensure that this message is always printed
-    std::cout << "RouDi is ready for clients" << std::endl;
+    // the keep alive mechanism of the 'Mon+Discover' thread still detects processes which hang without terminating
+    while (m_runMonitoringAndDiscoveryThread)
+    {
+        m_prcMgr.handleProcessTermination(m_processTerminationWaitTimeout);
+    }
+}
 
+void RouDi::processRuntimeMessages() noexcept
+{
     while (m_runHandleRuntimeMessageThread)
     {
-        // read RouDi's IPC channel
+        // read RouDi's IPC channel, it is shared by all runtime messages threads
         runtime::IpcMessage message;
-        if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
+        if (m_roudiIpcInterface->timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            std::string runtimeName = message.getElementAtIndex(1);
-
-            processMessage(message, cmd, RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+            processRuntimeMessage(message);
         }
     }
 }
 
+void RouDi::processCommandChannelRequests() noexcept
+{
+    while (m_runHandleRuntimeMessageThread)
+    {
+        // the command channels of all runtimes are served by all command channel threads
+        m_portManager->waitForCommandChannelRequest(m_runtimeMessagesThreadTimeout).and_then([&](auto commandChannel) {
+            runtime::IpcMessage message;
+            if (!commandChannel->takeRequest(message))
+            {
+                return;
+            }
+
+            processRuntimeMessage(message);
+
+            // the runtime blocks until it receives a response, an empty one signals that the request was not answered
+            if (commandChannel->sendResponse(runtime::IpcMessage()))
+            {
+                LogWarn() << "The request of \"" << commandChannel->runtimeName() << "\" was not answered";
+            }
+        });
+    }
+}
+
+void RouDi::processRuntimeMessage(const runtime::IpcMessage& message) noexcept
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    auto processingTime = [&startTime] {
+        return units::Duration(std::chrono::steady_clock::now() - startTime);
+    };
+
+    if (message.isBinaryFrame())
+    {
+        processBinaryMessage(message);
+        m_runtimeMessageIntrospection.addBinaryMessage(processingTime());
+        return;
+    }
+
+    auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+    std::string runtimeName = message.getElementAtIndex(1);
+
+    processMessage(message, cmd, RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+    m_runtimeMessageIntrospection.addMessage(cmd, processingTime());
+}
+
+void RouDi::processBinaryMessage(const runtime::IpcMessage& message) noexcept
+{
+    runtime::IpcBinaryFrame frame;
+    uint16_t version{0U};
+    RuntimeName_t runtimeName;
+    uint16_t numberOfRequests{0U};
+    if (!frame.decode(message) || !(frame >> version >> runtimeName >> numberOfRequests).isValid())
+    {
+        LogError() << "Received an invalid binary message";
+        return;
+    }
+
+    if (version == 0U || version > runtime::IPC_BINARY_PROTOCOL_VERSION)
+    {
+        LogError() << "Binary protocol version " << version << " from \"" << runtimeName << "\" is not supported";
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
+        return;
+    }
+
+    m_prcMgr.addPortsForProcess(runtimeName, numberOfRequests, frame);
+}
+
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  uid_t& userId,
@@ -199,7 +335,8 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
     case runtime::IpcMessageType::REG:
     {
-        if (message.getNumberOfElements() != 6)
+        // the binary protocol version is optional since older runtimes do not send it
+        if (message.getNumberOfElements() != 6 && message.getNumberOfElements() != 7)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::REG\" from \"" << runtimeName
                        << "\"received!";
@@ -210,13 +347,19 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             uid_t userId{0};
             int64_t transmissionTimestamp{0};
             version::VersionInfo versionInfo = parseRegisterMessage(message, pid, userId, transmissionTimestamp);
+            uint16_t binaryProtocolVersion{0U};
+            if (message.getNumberOfElements() == 7)
+            {
+                cxx::convert::fromString(message.getElementAtIndex(6).c_str(), binaryProtocolVersion);
+            }
 
             registerProcess(runtimeName,
                             pid,
                             iox::posix::PosixUser{userId},
                             transmissionTimestamp,
                             getUniqueSessionIdForProcess(),
-                            versionInfo);
+                            versionInfo,
+                            binaryProtocolVersion);
         }
         break;
     }
@@ -251,7 +394,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -288,7 +431,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -325,7 +468,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
         }
         break;
     }
@@ -361,7 +504,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
         }
         break;
     }
@@ -374,7 +517,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
         }
         break;
     }
@@ -390,7 +533,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces interface =
                 StringToCaProInterface(capro::IdString_t(cxx::TruncateToCapacity, message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(
+            m_prcMgr.addInterfaceForProcess(
                 runtimeName, interface, NodeName_t(cxx::TruncateToCapacity, message.getElementAtIndex(3)));
         }
         break;
@@ -405,13 +548,13 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             runtime::NodeProperty nodeProperty(cxx::Serialization(message.getElementAtIndex(2)));
-            m_prcMgr->addNodeForProcess(runtimeName, nodeProperty.m_name);
+            m_prcMgr.addNodeForProcess(runtimeName, nodeProperty.m_name);
         }
         break;
     }
     case runtime::IpcMessageType::KEEPALIVE:
     {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
+        m_prcMgr.updateLivelinessOfProcess(runtimeName);
         break;
     }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
@@ -424,7 +567,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
@@ -437,7 +580,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -445,7 +588,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         LogError() << "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]";
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -456,16 +599,17 @@ void RouDi::registerProcess(const RuntimeName_t& name,
                             const posix::PosixUser user,
                             const int64_t transmissionTimestamp,
                             const uint64_t sessionId,
-                            const version::VersionInfo& versionInfo) noexcept
+                            const version::VersionInfo& versionInfo,
+                            const uint16_t binaryProtocolVersion) noexcept
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
-    IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+    IOX_DISCARD_RESULT(m_prcMgr.registerProcess(
+        name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo, binaryProtocolVersion));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
+    static std::atomic<uint64_t> sessionId{0U};
     return ++sessionId;
 }
 
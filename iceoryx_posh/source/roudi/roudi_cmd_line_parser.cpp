@@ -37,10 +37,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"unique-roudi-id", required_argument, nullptr, 'u'},
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"runtime-messages-threads", required_argument, nullptr, 't'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:t:";
     int32_t index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -73,6 +74,15 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                       << std::endl;
             std::cout << "                                  have't responded after trying SIG_TERM first, in seconds."
                       << std::endl;
+            std::cout << "-t, --runtime-messages-threads <UINT>" << std::endl;
+            std::cout << "                                  Sets the number of threads which process the messages"
+                      << std::endl;
+            std::cout << "                                  of the runtimes concurrently, e.g. their registration."
+                      << std::endl;
+            std::cout << "                                  <UINT> {1.." << roudi::MAX_RUNTIME_MESSAGES_THREAD_COUNT
+                      << "}" << std::endl;
+            std::cout << "                                  default = '" << roudi::DEFAULT_RUNTIME_MESSAGES_THREAD_COUNT
+                      << "'" << std::endl;
 
             m_run = false;
             break;
@@ -165,6 +175,22 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 't':
+        {
+            uint32_t runtimeMessagesThreadCount{0U};
+            if (!cxx::convert::fromString(optarg, runtimeMessagesThreadCount) || runtimeMessagesThreadCount == 0U
+                || runtimeMessagesThreadCount > roudi::MAX_RUNTIME_MESSAGES_THREAD_COUNT)
+            {
+                LogError() << "The number of runtime messages threads must be in the range of [1, "
+                           << roudi::MAX_RUNTIME_MESSAGES_THREAD_COUNT << "]";
+                m_run = false;
+            }
+            else
+            {
+                m_runtimeMessagesThreadCount = runtimeMessagesThreadCount;
+            }
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -218,7 +244,8 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                                      m_processKillDelay,
                                                      m_uniqueRouDiId,
                                                      m_run,
-                                                     iox::roudi::ConfigFilePathString_t("")});
+                                                     iox::roudi::ConfigFilePathString_t(""),
+                                                     m_runtimeMessagesThreadCount});
 } // namespace roudi
 } // namespace config
 } // namespace iox
@@ -16,17 +16,28 @@
 
 #include "iceoryx_posh/roudi/roudi_config.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace config
 {
 RouDiConfig& RouDiConfig::setDefaults() noexcept
 {
+    m_maxNumberOfPublishers = MAX_PUBLISHERS;
+    m_maxNumberOfSubscribers = MAX_SUBSCRIBERS;
+    m_maxNumberOfClients = MAX_CLIENTS;
+    m_maxNumberOfServers = MAX_SERVERS;
+    m_staticConnections.clear();
     return *this;
 }
 
 RouDiConfig& RouDiConfig::optimize() noexcept
 {
+    m_maxNumberOfPublishers = std::min(m_maxNumberOfPublishers, MAX_PUBLISHERS);
+    m_maxNumberOfSubscribers = std::min(m_maxNumberOfSubscribers, MAX_SUBSCRIBERS);
+    m_maxNumberOfClients = std::min(m_maxNumberOfClients, MAX_CLIENTS);
+    m_maxNumberOfServers = std::min(m_maxNumberOfServers, MAX_SERVERS);
     return *this;
 }
 } // namespace config
@@ -23,9 +23,11 @@
 #include "iceoryx_platform/getopt.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
+#include <algorithm>
 #include <cpptoml.h>
 #include <limits> // workaround for missing include in cpptoml.h
 #include <string>
+#include <vector>
 
 namespace iox
 {
@@ -148,6 +150,83 @@ TomlRouDiConfigFileProvider::parse() noexcept
              mempoolConfig});
     }
 
+    // the port data are only allocated for the configured number of ports, without the section for the maxima
+    auto ports = parsedFile->get_table("ports");
+    if (ports)
+    {
+        parsedConfig.m_maxNumberOfPublishers = ports->get_as<uint32_t>("publishers").value_or(iox::MAX_PUBLISHERS);
+        parsedConfig.m_maxNumberOfSubscribers = ports->get_as<uint32_t>("subscribers").value_or(iox::MAX_SUBSCRIBERS);
+        parsedConfig.m_maxNumberOfClients = ports->get_as<uint32_t>("clients").value_or(iox::MAX_CLIENTS);
+        parsedConfig.m_maxNumberOfServers = ports->get_as<uint32_t>("servers").value_or(iox::MAX_SERVERS);
+
+        if (parsedConfig.m_maxNumberOfPublishers > iox::MAX_PUBLISHERS
+            || parsedConfig.m_maxNumberOfSubscribers > iox::MAX_SUBSCRIBERS
+            || parsedConfig.m_maxNumberOfClients > iox::MAX_CLIENTS
+            || parsedConfig.m_maxNumberOfServers > iox::MAX_SERVERS)
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_PORTS_EXCEEDED);
+        }
+    }
+
+    // the ports of the static topology are created and connected by RouDi before the runtimes are started
+    auto connections = parsedFile->get_table_array("connection");
+    if (connections)
+    {
+        if (connections->get().size() > iox::roudi::MAX_STATIC_CONNECTIONS)
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_STATIC_CONNECTIONS_EXCEEDED);
+        }
+
+        auto isValidRuntimeName = [](const std::string& name) {
+            return !name.empty() && name.size() <= iox::RuntimeName_t::capacity();
+        };
+
+        for (auto connection : *connections)
+        {
+            auto service = connection->get_as<std::string>("service");
+            auto instance = connection->get_as<std::string>("instance");
+            auto event = connection->get_as<std::string>("event");
+            if (!service || !instance || !event || service->size() > iox::capro::IdString_t::capacity()
+                || instance->size() > iox::capro::IdString_t::capacity()
+                || event->size() > iox::capro::IdString_t::capacity())
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::STATIC_CONNECTION_WITHOUT_SERVICE_DESCRIPTION);
+            }
+
+            auto publisher = connection->get_as<std::string>("publisher");
+            auto subscribers =
+                connection->get_array_of<std::string>("subscribers").value_or(std::vector<std::string>{});
+            if (!publisher || !isValidRuntimeName(*publisher)
+                || !std::all_of(subscribers.begin(), subscribers.end(), isValidRuntimeName))
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::STATIC_CONNECTION_WITH_INVALID_RUNTIME_NAME);
+            }
+            if (subscribers.size() > iox::roudi::MAX_SUBSCRIBERS_PER_STATIC_CONNECTION)
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::STATIC_CONNECTION_WITH_TOO_MANY_SUBSCRIBERS);
+            }
+
+            iox::config::StaticConnection staticConnection;
+            staticConnection.m_service = {iox::capro::IdString_t(iox::cxx::TruncateToCapacity, *service),
+                                          iox::capro::IdString_t(iox::cxx::TruncateToCapacity, *instance),
+                                          iox::capro::IdString_t(iox::cxx::TruncateToCapacity, *event)};
+            staticConnection.m_publisherRuntimeName = iox::RuntimeName_t(iox::cxx::TruncateToCapacity, *publisher);
+            for (const auto& subscriber : subscribers)
+            {
+                staticConnection.m_subscriberRuntimeNames.emplace_back(iox::cxx::TruncateToCapacity, subscriber);
+            }
+            staticConnection.m_historyCapacity = connection->get_as<uint64_t>("history-capacity").value_or(0U);
+            staticConnection.m_queueCapacity =
+                connection->get_as<uint64_t>("queue-capacity").value_or(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY);
+            parsedConfig.m_staticConnections.push_back(staticConnection);
+        }
+    }
+
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
 }
 } // namespace config
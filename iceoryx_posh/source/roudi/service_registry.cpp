@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_hoofs/cxx/attributes.hpp"
 
 namespace iox
 {
@@ -26,6 +27,55 @@ ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::S
 {
 }
 
+ServiceRegistry::HashIndex::HashIndex() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket = NO_INDEX;
+    }
+    for (auto& next : m_next)
+    {
+        next = NO_INDEX;
+    }
+}
+
+void ServiceRegistry::HashIndex::add(const uint64_t hash, const uint32_t index) noexcept
+{
+    // keep the chain sorted by index, a search then reports the entries in the same order as forEach
+    uint32_t* link = &m_buckets[hash % NUMBER_OF_BUCKETS];
+    while (*link != NO_INDEX && *link < index)
+    {
+        link = &m_next[*link];
+    }
+    m_next[index] = *link;
+    *link = index;
+}
+
+void ServiceRegistry::HashIndex::remove(const uint64_t hash, const uint32_t index) noexcept
+{
+    uint32_t* link = &m_buckets[hash % NUMBER_OF_BUCKETS];
+    while (*link != NO_INDEX)
+    {
+        if (*link == index)
+        {
+            *link = m_next[index];
+            m_next[index] = NO_INDEX;
+            return;
+        }
+        link = &m_next[*link];
+    }
+}
+
+uint32_t ServiceRegistry::HashIndex::first(const uint64_t hash) const noexcept
+{
+    return m_buckets[hash % NUMBER_OF_BUCKETS];
+}
+
+uint32_t ServiceRegistry::HashIndex::next(const uint32_t index) const noexcept
+{
+    return m_next[index];
+}
+
 cxx::expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                            ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
@@ -37,43 +87,32 @@ cxx::expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceD
         // entry exists, increment counter
         auto& entry = m_serviceDescriptions[index];
         ((*entry).*count)++;
+        ++m_generation;
         return cxx::success<>();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
-    if (m_freeIndex != NO_INDEX)
+    // entry does not exist, reuse the slot of a previously removed entry or append a new one
+    if (!m_freeIndices.empty())
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_freeIndex = NO_INDEX;
-        return cxx::success<>();
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
     }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    // the size only grows up to capacity
+    else if (m_serviceDescriptions.emplace_back())
     {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            return cxx::success<>();
-        }
+        index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
     }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    else
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        return cxx::success<>();
+        return cxx::error<Error>(Error::SERVICE_REGISTRY_FULL);
     }
 
-    return cxx::error<Error>(Error::SERVICE_REGISTRY_FULL);
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    addToIndices(index);
+    ++m_generation;
+    return cxx::success<>();
 }
 
 cxx::expected<ServiceRegistry::Error>
@@ -97,11 +136,10 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
 
         if (entry && entry->publisherCount >= 1U)
         {
+            ++m_generation;
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                release(index);
             }
         }
     }
@@ -116,11 +154,10 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
 
         if (entry && entry->serverCount >= 1U)
         {
+            ++m_generation;
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                release(index);
             }
         }
     }
@@ -131,10 +168,8 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
+        release(index);
+        ++m_generation;
     }
 }
 
@@ -143,30 +178,55 @@ void ServiceRegistry::find(const cxx::optional<capro::IdString_t>& service,
                            const cxx::optional<capro::IdString_t>& event,
                            cxx::function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    uint8_t key{0U};
+    if (service)
     {
-        if (entry)
-        {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+        key |= SERVICE;
+    }
+    if (instance)
+    {
+        key |= INSTANCE;
+    }
+    if (event)
+    {
+        key |= EVENT;
+    }
+    if (key == 0U)
+    {
+        forEach(callable);
+        return;
+    }
 
-            if (match)
-            {
-                callable(*entry);
-            }
+    const auto& hashIndex = m_indices[key - 1U];
+    const auto hash = hashOf(key,
+                             service ? &service.value() : nullptr,
+                             instance ? &instance.value() : nullptr,
+                             event ? &event.value() : nullptr);
+
+    // the chain contains all entries with a matching key but also the ones which only share the bucket
+    for (auto index = hashIndex.first(hash); index != NO_INDEX; index = hashIndex.next(index))
+    {
+        auto& entry = m_serviceDescriptions[index];
+        bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+
+        if (match)
+        {
+            callable(*entry);
         }
     }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    const auto& hashIndex = m_indices[SERVICE_INSTANCE_EVENT - 1U];
+    for (auto index = hashIndex.first(hashOf(SERVICE_INSTANCE_EVENT, serviceDescription)); index != NO_INDEX;
+         index = hashIndex.next(index))
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        if (m_serviceDescriptions[index]->serviceDescription == serviceDescription)
         {
-            return i;
+            return index;
         }
     }
     return NO_INDEX;
@@ -183,5 +243,87 @@ void ServiceRegistry::forEach(cxx::function_ref<void(const ServiceDescriptionEnt
     }
 }
 
+uint64_t ServiceRegistry::generation() const noexcept
+{
+    return m_generation;
+}
+
+void ServiceRegistry::apply(const ServiceRegistryChange& change) noexcept
+{
+    switch (change.type)
+    {
+    case ServiceRegistryChange::Type::ADD_PUBLISHER:
+        // cannot fail since the other registry has the same capacity and could add the publisher
+        IOX_DISCARD_RESULT(addPublisher(change.serviceDescription));
+        break;
+    case ServiceRegistryChange::Type::REMOVE_PUBLISHER:
+        removePublisher(change.serviceDescription);
+        break;
+    case ServiceRegistryChange::Type::ADD_SERVER:
+        // cannot fail since the other registry has the same capacity and could add the server
+        IOX_DISCARD_RESULT(addServer(change.serviceDescription));
+        break;
+    case ServiceRegistryChange::Type::REMOVE_SERVER:
+        removeServer(change.serviceDescription);
+        break;
+    }
+    m_generation = change.generation;
+}
+
+void ServiceRegistry::addToIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint8_t key = 1U; key <= NUMBER_OF_KEYS; ++key)
+    {
+        m_indices[key - 1U].add(hashOf(key, serviceDescription), index);
+    }
+}
+
+void ServiceRegistry::release(const uint32_t index) noexcept
+{
+    auto& entry = m_serviceDescriptions[index];
+    for (uint8_t key = 1U; key <= NUMBER_OF_KEYS; ++key)
+    {
+        m_indices[key - 1U].remove(hashOf(key, entry->serviceDescription), index);
+    }
+    entry.reset();
+    // reuse the slot in the next insertion
+    m_freeIndices.push_back(index);
+}
+
+uint64_t ServiceRegistry::hashOf(const uint8_t key,
+                                 const capro::IdString_t* const service,
+                                 const capro::IdString_t* const instance,
+                                 const capro::IdString_t* const event) noexcept
+{
+    // FNV-1a over the key and the selected strings including their terminating zero
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+    uint64_t hash = (FNV_OFFSET_BASIS ^ key) * FNV_PRIME;
+    for (const auto* idString : {service, instance, event})
+    {
+        if (idString == nullptr)
+        {
+            continue;
+        }
+        const auto* character = idString->c_str();
+        for (uint64_t i = 0U; i <= idString->size(); ++i)
+        {
+            hash ^= static_cast<uint8_t>(character[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+uint64_t ServiceRegistry::hashOf(const uint8_t key, const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return hashOf(key,
+                  (key & SERVICE) ? &serviceDescription.getServiceIDString() : nullptr,
+                  (key & INSTANCE) ? &serviceDescription.getInstanceIDString() : nullptr,
+                  (key & EVENT) ? &serviceDescription.getEventIDString() : nullptr);
+}
+
 } // namespace roudi
 } // namespace iox
@@ -0,0 +1,174 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/command_channel.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint64_t CommandChannelQueue::CAPACITY;
+
+CommandChannelQueue::CommandChannelQueue() noexcept
+{
+    posix::BinarySemaphoreBuilder().isInterProcessCapable(true).create(m_wakeUpSemaphore).or_else([](auto) {
+        errorHandler(PoshError::IPC_INTERFACE__COMMAND_CHANNEL_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+    });
+}
+
+bool CommandChannelQueue::push(const uint32_t index) noexcept
+{
+    if (!m_queue.tryPush(index))
+    {
+        return false;
+    }
+    IOX_DISCARD_RESULT(m_wakeUpSemaphore->post());
+    return true;
+}
+
+cxx::optional<uint32_t> CommandChannelQueue::timedPop(const units::Duration& timeout) noexcept
+{
+    auto index = m_queue.pop();
+    if (!index.has_value())
+    {
+        IOX_DISCARD_RESULT(m_wakeUpSemaphore->timedWait(timeout));
+        index = m_queue.pop();
+    }
+
+    // a post wakes up only one of the waiting threads, the remaining requests are handed over to the next one
+    if (index.has_value() && !m_queue.empty())
+    {
+        IOX_DISCARD_RESULT(m_wakeUpSemaphore->post());
+    }
+    return index;
+}
+
+CommandChannel::CommandChannel() noexcept
+{
+    posix::BinarySemaphoreBuilder().isInterProcessCapable(true).create(m_responseSemaphore).or_else([](auto) {
+        errorHandler(PoshError::IPC_INTERFACE__COMMAND_CHANNEL_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+    });
+}
+
+void CommandChannel::open(const RuntimeName_t& runtimeName, CommandChannelQueue& queue, const uint32_t index) noexcept
+{
+    m_runtimeName = runtimeName;
+    m_queue = &queue;
+    m_index = index;
+    m_request.clear();
+    m_response.clear();
+    // a response of the previous owner which was never consumed must not wake up the new one
+    IOX_DISCARD_RESULT(m_responseSemaphore->tryWait());
+    m_state.store(STATE_IDLE, std::memory_order_relaxed);
+    m_isOpen.store(true, std::memory_order_release);
+}
+
+void CommandChannel::close() noexcept
+{
+    m_isOpen.store(false, std::memory_order_release);
+    m_state.store(STATE_IDLE, std::memory_order_release);
+}
+
+bool CommandChannel::isOpen() const noexcept
+{
+    return m_isOpen.load(std::memory_order_acquire);
+}
+
+RuntimeName_t CommandChannel::runtimeName() const noexcept
+{
+    return m_runtimeName;
+}
+
+cxx::expected<CommandChannelError> CommandChannel::sendRequest(const IpcMessage& request,
+                                                               IpcMessage& response) noexcept
+{
+    if (!isOpen())
+    {
+        return cxx::error<CommandChannelError>(CommandChannelError::CHANNEL_CLOSED);
+    }
+
+    if (!request.isValid())
+    {
+        return cxx::error<CommandChannelError>(CommandChannelError::INVALID_MESSAGE);
+    }
+
+    uint32_t expectedState{STATE_IDLE};
+    if (!m_state.compare_exchange_strong(
+            expectedState, STATE_WRITING_REQUEST, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return cxx::error<CommandChannelError>(CommandChannelError::CHANNEL_BUSY);
+    }
+
+    if (!m_request.unsafe_assign(request.getMessage()))
+    {
+        m_state.store(STATE_IDLE, std::memory_order_relaxed);
+        return cxx::error<CommandChannelError>(CommandChannelError::MESSAGE_TOO_LARGE);
+    }
+
+    m_state.store(STATE_REQUEST_PENDING, std::memory_order_release);
+    if (!m_queue->push(m_index))
+    {
+        // RouDi takes only requests which were pushed, therefore nobody else changed the state meanwhile
+        m_state.store(STATE_IDLE, std::memory_order_relaxed);
+        return cxx::error<CommandChannelError>(CommandChannelError::SUBMISSION_FAILED);
+    }
+
+    while (m_state.load(std::memory_order_acquire) != STATE_RESPONSE_READY)
+    {
+        IOX_DISCARD_RESULT(m_responseSemaphore->wait());
+    }
+
+    response.setMessage(m_response.c_str());
+    m_state.store(STATE_IDLE, std::memory_order_release);
+    return cxx::success<>();
+}
+
+bool CommandChannel::takeRequest(IpcMessage& request) noexcept
+{
+    uint32_t expectedState{STATE_REQUEST_PENDING};
+    if (!m_state.compare_exchange_strong(
+            expectedState, STATE_PROCESSING, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    request.setMessage(m_request.c_str());
+    return true;
+}
+
+bool CommandChannel::sendResponse(const IpcMessage& response) noexcept
+{
+    uint32_t expectedState{STATE_PROCESSING};
+    if (!m_state.compare_exchange_strong(
+            expectedState, STATE_WRITING_RESPONSE, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    if (!m_response.unsafe_assign(response.getMessage()))
+    {
+        // the runtime receives an empty response which is treated like an invalid one
+        m_response.clear();
+    }
+
+    m_state.store(STATE_RESPONSE_READY, std::memory_order_release);
+    IOX_DISCARD_RESULT(m_responseSemaphore->post());
+    return true;
+}
+
+} // namespace runtime
+} // namespace iox
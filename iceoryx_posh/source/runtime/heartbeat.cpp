@@ -0,0 +1,39 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+Heartbeat::Heartbeat(const RuntimeName_t& runtimeName) noexcept
+    : m_runtimeName(runtimeName)
+{
+}
+
+void Heartbeat::beat() noexcept
+{
+    // only the change of the counter is of interest, there is no data which needs to be synchronized
+    m_counter.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint64_t Heartbeat::counter() const noexcept
+{
+    return m_counter.load(std::memory_order_relaxed);
+}
+} // namespace runtime
+} // namespace iox
@@ -0,0 +1,185 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_frame.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace runtime
+{
+namespace
+{
+/// @brief a COBS block contains at most 254 non-zero bytes, its code byte is the block length plus one
+constexpr uint8_t COBS_MAX_CODE{0xFFU};
+
+/// @brief the worst case size of an encoded frame, the marker, one code byte per started block and the final one
+constexpr uint64_t MAX_ENCODED_SIZE{1U + IpcBinaryFrame::CAPACITY + IpcBinaryFrame::CAPACITY / (COBS_MAX_CODE - 1U)
+                                    + 1U};
+static_assert(MAX_ENCODED_SIZE <= ROUDI_MESSAGE_SIZE && MAX_ENCODED_SIZE <= APP_MESSAGE_SIZE,
+              "An encoded binary frame must fit into the IPC messages");
+} // namespace
+
+constexpr uint64_t IpcBinaryFrame::CAPACITY;
+
+IpcBinaryFrame& IpcBinaryFrame::operator>>(bool& value) noexcept
+{
+    uint8_t byte{0U};
+    if (read(&byte, sizeof(byte)))
+    {
+        if (byte > 1U)
+        {
+            m_isValid = false;
+        }
+        else
+        {
+            value = (byte == 1U);
+        }
+    }
+    return *this;
+}
+
+bool IpcBinaryFrame::isValid() const noexcept
+{
+    return m_isValid;
+}
+
+void IpcBinaryFrame::invalidate() noexcept
+{
+    m_isValid = false;
+}
+
+uint64_t IpcBinaryFrame::size() const noexcept
+{
+    return m_size;
+}
+
+void IpcBinaryFrame::clear() noexcept
+{
+    m_size = 0U;
+    m_readPosition = 0U;
+    m_isValid = true;
+}
+
+bool IpcBinaryFrame::write(const void* const data, const uint64_t size) noexcept
+{
+    if (!m_isValid || m_size + size > CAPACITY)
+    {
+        m_isValid = false;
+        return false;
+    }
+    std::memcpy(&m_data[m_size], data, size);
+    m_size += size;
+    return true;
+}
+
+bool IpcBinaryFrame::read(void* const data, const uint64_t size) noexcept
+{
+    if (!m_isValid || m_readPosition + size > m_size)
+    {
+        m_isValid = false;
+        return false;
+    }
+    std::memcpy(data, &m_data[m_readPosition], size);
+    m_readPosition += size;
+    return true;
+}
+
+bool IpcBinaryFrame::encode(IpcMessage& message) const noexcept
+{
+    if (!m_isValid)
+    {
+        return false;
+    }
+
+    message.clearMessage();
+    auto& encoded = message.m_msg;
+    encoded.reserve(MAX_ENCODED_SIZE);
+    encoded.push_back(IpcMessage::BINARY_FRAME_MARKER);
+
+    // every zero byte is replaced by the code byte of the following block which holds the distance to the next zero
+    auto codePosition = encoded.size();
+    encoded.push_back(0);
+    uint8_t code{1U};
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        if (m_data[i] != 0U)
+        {
+            encoded.push_back(static_cast<char>(m_data[i]));
+            ++code;
+        }
+
+        if (m_data[i] == 0U || code == COBS_MAX_CODE)
+        {
+            encoded[codePosition] = static_cast<char>(code);
+            codePosition = encoded.size();
+            encoded.push_back(0);
+            code = 1U;
+        }
+    }
+    encoded[codePosition] = static_cast<char>(code);
+
+    return true;
+}
+
+bool IpcBinaryFrame::decode(const IpcMessage& message) noexcept
+{
+    clear();
+    if (!message.isBinaryFrame())
+    {
+        m_isValid = false;
+        return false;
+    }
+
+    const auto& encoded = message.m_msg;
+    const uint64_t encodedSize = encoded.size();
+    uint64_t position{1U};
+    while (position < encodedSize)
+    {
+        const auto code = static_cast<uint8_t>(encoded[position]);
+        ++position;
+        if (code == 0U || position + code - 1U > encodedSize || m_size + code - 1U > CAPACITY)
+        {
+            m_isValid = false;
+            return false;
+        }
+
+        for (uint8_t i = 1U; i < code; ++i)
+        {
+            m_data[m_size] = static_cast<uint8_t>(encoded[position]);
+            ++m_size;
+            ++position;
+        }
+
+        // a block which is shorter than the maximum and not the last one was terminated by a zero byte
+        if (code != COBS_MAX_CODE && position < encodedSize)
+        {
+            if (m_size >= CAPACITY)
+            {
+                m_isValid = false;
+                return false;
+            }
+            m_data[m_size] = 0U;
+            ++m_size;
+        }
+    }
+
+    return true;
+}
+
+} // namespace runtime
+} // namespace iox
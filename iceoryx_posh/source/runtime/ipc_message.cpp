@@ -18,12 +18,14 @@
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 namespace iox
 {
 namespace runtime
 {
 const char IpcMessage::m_separator = ',';
+constexpr char IpcMessage::BINARY_FRAME_MARKER;
 
 IpcMessage::IpcMessage(const std::initializer_list<std::string>& msg) noexcept
 {
@@ -72,6 +74,11 @@ bool IpcMessage::isValidEntry(const std::string& entry) const noexcept
     return true;
 }
 
+bool IpcMessage::isValidEntry(const char* const entry) const noexcept
+{
+    return std::strchr(entry, m_separator) == nullptr;
+}
+
 bool IpcMessage::isValid() const noexcept
 {
     return m_isValid;
@@ -87,7 +94,11 @@ void IpcMessage::setMessage(const std::string& msg) noexcept
     clearMessage();
 
     m_msg = msg;
-    if (!m_msg.empty() && m_msg.back() != m_separator)
+    if (isBinaryFrame())
+    {
+        // the encoded frame has no entries, it is decoded by the IpcBinaryFrame
+    }
+    else if (!m_msg.empty() && m_msg.back() != m_separator)
     {
         m_isValid = false;
     }
@@ -105,6 +116,11 @@ void IpcMessage::clearMessage() noexcept
     m_isValid = true;
 }
 
+bool IpcMessage::isBinaryFrame() const noexcept
+{
+    return !m_msg.empty() && m_msg.front() == BINARY_FRAME_MARKER;
+}
+
 bool IpcMessage::operator==(const IpcMessage& rhs) const noexcept
 {
     return this->getMessage() == rhs.getMessage();
@@ -0,0 +1,293 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_port_request.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+namespace
+{
+template <typename Enum>
+void invalidateIfGreater(IpcBinaryFrame& frame, const Enum value, const Enum maxValue) noexcept
+{
+    using UnderlyingType = std::underlying_type_t<Enum>;
+    if (static_cast<UnderlyingType>(value) > static_cast<UnderlyingType>(maxValue))
+    {
+        frame.invalidate();
+    }
+}
+} // namespace
+
+IpcMessageType getAckForPortRequest(const IpcMessageType requestType) noexcept
+{
+    switch (requestType)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return IpcMessageType::CREATE_PUBLISHER_ACK;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return IpcMessageType::CREATE_SUBSCRIBER_ACK;
+    case IpcMessageType::CREATE_CLIENT:
+        return IpcMessageType::CREATE_CLIENT_ACK;
+    case IpcMessageType::CREATE_SERVER:
+        return IpcMessageType::CREATE_SERVER_ACK;
+    case IpcMessageType::CREATE_INTERFACE:
+        return IpcMessageType::CREATE_INTERFACE_ACK;
+    case IpcMessageType::CREATE_CONDITION_VARIABLE:
+        return IpcMessageType::CREATE_CONDITION_VARIABLE_ACK;
+    case IpcMessageType::CREATE_NODE:
+        return IpcMessageType::CREATE_NODE_ACK;
+    default:
+        return IpcMessageType::NOTYPE;
+    }
+}
+
+bool hasValidIpcMessageEntries(const IpcPortRequest& request) noexcept
+{
+    const IpcMessage message;
+    const auto& service = request.service;
+    if (!message.isValidEntry(service.getServiceIDString().c_str())
+        || !message.isValidEntry(service.getInstanceIDString().c_str())
+        || !message.isValidEntry(service.getEventIDString().c_str()))
+    {
+        return false;
+    }
+
+    switch (request.type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return message.isValidEntry(request.publisherOptions.nodeName.c_str());
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return message.isValidEntry(request.subscriberOptions.nodeName.c_str());
+    case IpcMessageType::CREATE_CLIENT:
+        return message.isValidEntry(request.clientOptions.nodeName.c_str());
+    case IpcMessageType::CREATE_SERVER:
+        return message.isValidEntry(request.serverOptions.nodeName.c_str());
+    case IpcMessageType::CREATE_INTERFACE:
+    case IpcMessageType::CREATE_NODE:
+        return message.isValidEntry(request.nodeName.c_str());
+    default:
+        return true;
+    }
+}
+
+bool isSamePortRequest(const IpcPortRequest& lhs, const IpcPortRequest& rhs) noexcept
+{
+    if (lhs.type != rhs.type)
+    {
+        return false;
+    }
+
+    switch (lhs.type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return lhs.service == rhs.service && lhs.publisherOptions == rhs.publisherOptions
+               && lhs.portConfigInfo == rhs.portConfigInfo;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return lhs.service == rhs.service && lhs.subscriberOptions == rhs.subscriberOptions
+               && lhs.portConfigInfo == rhs.portConfigInfo;
+    case IpcMessageType::CREATE_CLIENT:
+        return lhs.service == rhs.service && lhs.clientOptions == rhs.clientOptions
+               && lhs.portConfigInfo == rhs.portConfigInfo;
+    case IpcMessageType::CREATE_SERVER:
+        return lhs.service == rhs.service && lhs.serverOptions == rhs.serverOptions
+               && lhs.portConfigInfo == rhs.portConfigInfo;
+    case IpcMessageType::CREATE_INTERFACE:
+        return lhs.interface == rhs.interface && lhs.nodeName == rhs.nodeName;
+    case IpcMessageType::CREATE_NODE:
+        return lhs.nodeName == rhs.nodeName && lhs.nodeDeviceIdentifier == rhs.nodeDeviceIdentifier;
+    default:
+        return true;
+    }
+}
+
+IpcBinaryFrame& operator<<(IpcBinaryFrame& frame, const capro::ServiceDescription& service) noexcept
+{
+    const auto classHash = service.getClassHash();
+    return frame << service.getServiceIDString() << service.getInstanceIDString() << service.getEventIDString()
+                 << classHash[0U] << classHash[1U] << classHash[2U] << classHash[3U] << service.getScope()
+                 << service.getSourceInterface();
+}
+
+IpcBinaryFrame& operator>>(IpcBinaryFrame& frame, capro::ServiceDescription& service) noexcept
+{
+    capro::IdString_t serviceString;
+    capro::IdString_t instanceString;
+    capro::IdString_t eventString;
+    capro::ServiceDescription::ClassHash classHash;
+    capro::Scope scope{capro::Scope::WORLDWIDE};
+    capro::Interfaces interface{capro::Interfaces::INTERNAL};
+
+    frame >> serviceString >> instanceString >> eventString >> classHash[0U] >> classHash[1U] >> classHash[2U]
+        >> classHash[3U] >> scope >> interface;
+    if (!frame.isValid() || scope >= capro::Scope::INVALID || interface >= capro::Interfaces::INTERFACE_END)
+    {
+        frame.invalidate();
+        return frame;
+    }
+
+    service = capro::ServiceDescription(serviceString, instanceString, eventString, classHash, interface);
+    if (scope == capro::Scope::LOCAL)
+    {
+        service.setLocal();
+    }
+    return frame;
+}
+
+IpcBinaryFrame& operator<<(IpcBinaryFrame& frame, const IpcPortRequest& request) noexcept
+{
+    frame << request.type;
+    switch (request.type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+    {
+        const auto& options = request.publisherOptions;
+        frame << request.service << options.historyCapacity << options.nodeName << options.offerOnCreate
+              << options.subscriberTooSlowPolicy;
+        break;
+    }
+    case IpcMessageType::CREATE_SUBSCRIBER:
+    {
+        const auto& options = request.subscriberOptions;
+        frame << request.service << options.queueCapacity << options.historyRequest << options.nodeName
+              << options.subscribeOnCreate << options.queueFullPolicy << options.requiresPublisherHistorySupport
+              << options.useShardedQueue << options.deadline.toNanoseconds();
+        break;
+    }
+    case IpcMessageType::CREATE_CLIENT:
+    {
+        const auto& options = request.clientOptions;
+        frame << request.service << options.responseQueueCapacity << options.nodeName << options.connectOnCreate
+              << options.responseQueueFullPolicy << options.serverTooSlowPolicy;
+        break;
+    }
+    case IpcMessageType::CREATE_SERVER:
+    {
+        const auto& options = request.serverOptions;
+        frame << request.service << options.requestQueueCapacity << options.nodeName << options.offerOnCreate
+              << options.requestQueueFullPolicy << options.clientTooSlowPolicy;
+        break;
+    }
+    case IpcMessageType::CREATE_INTERFACE:
+        frame << request.interface << request.nodeName;
+        break;
+    case IpcMessageType::CREATE_NODE:
+        frame << request.nodeName << request.nodeDeviceIdentifier;
+        break;
+    case IpcMessageType::CREATE_CONDITION_VARIABLE:
+        break;
+    default:
+        frame.invalidate();
+        break;
+    }
+
+    if (request.type == IpcMessageType::CREATE_PUBLISHER || request.type == IpcMessageType::CREATE_SUBSCRIBER
+        || request.type == IpcMessageType::CREATE_CLIENT || request.type == IpcMessageType::CREATE_SERVER)
+    {
+        frame << request.portConfigInfo.portType << request.portConfigInfo.memoryInfo.deviceId
+              << request.portConfigInfo.memoryInfo.memoryType;
+    }
+    return frame;
+}
+
+IpcBinaryFrame& operator>>(IpcBinaryFrame& frame, IpcPortRequest& request) noexcept
+{
+    frame >> request.type;
+    switch (request.type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+    {
+        auto& options = request.publisherOptions;
+        frame >> request.service >> options.historyCapacity >> options.nodeName >> options.offerOnCreate
+            >> options.subscriberTooSlowPolicy;
+        invalidateIfGreater(
+            frame, options.subscriberTooSlowPolicy, popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA);
+        break;
+    }
+    case IpcMessageType::CREATE_SUBSCRIBER:
+    {
+        auto& options = request.subscriberOptions;
+        uint64_t deadlineInNanoseconds{0U};
+        frame >> request.service >> options.queueCapacity >> options.historyRequest >> options.nodeName
+            >> options.subscribeOnCreate >> options.queueFullPolicy >> options.requiresPublisherHistorySupport
+            >> options.useShardedQueue >> deadlineInNanoseconds;
+        invalidateIfGreater(frame, options.queueFullPolicy, popo::QueueFullPolicy::DISCARD_OLDEST_DATA);
+        options.deadline = units::Duration::fromNanoseconds(deadlineInNanoseconds);
+        break;
+    }
+    case IpcMessageType::CREATE_CLIENT:
+    {
+        auto& options = request.clientOptions;
+        frame >> request.service >> options.responseQueueCapacity >> options.nodeName >> options.connectOnCreate
+            >> options.responseQueueFullPolicy >> options.serverTooSlowPolicy;
+        invalidateIfGreater(frame, options.responseQueueFullPolicy, popo::QueueFullPolicy::DISCARD_OLDEST_DATA);
+        invalidateIfGreater(frame, options.serverTooSlowPolicy, popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA);
+        break;
+    }
+    case IpcMessageType::CREATE_SERVER:
+    {
+        auto& options = request.serverOptions;
+        frame >> request.service >> options.requestQueueCapacity >> options.nodeName >> options.offerOnCreate
+            >> options.requestQueueFullPolicy >> options.clientTooSlowPolicy;
+        invalidateIfGreater(frame, options.requestQueueFullPolicy, popo::QueueFullPolicy::DISCARD_OLDEST_DATA);
+        invalidateIfGreater(frame, options.clientTooSlowPolicy, popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA);
+        break;
+    }
+    case IpcMessageType::CREATE_INTERFACE:
+        frame >> request.interface >> request.nodeName;
+        if (request.interface >= capro::Interfaces::INTERFACE_END)
+        {
+            frame.invalidate();
+        }
+        break;
+    case IpcMessageType::CREATE_NODE:
+        frame >> request.nodeName >> request.nodeDeviceIdentifier;
+        break;
+    case IpcMessageType::CREATE_CONDITION_VARIABLE:
+        break;
+    default:
+        frame.invalidate();
+        break;
+    }
+
+    if (request.type == IpcMessageType::CREATE_PUBLISHER || request.type == IpcMessageType::CREATE_SUBSCRIBER
+        || request.type == IpcMessageType::CREATE_CLIENT || request.type == IpcMessageType::CREATE_SERVER)
+    {
+        frame >> request.portConfigInfo.portType >> request.portConfigInfo.memoryInfo.deviceId
+            >> request.portConfigInfo.memoryInfo.memoryType;
+    }
+    return frame;
+}
+
+IpcBinaryFrame& operator<<(IpcBinaryFrame& frame, const IpcPortResponse& response) noexcept
+{
+    return frame << response.type << response.error << response.offset << response.segmentId;
+}
+
+IpcBinaryFrame& operator>>(IpcBinaryFrame& frame, IpcPortResponse& response) noexcept
+{
+    frame >> response.type >> response.error >> response.offset >> response.segmentId;
+    if (response.type <= IpcMessageType::BEGIN || response.type >= IpcMessageType::END
+        || response.error < IpcMessageErrorType::BEGIN || response.error >= IpcMessageErrorType::END)
+    {
+        frame.invalidate();
+    }
+    return frame;
+}
+
+} // namespace runtime
+} // namespace iox
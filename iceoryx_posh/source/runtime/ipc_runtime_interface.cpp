@@ -29,10 +29,18 @@ namespace runtime
 {
 IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
                                          const RuntimeName_t& runtimeName,
-                                         const units::Duration roudiWaitingTimeout) noexcept
+                                         const units::Duration roudiWaitingTimeout,
+                                         InProcessRequestHandler* const inProcessRequestHandler) noexcept
     : m_runtimeName(runtimeName)
-    , m_RoudiIpcInterface(roudiName)
+    , m_inProcessRequestHandler(inProcessRequestHandler)
 {
+    if (m_inProcessRequestHandler != nullptr)
+    {
+        registerInProcess();
+        return;
+    }
+
+    m_RoudiIpcInterface.emplace(roudiName);
     m_AppIpcInterface.emplace(runtimeName);
     if (!m_AppIpcInterface->isInitialized())
     {
@@ -54,10 +62,10 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
     auto regState = RegState::WAIT_FOR_ROUDI;
     while (!timer.hasExpired() && regState != RegState::FINISHED)
     {
-        if (!m_RoudiIpcInterface.isInitialized() || !m_RoudiIpcInterface.ipcChannelMapsToFile())
+        if (!m_RoudiIpcInterface->isInitialized() || !m_RoudiIpcInterface->ipcChannelMapsToFile())
         {
             LogDebug() << "reopen RouDi's IPC channel!";
-            m_RoudiIpcInterface.reopen();
+            m_RoudiIpcInterface->reopen();
             regState = RegState::WAIT_FOR_ROUDI;
         }
 
@@ -66,7 +74,7 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
         case RegState::WAIT_FOR_ROUDI:
         {
             waitForRoudi(timer);
-            if (m_RoudiIpcInterface.isInitialized())
+            if (m_RoudiIpcInterface->isInitialized())
             {
                 regState = RegState::SEND_REGISTER_REQUEST;
             }
@@ -75,25 +83,11 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
         case RegState::SEND_REGISTER_REQUEST:
         {
             using namespace units;
-            using namespace std::chrono;
-            auto timestamp = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
-            while (transmissionTimestamp == timestamp)
-            {
-                timestamp = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
-            }
-            transmissionTimestamp = timestamp;
+            transmissionTimestamp = createTransmissionTimestamp(transmissionTimestamp);
 
             // send IpcMessageType::REG to RouDi
-
-            IpcMessage sendBuffer;
-            int pid = getpid();
-            cxx::Expects(pid >= 0);
-            sendBuffer << IpcMessageTypeToString(IpcMessageType::REG) << m_runtimeName << cxx::convert::toString(pid)
-                       << cxx::convert::toString(posix::PosixUser::getUserOfCurrentProcess().getID())
-                       << cxx::convert::toString(transmissionTimestamp)
-                       << static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString();
-
-            bool successfullySent = m_RoudiIpcInterface.timedSend(sendBuffer, 100_ms);
+            bool successfullySent =
+                m_RoudiIpcInterface->timedSend(createRegisterRequest(transmissionTimestamp), 100_ms);
 
             if (successfullySent)
             {
@@ -143,10 +137,55 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
     }
 }
 
+void IpcRuntimeInterface::registerInProcess() noexcept
+{
+    const auto transmissionTimestamp = createTransmissionTimestamp(0);
+    IpcMessage response;
+    if (!m_inProcessRequestHandler->processRequest(createRegisterRequest(transmissionTimestamp), response))
+    {
+        errorHandler(PoshError::IPC_INTERFACE__REG_ACK_NO_RESPONSE);
+        return;
+    }
+
+    if (!readRegAck(response, transmissionTimestamp))
+    {
+        errorHandler(PoshError::IPC_INTERFACE__REG_ACK_NO_RESPONSE);
+    }
+}
+
+int64_t IpcRuntimeInterface::createTransmissionTimestamp(const int64_t previousTimestamp) const noexcept
+{
+    using namespace std::chrono;
+    auto timestamp = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+    while (previousTimestamp == timestamp)
+    {
+        timestamp = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+    }
+    return timestamp;
+}
+
+IpcMessage IpcRuntimeInterface::createRegisterRequest(const int64_t transmissionTimestamp) const noexcept
+{
+    IpcMessage sendBuffer;
+    int pid = getpid();
+    cxx::Expects(pid >= 0);
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::REG) << m_runtimeName << cxx::convert::toString(pid)
+               << cxx::convert::toString(posix::PosixUser::getUserOfCurrentProcess().getID())
+               << cxx::convert::toString(transmissionTimestamp)
+               << static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+    // RouDis of earlier releases accept only the six elements above and ignore this REG, a RouDi of this release
+    // accepts both variants
+    if (m_inProcessRequestHandler == nullptr)
+    {
+        sendBuffer << cxx::convert::toString(IPC_BINARY_PROTOCOL_VERSION);
+    }
+    return sendBuffer;
+}
+
 bool IpcRuntimeInterface::sendKeepalive() noexcept
 {
-    return (m_sendKeepalive)
-               ? m_RoudiIpcInterface.send({IpcMessageTypeToString(IpcMessageType::KEEPALIVE), m_runtimeName})
+    return (m_sendKeepalive && m_RoudiIpcInterface.has_value())
+               ? m_RoudiIpcInterface->send({IpcMessageTypeToString(IpcMessageType::KEEPALIVE), m_runtimeName})
                : true;
 }
 
@@ -159,7 +198,23 @@ memory::UntypedRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerA
 
 bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
-    if (!m_RoudiIpcInterface.send(msg))
+    if (m_inProcessRequestHandler != nullptr)
+    {
+        return m_inProcessRequestHandler->processRequest(msg, answer);
+    }
+
+    if (m_commandChannel != nullptr)
+    {
+        auto result = m_commandChannel->sendRequest(msg, answer);
+        if (!result.has_error())
+        {
+            return true;
+        }
+        // e.g. a concurrent request which is sent while another one is in flight
+        LogDebug() << "The command channel is not available, the request is sent via the IPC channel.";
+    }
+
+    if (!m_RoudiIpcInterface->send(msg))
     {
         LogError() << "Could not send request via RouDi IPC channel interface.\n";
         return false;
@@ -174,6 +229,65 @@ bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage&
     return true;
 }
 
+bool IpcRuntimeInterface::sendRequestToRouDi(const IpcBinaryFrame& request, IpcBinaryFrame& answer) noexcept
+{
+    if (m_binaryProtocolVersion == 0U || !request.encode(m_binaryRequestMessage))
+    {
+        LogError() << "Could not encode the binary request for RouDi.\n";
+        return false;
+    }
+
+    if (!sendRequestToRouDi(m_binaryRequestMessage, m_binaryResponseMessage))
+    {
+        return false;
+    }
+
+    if (!answer.decode(m_binaryResponseMessage))
+    {
+        LogError() << "Received an invalid binary response from RouDi.\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool IpcRuntimeInterface::sendRequestToRouDi(const IpcPortRequest& request, IpcPortResponse& response) noexcept
+{
+    if (m_inProcessRequestHandler == nullptr)
+    {
+        return false;
+    }
+
+    response = m_inProcessRequestHandler->processPortRequest(m_runtimeName, request);
+    return true;
+}
+
+bool IpcRuntimeInterface::isInProcess() const noexcept
+{
+    return m_inProcessRequestHandler != nullptr;
+}
+
+uint16_t IpcRuntimeInterface::getBinaryProtocolVersion() const noexcept
+{
+    return m_binaryProtocolVersion;
+}
+
+cxx::optional<memory::UntypedRelativePointer::offset_t> IpcRuntimeInterface::getHeartbeatAddressOffset() const noexcept
+{
+    return m_heartbeatAddressOffset;
+}
+
+cxx::optional<memory::UntypedRelativePointer::offset_t>
+IpcRuntimeInterface::getCommandChannelAddressOffset() const noexcept
+{
+    return m_commandChannelAddressOffset;
+}
+
+void IpcRuntimeInterface::attachCommandChannel(CommandChannel* const commandChannel) noexcept
+{
+    m_commandChannel = commandChannel;
+}
+
 size_t IpcRuntimeInterface::getShmTopicSize() noexcept
 {
     return m_shmTopicSize;
@@ -183,11 +297,11 @@ void IpcRuntimeInterface::waitForRoudi(cxx::DeadlineTimer& timer) noexcept
 {
     bool printWaitingWarning = true;
     bool printFoundMessage = false;
-    while (!timer.hasExpired() && !m_RoudiIpcInterface.isInitialized())
+    while (!timer.hasExpired() && !m_RoudiIpcInterface->isInitialized())
     {
-        m_RoudiIpcInterface.reopen();
+        m_RoudiIpcInterface->reopen();
 
-        if (m_RoudiIpcInterface.isInitialized())
+        if (m_RoudiIpcInterface->isInitialized())
         {
             LogDebug() << "RouDi IPC Channel found!";
             break;
@@ -202,7 +316,7 @@ void IpcRuntimeInterface::waitForRoudi(cxx::DeadlineTimer& timer) noexcept
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
-    if (printFoundMessage && m_RoudiIpcInterface.isInitialized())
+    if (printFoundMessage && m_RoudiIpcInterface->isInitialized())
     {
         LogWarn() << "... RouDi found.";
     }
@@ -218,45 +332,85 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
         using namespace units::duration_literals;
         IpcMessage receiveBuffer;
         // wait for IpcMessageType::REG_ACK from RouDi for 1 seconds
-        if (m_AppIpcInterface->timedReceive(1_s, receiveBuffer))
+        if (m_AppIpcInterface->timedReceive(1_s, receiveBuffer) && readRegAck(receiveBuffer, transmissionTimestamp))
         {
-            std::string cmd = receiveBuffer.getElementAtIndex(0U);
+            return RegAckResult::SUCCESS;
+        }
+    }
+
+    return RegAckResult::TIMEOUT;
+}
+
+bool IpcRuntimeInterface::readRegAck(const IpcMessage& message, const int64_t transmissionTimestamp) noexcept
+{
+    std::string cmd = message.getElementAtIndex(0U);
+
+    if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
+    {
+        // RouDi appends the negotiated binary protocol version if it supports the binary protocol, the offset of the
+        // heartbeat if the runtime is monitored and the offset of the command channel; the heartbeat offset is the null
+        // pointer offset if there is only a command channel
+        constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
+        constexpr uint32_t REGISTER_ACK_PARAMETERS_WITH_BINARY_PROTOCOL = 7U;
+        constexpr uint32_t REGISTER_ACK_PARAMETERS_WITH_HEARTBEAT = 8U;
+        constexpr uint32_t REGISTER_ACK_PARAMETERS_WITH_COMMAND_CHANNEL = 9U;
+        const auto numberOfParameters = message.getNumberOfElements();
+        if (numberOfParameters != REGISTER_ACK_PARAMETERS
+            && numberOfParameters != REGISTER_ACK_PARAMETERS_WITH_BINARY_PROTOCOL
+            && numberOfParameters != REGISTER_ACK_PARAMETERS_WITH_HEARTBEAT
+            && numberOfParameters != REGISTER_ACK_PARAMETERS_WITH_COMMAND_CHANNEL)
+        {
+            errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
+        }
+
+        // read out the shared memory base address and save it
+        iox::cxx::convert::fromString(message.getElementAtIndex(1U).c_str(), m_shmTopicSize);
+        memory::UntypedRelativePointer::offset_t offset{0U};
+        iox::cxx::convert::fromString(message.getElementAtIndex(2U).c_str(), offset);
+        m_segmentManagerAddressOffset.emplace(offset);
 
-            if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
+        int64_t receivedTimestamp{0U};
+        cxx::convert::fromString(message.getElementAtIndex(3U).c_str(), receivedTimestamp);
+        cxx::convert::fromString(message.getElementAtIndex(4U).c_str(), m_segmentId);
+        cxx::convert::fromString(message.getElementAtIndex(5U).c_str(), m_sendKeepalive);
+        m_binaryProtocolVersion = 0U;
+        if (numberOfParameters >= REGISTER_ACK_PARAMETERS_WITH_BINARY_PROTOCOL)
+        {
+            cxx::convert::fromString(message.getElementAtIndex(6U).c_str(), m_binaryProtocolVersion);
+        }
+        m_heartbeatAddressOffset.reset();
+        if (numberOfParameters >= REGISTER_ACK_PARAMETERS_WITH_HEARTBEAT)
+        {
+            // without a heartbeat RouDi sends the NULL_POINTER_OFFSET, it is compared as string since it equals the
+            // error value of strtoull and cannot be converted
+            const auto heartbeatOffsetString = message.getElementAtIndex(7U);
+            memory::UntypedRelativePointer::offset_t heartbeatOffset{0U};
+            if (heartbeatOffsetString != cxx::convert::toString(memory::UntypedRelativePointer::NULL_POINTER_OFFSET)
+                && cxx::convert::fromString(heartbeatOffsetString.c_str(), heartbeatOffset))
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
-                if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
-                {
-                    errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
-                }
-
-                // read out the shared memory base address and save it
-                iox::cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), m_shmTopicSize);
-                memory::UntypedRelativePointer::offset_t offset{0U};
-                iox::cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), offset);
-                m_segmentManagerAddressOffset.emplace(offset);
-
-                int64_t receivedTimestamp{0U};
-                cxx::convert::fromString(receiveBuffer.getElementAtIndex(3U).c_str(), receivedTimestamp);
-                cxx::convert::fromString(receiveBuffer.getElementAtIndex(4U).c_str(), m_segmentId);
-                cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), m_sendKeepalive);
-                if (transmissionTimestamp == receivedTimestamp)
-                {
-                    return RegAckResult::SUCCESS;
-                }
-                else
-                {
-                    LogWarn() << "Received a REG_ACK with an outdated timestamp!";
-                }
+                m_heartbeatAddressOffset.emplace(heartbeatOffset);
             }
-            else
+        }
+        m_commandChannelAddressOffset.reset();
+        if (numberOfParameters == REGISTER_ACK_PARAMETERS_WITH_COMMAND_CHANNEL)
+        {
+            memory::UntypedRelativePointer::offset_t commandChannelOffset{0U};
+            if (cxx::convert::fromString(message.getElementAtIndex(8U).c_str(), commandChannelOffset))
             {
-                LogError() << "Wrong response received " << receiveBuffer.getMessage();
+                m_commandChannelAddressOffset.emplace(commandChannelOffset);
             }
         }
+        if (transmissionTimestamp == receivedTimestamp)
+        {
+            return true;
+        }
+        LogWarn() << "Received a REG_ACK with an outdated timestamp!";
     }
-
-    return RegAckResult::TIMEOUT;
+    else
+    {
+        LogError() << "Wrong response received " << message.getMessage();
+    }
+    return false;
 }
 
 uint64_t IpcRuntimeInterface::getSegmentId() const noexcept
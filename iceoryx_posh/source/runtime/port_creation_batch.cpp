@@ -0,0 +1,129 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_creation_batch.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortCreationBatchBase::PortCreationBatchBase(const uint64_t capacity) noexcept
+    : m_capacity(capacity)
+{
+}
+
+void PortCreationBatchBase::setEntries(Entry* const entries) noexcept
+{
+    m_entries = entries;
+}
+
+bool PortCreationBatchBase::addPublisher(const capro::ServiceDescription& service,
+                                         const popo::PublisherOptions& publisherOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_PUBLISHER;
+    request.service = service;
+    request.publisherOptions = publisherOptions;
+    request.portConfigInfo = portConfigInfo;
+    return add(request);
+}
+
+bool PortCreationBatchBase::addSubscriber(const capro::ServiceDescription& service,
+                                          const popo::SubscriberOptions& subscriberOptions,
+                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_SUBSCRIBER;
+    request.service = service;
+    request.subscriberOptions = subscriberOptions;
+    request.portConfigInfo = portConfigInfo;
+    return add(request);
+}
+
+bool PortCreationBatchBase::addClient(const capro::ServiceDescription& service,
+                                      const popo::ClientOptions& clientOptions,
+                                      const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_CLIENT;
+    request.service = service;
+    request.clientOptions = clientOptions;
+    request.portConfigInfo = portConfigInfo;
+    return add(request);
+}
+
+bool PortCreationBatchBase::addServer(const capro::ServiceDescription& service,
+                                      const popo::ServerOptions& serverOptions,
+                                      const PortConfigInfo& portConfigInfo) noexcept
+{
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_SERVER;
+    request.service = service;
+    request.serverOptions = serverOptions;
+    request.portConfigInfo = portConfigInfo;
+    return add(request);
+}
+
+bool PortCreationBatchBase::add(const IpcPortRequest& request) noexcept
+{
+    if (m_size >= m_capacity || m_runtime != nullptr)
+    {
+        return false;
+    }
+
+    m_entries[m_size].request = request;
+    m_entries[m_size].port = nullptr;
+    m_entries[m_size].isTaken = false;
+    ++m_size;
+    return true;
+}
+
+uint64_t PortCreationBatchBase::size() const noexcept
+{
+    return m_size;
+}
+
+uint64_t PortCreationBatchBase::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+uint64_t PortCreationBatchBase::numberOfReservedPorts() const noexcept
+{
+    uint64_t numberOfReservedPorts{0U};
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        if (m_entries[i].port != nullptr && !m_entries[i].isTaken)
+        {
+            ++numberOfReservedPorts;
+        }
+    }
+    return numberOfReservedPorts;
+}
+
+void PortCreationBatchBase::release() noexcept
+{
+    if (m_runtime != nullptr)
+    {
+        m_runtime->releasePorts(*this);
+        m_runtime = nullptr;
+    }
+}
+
+} // namespace runtime
+} // namespace iox
@@ -32,9 +32,14 @@ namespace iox
 {
 namespace runtime
 {
-PoshRuntimeImpl::PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name, const RuntimeLocation location) noexcept
+PoshRuntimeImpl::PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name,
+                                 const RuntimeLocation location,
+                                 InProcessRequestHandler* const inProcessRequestHandler) noexcept
     : PoshRuntime(name)
-    , m_ipcChannelInterface(roudi::IPC_CHANNEL_ROUDI_NAME, *name.value(), runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
+    , m_ipcChannelInterface(roudi::IPC_CHANNEL_ROUDI_NAME,
+                            *name.value(),
+                            runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT,
+                            inProcessRequestHandler)
     , m_ShmInterface([&] {
         // in case the runtime is located in the same process like RouDi the shm is already opened;
         // also in case of the RouDiEnvironment this would close the shm on destruction of the runstime which is also
@@ -45,11 +50,35 @@ PoshRuntimeImpl::PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name, const
                                                       m_ipcChannelInterface.getSegmentId(),
                                                       m_ipcChannelInterface.getSegmentManagerAddressOffset()});
     }())
+    , m_heartbeat([&]() -> Heartbeat* {
+        auto heartbeatOffset = m_ipcChannelInterface.getHeartbeatAddressOffset();
+        if (!heartbeatOffset.has_value())
+        {
+            return nullptr;
+        }
+        return static_cast<Heartbeat*>(memory::UntypedRelativePointer::getPtr(
+            memory::segment_id_t{m_ipcChannelInterface.getSegmentId()}, heartbeatOffset.value()));
+    }())
 {
+    // the command channel is in the management segment which is mapped now
+    m_ipcChannelInterface.getCommandChannelAddressOffset().and_then([this](auto commandChannelOffset) {
+        m_ipcChannelInterface.attachCommandChannel(static_cast<CommandChannel*>(memory::UntypedRelativePointer::getPtr(
+            memory::segment_id_t{m_ipcChannelInterface.getSegmentId()}, commandChannelOffset)));
+    });
 }
 
 PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
 {
+    // batches which outlive the runtime must not release their ports with it
+    for (auto batch : m_portCreationBatches)
+    {
+        batch->m_runtime = nullptr;
+    }
+
+    // RouDi releases the command channel when it removes the runtime, therefore the response to the TERMINATION
+    // request is received via the IPC channel
+    m_ipcChannelInterface.attachCommandChannel(nullptr);
+
     // Inform RouDi that we're shutting down
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::TERMINATION) << m_appName;
@@ -76,10 +105,9 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
-PublisherPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
-                                        const popo::PublisherOptions& publisherOptions,
-                                        const PortConfigInfo& portConfigInfo) noexcept
+IpcPortRequest PoshRuntimeImpl::createPublisherRequest(const capro::ServiceDescription& service,
+                                                      const popo::PublisherOptions& publisherOptions,
+                                                      const PortConfigInfo& portConfigInfo) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
@@ -98,12 +126,22 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_PUBLISHER;
+    request.service = service;
+    request.publisherOptions = options;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
 
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
+PublisherPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
+                                        const popo::PublisherOptions& publisherOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybePublisher = requestPortFromRoudi(createPublisherRequest(service, publisherOptions, portConfigInfo),
+                                               IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE,
+                                               IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
     if (maybePublisher.has_error())
     {
         switch (maybePublisher.get_error())
@@ -143,53 +181,12 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         }
         return nullptr;
     }
-    return maybePublisher.value();
+    return static_cast<PublisherPortUserType::MemberType_t*>(maybePublisher.value());
 }
 
-cxx::expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept
-{
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        LogError() << "Request publisher got invalid response!";
-        return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_PUBLISHER_ACK)
-
-        {
-            memory::segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            memory::UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
-            return cxx::success<PublisherPortUserType::MemberType_t*>(
-                reinterpret_cast<PublisherPortUserType::MemberType_t*>(ptr));
-        }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
-        {
-            LogError() << "Request publisher received no valid publisher port from RouDi.";
-            return cxx::error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
-        }
-    }
-
-    LogError() << "Request publisher got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
-}
-
-SubscriberPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
-                                         const popo::SubscriberOptions& subscriberOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+IpcPortRequest PoshRuntimeImpl::createSubscriberRequest(const capro::ServiceDescription& service,
+                                                       const popo::SubscriberOptions& subscriberOptions,
+                                                       const PortConfigInfo& portConfigInfo) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
 
@@ -220,12 +217,22 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_SUBSCRIBER;
+    request.service = service;
+    request.subscriberOptions = options;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
 
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+SubscriberPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeSubscriber = requestPortFromRoudi(createSubscriberRequest(service, subscriberOptions, portConfigInfo),
+                                                IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE,
+                                                IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
 
     if (maybeSubscriber.has_error())
     {
@@ -252,52 +259,12 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         }
         return nullptr;
     }
-    return maybeSubscriber.value();
-}
-
-cxx::expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept
-{
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        LogError() << "Request subscriber got invalid response!";
-        return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_SUBSCRIBER_ACK)
-        {
-            memory::segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            memory::UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
-            return cxx::success<SubscriberPortUserType::MemberType_t*>(
-                reinterpret_cast<SubscriberPortUserType::MemberType_t*>(ptr));
-        }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
-        {
-            LogError() << "Request subscriber received no valid subscriber port from RouDi.";
-            return cxx::error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
-        }
-    }
-
-    LogError() << "Request subscriber got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
+    return static_cast<SubscriberPortUserType::MemberType_t*>(maybeSubscriber.value());
 }
 
-popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
-                                                                         const popo::ClientOptions& clientOptions,
-                                                                         const PortConfigInfo& portConfigInfo) noexcept
+IpcPortRequest PoshRuntimeImpl::createClientRequest(const capro::ServiceDescription& service,
+                                                   const popo::ClientOptions& clientOptions,
+                                                   const PortConfigInfo& portConfigInfo) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
     auto options = clientOptions;
@@ -315,12 +282,21 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
         options.responseQueueCapacity = 1U;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_CLIENT;
+    request.service = service;
+    request.clientOptions = options;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
 
-    auto maybeClient = requestClientFromRoudi(sendBuffer);
+popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
+                                                                         const popo::ClientOptions& clientOptions,
+                                                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeClient = requestPortFromRoudi(createClientRequest(service, clientOptions, portConfigInfo),
+                                            IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE,
+                                            IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
     if (maybeClient.has_error())
     {
         switch (maybeClient.get_error())
@@ -354,52 +330,12 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
         }
         return nullptr;
     }
-    return maybeClient.value();
-}
-
-cxx::expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
-{
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        LogError() << "Request client got invalid response!";
-        return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_CLIENT_ACK)
-        {
-            memory::segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            memory::UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
-            return cxx::success<popo::ClientPortUser::MemberType_t*>(
-                reinterpret_cast<popo::ClientPortUser::MemberType_t*>(ptr));
-        }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
-        {
-            LogError() << "Request client received no valid client port from RouDi.";
-            return cxx::error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
-        }
-    }
-
-
-    LogError() << "Request client got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
+    return static_cast<popo::ClientPortUser::MemberType_t*>(maybeClient.value());
 }
 
-popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const capro::ServiceDescription& service,
-                                                                         const popo::ServerOptions& serverOptions,
-                                                                         const PortConfigInfo& portConfigInfo) noexcept
+IpcPortRequest PoshRuntimeImpl::createServerRequest(const capro::ServiceDescription& service,
+                                                   const popo::ServerOptions& serverOptions,
+                                                   const PortConfigInfo& portConfigInfo) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
     auto options = serverOptions;
@@ -417,12 +353,21 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
         options.requestQueueCapacity = 1U;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_SERVER;
+    request.service = service;
+    request.serverOptions = options;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
 
-    auto maybeServer = requestServerFromRoudi(sendBuffer);
+popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const capro::ServiceDescription& service,
+                                                                         const popo::ServerOptions& serverOptions,
+                                                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeServer = requestPortFromRoudi(createServerRequest(service, serverOptions, portConfigInfo),
+                                            IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE,
+                                            IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
     if (maybeServer.has_error())
     {
         switch (maybeServer.get_error())
@@ -456,189 +401,487 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
         }
         return nullptr;
     }
-    return maybeServer.value();
+    return static_cast<popo::ServerPortUser::MemberType_t*>(maybeServer.value());
 }
 
-cxx::expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
+popo::InterfacePortData* PoshRuntimeImpl::getMiddlewareInterface(const capro::Interfaces interface,
+                                                                 const NodeName_t& nodeName) noexcept
 {
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_INTERFACE;
+    request.interface = interface;
+    request.nodeName = nodeName;
+
+    auto maybeInterface = requestPortFromRoudi(request,
+                                               IpcMessageErrorType::REQUEST_INTERFACE_INVALID_RESPONSE,
+                                               IpcMessageErrorType::REQUEST_INTERFACE_WRONG_IPC_MESSAGE_RESPONSE);
+    if (maybeInterface.has_error())
     {
-        LogError() << "Request server got invalid response!";
-        return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE);
+        if (maybeInterface.get_error() == IpcMessageErrorType::REQUEST_INTERFACE_INVALID_RESPONSE)
+        {
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_GET_MW_INTERFACE_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        }
+        else
+        {
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_GET_MW_INTERFACE_WRONG_IPC_MESSAGE_RESPONSE,
+                         iox::ErrorLevel::SEVERE);
+        }
+        return nullptr;
     }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+    return static_cast<popo::InterfacePortData*>(maybeInterface.value());
+}
 
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_SERVER_ACK)
+NodeData* PoshRuntimeImpl::createNode(const NodeProperty& nodeProperty) noexcept
+{
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_NODE;
+    request.nodeName = nodeProperty.m_name;
+    request.nodeDeviceIdentifier = nodeProperty.m_nodeDeviceIdentifier;
+
+    auto maybeNode = requestPortFromRoudi(request,
+                                          IpcMessageErrorType::REQUEST_NODE_INVALID_RESPONSE,
+                                          IpcMessageErrorType::REQUEST_NODE_WRONG_IPC_MESSAGE_RESPONSE);
+    if (maybeNode.has_error())
+    {
+        if (maybeNode.get_error() == IpcMessageErrorType::REQUEST_NODE_INVALID_RESPONSE)
+        {
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_CREATE_NODE_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        }
+        else
         {
-            memory::segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            memory::UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
-            return cxx::success<popo::ServerPortUser::MemberType_t*>(
-                reinterpret_cast<popo::ServerPortUser::MemberType_t*>(ptr));
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_CREATE_NODE_WRONG_IPC_MESSAGE_RESPONSE,
+                         iox::ErrorLevel::SEVERE);
         }
+        return nullptr;
     }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
+    return static_cast<NodeData*>(maybeNode.value());
+}
+
+popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() noexcept
+{
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_CONDITION_VARIABLE;
+
+    auto maybeConditionVariable =
+        requestPortFromRoudi(request,
+                             IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
+                             IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE);
+    if (maybeConditionVariable.has_error())
     {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
+        switch (maybeConditionVariable.get_error())
         {
-            LogError() << "Request server received no valid server port from RouDi.";
-            return cxx::error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
+        case IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL:
+            LogWarn() << "Could not create condition variable as we are out of memory for condition variables.";
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_LIST_FULL, iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE:
+            LogWarn() << "Could not create condition variables; received invalid IPC channel response.";
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
+                         iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE:
+            LogWarn() << "Could not create condition variables; received wrong IPC channel response.";
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE,
+                         iox::ErrorLevel::SEVERE);
+            break;
+        default:
+            LogWarn() << "Unknown error occurred while creating condition variable";
+            errorHandler(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_CREATION_UNKNOWN_ERROR,
+                         iox::ErrorLevel::SEVERE);
+            break;
         }
+        return nullptr;
     }
-
-    LogError() << "Request server got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
+    return static_cast<popo::ConditionVariableData*>(maybeConditionVariable.value());
 }
 
-popo::InterfacePortData* PoshRuntimeImpl::getMiddlewareInterface(const capro::Interfaces interface,
-                                                                 const NodeName_t& nodeName) noexcept
+uint64_t PoshRuntimeImpl::createPorts(PortCreationBatchBase& batch) noexcept
 {
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_INTERFACE) << m_appName
-               << static_cast<uint32_t>(interface) << nodeName;
-
-    IpcMessage receiveBuffer;
+    if (batch.m_runtime != nullptr)
+    {
+        LogWarn() << "The ports of the batch were already created";
+        return 0U;
+    }
 
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
     {
-        LogError() << "Request interface got invalid response!";
-        errorHandler(PoshError::POSH__RUNTIME_ROUDI_GET_MW_INTERFACE_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-        return nullptr;
+        std::lock_guard<posix::mutex> g(m_portCreationBatchMutex);
+        if (m_portCreationBatches.size() >= MAX_PORT_CREATION_BATCHES)
+        {
+            LogError() << "Could not create the ports of the batch since already " << MAX_PORT_CREATION_BATCHES
+                       << " batches reserve ports";
+            return 0U;
+        }
     }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
+
+    // the requests are stored with the same limits like the requests of the single ports so that they can be matched
+    for (uint64_t i = 0U; i < batch.m_size; ++i)
     {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+        auto& request = batch.m_entries[i].request;
+        switch (request.type)
+        {
+        case IpcMessageType::CREATE_PUBLISHER:
+            request = createPublisherRequest(request.service, request.publisherOptions, request.portConfigInfo);
+            break;
+        case IpcMessageType::CREATE_SUBSCRIBER:
+            request = createSubscriberRequest(request.service, request.subscriberOptions, request.portConfigInfo);
+            break;
+        case IpcMessageType::CREATE_CLIENT:
+            request = createClientRequest(request.service, request.clientOptions, request.portConfigInfo);
+            break;
+        case IpcMessageType::CREATE_SERVER:
+            request = createServerRequest(request.service, request.serverOptions, request.portConfigInfo);
+            break;
+        default:
+            break;
+        }
+    }
 
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_INTERFACE_ACK)
+    uint64_t numberOfCreatedPorts{0U};
+    if (m_ipcChannelInterface.getBinaryProtocolVersion() > 0U)
+    {
+        numberOfCreatedPorts = sendPortRequestsToRoudi(batch);
+    }
+    else
+    {
+        // RouDi only understands the string based protocol or runs in the same process and creates the ports without
+        // serialization, the ports are requested one after another
+        for (uint64_t i = 0U; i < batch.m_size; ++i)
         {
-            memory::segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            memory::UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
-            return reinterpret_cast<popo::InterfacePortData*>(ptr);
+            auto& entry = batch.m_entries[i];
+            if (!hasValidIpcMessageEntries(entry.request))
+            {
+                LogError() << "Request " << IpcMessageTypeToString(entry.request.type) << " contains an invalid name!";
+                continue;
+            }
+
+            auto maybePort =
+                sendPortRequestToRoudi(entry.request, IpcMessageErrorType::NOTYPE, IpcMessageErrorType::NOTYPE);
+            if (!maybePort.has_error())
+            {
+                entry.port = maybePort.value();
+                ++numberOfCreatedPorts;
+            }
         }
     }
 
-    LogError() << "Get mw interface got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    errorHandler(PoshError::POSH__RUNTIME_ROUDI_GET_MW_INTERFACE_WRONG_IPC_MESSAGE_RESPONSE, iox::ErrorLevel::SEVERE);
-    return nullptr;
+    std::lock_guard<posix::mutex> g(m_portCreationBatchMutex);
+    batch.m_runtime = this;
+    m_portCreationBatches.emplace_back(&batch);
+    return numberOfCreatedPorts;
 }
 
-NodeData* PoshRuntimeImpl::createNode(const NodeProperty& nodeProperty) noexcept
+uint64_t PoshRuntimeImpl::sendPortRequestsToRoudi(PortCreationBatchBase& batch) noexcept
 {
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_NODE) << m_appName
-               << static_cast<cxx::Serialization>(nodeProperty).toString();
+    IpcBinaryFrame header;
+    header << IPC_BINARY_PROTOCOL_VERSION << m_appName << static_cast<uint16_t>(0U);
 
-    IpcMessage receiveBuffer;
+    uint64_t numberOfCreatedPorts{0U};
+    uint64_t nextIndex{0U};
+    while (nextIndex < batch.m_size)
+    {
+        // collect the requests which fit into one frame
+        cxx::vector<uint64_t, MAX_PORT_REQUESTS_PER_FRAME> indices;
+        uint64_t frameSize{header.size()};
+        while (nextIndex < batch.m_size && indices.size() < indices.capacity())
+        {
+            const auto& request = batch.m_entries[nextIndex].request;
+            if (!hasValidIpcMessageEntries(request))
+            {
+                LogError() << "Request " << IpcMessageTypeToString(request.type) << " contains an invalid name!";
+                ++nextIndex;
+                continue;
+            }
 
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+            IpcBinaryFrame requestFrame;
+            requestFrame << request;
+            if (!requestFrame.isValid() || header.size() + requestFrame.size() > IpcBinaryFrame::CAPACITY)
+            {
+                LogError() << "Request " << IpcMessageTypeToString(request.type) << " exceeds the message size!";
+                ++nextIndex;
+                continue;
+            }
+
+            if (frameSize + requestFrame.size() > IpcBinaryFrame::CAPACITY)
+            {
+                break;
+            }
+            frameSize += requestFrame.size();
+            indices.emplace_back(nextIndex);
+            ++nextIndex;
+        }
+
+        if (indices.empty())
+        {
+            continue;
+        }
+
+        IpcBinaryFrame requestFrame;
+        requestFrame << IPC_BINARY_PROTOCOL_VERSION << m_appName << static_cast<uint16_t>(indices.size());
+        for (const auto index : indices)
+        {
+            requestFrame << batch.m_entries[index].request;
+        }
+
+        IpcBinaryFrame responseFrame;
+        bool isSent{false};
+        {
+            // runtime must be thread safe
+            std::lock_guard<posix::mutex> g(m_appIpcRequestMutex);
+            isSent = m_ipcChannelInterface.sendRequestToRouDi(requestFrame, responseFrame);
+        }
+        if (!isSent)
+        {
+            LogError() << "Request of " << indices.size() << " ports got invalid response!";
+            continue;
+        }
+
+        uint16_t version{0U};
+        uint16_t numberOfResponses{0U};
+        responseFrame >> version >> numberOfResponses;
+        if (!responseFrame.isValid() || numberOfResponses != indices.size())
+        {
+            LogError() << "Request of " << indices.size() << " ports got wrong binary response from IPC channel";
+            continue;
+        }
+
+        for (const auto index : indices)
+        {
+            IpcPortResponse response;
+            if (!(responseFrame >> response).isValid())
+            {
+                LogError() << "Request of " << indices.size() << " ports got wrong binary response from IPC channel";
+                break;
+            }
+
+            auto& entry = batch.m_entries[index];
+            auto maybePort = getPortFromResponse(entry.request, response, IpcMessageErrorType::NOTYPE);
+            if (!maybePort.has_error())
+            {
+                entry.port = maybePort.value();
+                ++numberOfCreatedPorts;
+            }
+        }
+    }
+
+    return numberOfCreatedPorts;
+}
+
+void PoshRuntimeImpl::releasePorts(PortCreationBatchBase& batch) noexcept
+{
+    std::lock_guard<posix::mutex> g(m_portCreationBatchMutex);
+    for (uint64_t i = 0U; i < batch.m_size; ++i)
     {
-        LogError() << "Request node got invalid response!";
-        errorHandler(PoshError::POSH__RUNTIME_ROUDI_CREATE_NODE_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-        return nullptr;
+        auto& entry = batch.m_entries[i];
+        if (entry.port == nullptr || entry.isTaken)
+        {
+            continue;
+        }
+
+        // RouDi removes the port in the next discovery loop
+        popo::BasePortData* portData{nullptr};
+        switch (entry.request.type)
+        {
+        case IpcMessageType::CREATE_PUBLISHER:
+            portData = static_cast<PublisherPortUserType::MemberType_t*>(entry.port);
+            break;
+        case IpcMessageType::CREATE_SUBSCRIBER:
+            portData = static_cast<SubscriberPortUserType::MemberType_t*>(entry.port);
+            break;
+        case IpcMessageType::CREATE_CLIENT:
+            portData = static_cast<popo::ClientPortUser::MemberType_t*>(entry.port);
+            break;
+        case IpcMessageType::CREATE_SERVER:
+            portData = static_cast<popo::ServerPortUser::MemberType_t*>(entry.port);
+            break;
+        default:
+            break;
+        }
+        if (portData != nullptr)
+        {
+            popo::BasePort(portData).destroy();
+        }
+        entry.port = nullptr;
     }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
+
+    for (auto iter = m_portCreationBatches.begin(); iter != m_portCreationBatches.end(); ++iter)
     {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+        if (*iter == &batch)
+        {
+            m_portCreationBatches.erase(iter);
+            break;
+        }
+    }
+}
 
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_NODE_ACK)
+cxx::optional<void*> PoshRuntimeImpl::takeReservedPort(const IpcPortRequest& request) noexcept
+{
+    std::lock_guard<posix::mutex> g(m_portCreationBatchMutex);
+    for (auto batch : m_portCreationBatches)
+    {
+        for (uint64_t i = 0U; i < batch->m_size; ++i)
         {
-            memory::segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            memory::UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
-            return reinterpret_cast<NodeData*>(ptr);
+            auto& entry = batch->m_entries[i];
+            if (entry.port != nullptr && !entry.isTaken && isSamePortRequest(entry.request, request))
+            {
+                entry.isTaken = true;
+                return entry.port;
+            }
         }
     }
+    return cxx::nullopt;
+}
+
+cxx::expected<void*, IpcMessageErrorType>
+PoshRuntimeImpl::requestPortFromRoudi(const IpcPortRequest& request,
+                                      const IpcMessageErrorType invalidResponseError,
+                                      const IpcMessageErrorType wrongResponseError) noexcept
+{
+    if (!hasValidIpcMessageEntries(request))
+    {
+        LogError() << "Request " << IpcMessageTypeToString(request.type) << " contains an invalid name!";
+        return cxx::error<IpcMessageErrorType>(invalidResponseError);
+    }
+
+    auto reservedPort = takeReservedPort(request);
+    if (reservedPort.has_value())
+    {
+        return cxx::success<void*>(reservedPort.value());
+    }
 
-    LogError() << "Got wrong response from RouDi while creating node:'" << receiveBuffer.getMessage() << "'";
-    errorHandler(PoshError::POSH__RUNTIME_ROUDI_CREATE_NODE_WRONG_IPC_MESSAGE_RESPONSE, iox::ErrorLevel::SEVERE);
-    return nullptr;
+    return sendPortRequestToRoudi(request, invalidResponseError, wrongResponseError);
 }
 
-cxx::expected<popo::ConditionVariableData*, IpcMessageErrorType>
-PoshRuntimeImpl::requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept
+cxx::expected<void*, IpcMessageErrorType>
+PoshRuntimeImpl::sendPortRequestToRoudi(const IpcPortRequest& request,
+                                        const IpcMessageErrorType invalidResponseError,
+                                        const IpcMessageErrorType wrongResponseError) noexcept
 {
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    const auto requestName = IpcMessageTypeToString(request.type);
+    IpcPortResponse response;
+    if (m_ipcChannelInterface.isInProcess())
     {
-        LogError() << "Request condition variable got invalid response!";
-        return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE);
+        // RouDi creates the port in this thread, unlike the requests via the IPC channel the requests of several
+        // threads are processed concurrently
+        IOX_DISCARD_RESULT(m_ipcChannelInterface.sendRequestToRouDi(request, response));
     }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
+    else if (m_ipcChannelInterface.getBinaryProtocolVersion() > 0U)
     {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+        IpcBinaryFrame requestFrame;
+        requestFrame << IPC_BINARY_PROTOCOL_VERSION << m_appName << static_cast<uint16_t>(1U) << request;
+        IpcBinaryFrame responseFrame;
+        bool isSent{false};
+        {
+            // runtime must be thread safe
+            std::lock_guard<posix::mutex> g(m_appIpcRequestMutex);
+            isSent = m_ipcChannelInterface.sendRequestToRouDi(requestFrame, responseFrame);
+        }
+        if (!isSent)
+        {
+            LogError() << "Request " << requestName << " got invalid response!";
+            return cxx::error<IpcMessageErrorType>(invalidResponseError);
+        }
 
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
+        uint16_t version{0U};
+        uint16_t numberOfResponses{0U};
+        responseFrame >> version >> numberOfResponses >> response;
+        if (!responseFrame.isValid() || numberOfResponses != 1U)
         {
-            memory::segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            memory::UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
-            return cxx::success<popo::ConditionVariableData*>(reinterpret_cast<popo::ConditionVariableData*>(ptr));
+            LogError() << "Request " << requestName << " got wrong binary response from IPC channel";
+            return cxx::error<IpcMessageErrorType>(wrongResponseError);
         }
     }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
+    else
     {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
+        IpcMessage receiveBuffer;
+        if (sendRequestToRouDi(createPortRequestMessage(request), receiveBuffer) == false)
+        {
+            LogError() << "Request " << requestName << " got invalid response!";
+            return cxx::error<IpcMessageErrorType>(invalidResponseError);
+        }
+
+        response.type = stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str());
+        if (receiveBuffer.getNumberOfElements() == 3U && response.type != IpcMessageType::ERROR)
+        {
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), response.offset);
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), response.segmentId);
+        }
+        else if (receiveBuffer.getNumberOfElements() == 2U && response.type == IpcMessageType::ERROR)
+        {
+            response.error = stringToIpcMessageErrorType(receiveBuffer.getElementAtIndex(1U).c_str());
+        }
+        else
         {
-            LogError() << "Request condition variable received no valid condition variable port from RouDi.";
-            return cxx::error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
+            LogError() << "Request " << requestName << " got wrong response from IPC channel :'"
+                       << receiveBuffer.getMessage() << "'";
+            return cxx::error<IpcMessageErrorType>(wrongResponseError);
         }
     }
 
-    LogError() << "Request condition variable got wrong response from IPC channel :'" << receiveBuffer.getMessage()
-               << "'";
-    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE);
+    return getPortFromResponse(request, response, wrongResponseError);
 }
 
-popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() noexcept
+cxx::expected<void*, IpcMessageErrorType>
+PoshRuntimeImpl::getPortFromResponse(const IpcPortRequest& request,
+                                     const IpcPortResponse& response,
+                                     const IpcMessageErrorType wrongResponseError) const noexcept
 {
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << m_appName;
+    const auto requestName = IpcMessageTypeToString(request.type);
+    if (response.type == getAckForPortRequest(request.type))
+    {
+        return cxx::success<void*>(
+            memory::UntypedRelativePointer::getPtr(memory::segment_id_t{response.segmentId}, response.offset));
+    }
 
-    auto maybeConditionVariable = requestConditionVariableFromRoudi(sendBuffer);
-    if (maybeConditionVariable.has_error())
+    if (response.type == IpcMessageType::ERROR)
     {
-        switch (maybeConditionVariable.get_error())
-        {
-        case IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL:
-            LogWarn() << "Could not create condition variable as we are out of memory for condition variables.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_LIST_FULL, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE:
-            LogWarn() << "Could not create condition variables; received invalid IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE:
-            LogWarn() << "Could not create condition variables; received wrong IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            LogWarn() << "Unknown error occurred while creating condition variable";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_CREATION_UNKNOWN_ERROR,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        }
-        return nullptr;
+        LogError() << "Request " << requestName << " received no valid resource from RouDi.";
+        return cxx::error<IpcMessageErrorType>(response.error);
     }
-    return maybeConditionVariable.value();
+
+    LogError() << "Request " << requestName << " got wrong response type '" << IpcMessageTypeToString(response.type)
+               << "' from IPC channel";
+    return cxx::error<IpcMessageErrorType>(wrongResponseError);
+}
+
+IpcMessage PoshRuntimeImpl::createPortRequestMessage(const IpcPortRequest& request) const noexcept
+{
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(request.type) << m_appName;
+    switch (request.type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        sendBuffer << static_cast<cxx::Serialization>(request.service).toString()
+                   << request.publisherOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(request.portConfigInfo).toString();
+        break;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        sendBuffer << static_cast<cxx::Serialization>(request.service).toString()
+                   << request.subscriberOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(request.portConfigInfo).toString();
+        break;
+    case IpcMessageType::CREATE_CLIENT:
+        sendBuffer << static_cast<cxx::Serialization>(request.service).toString()
+                   << request.clientOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(request.portConfigInfo).toString();
+        break;
+    case IpcMessageType::CREATE_SERVER:
+        sendBuffer << static_cast<cxx::Serialization>(request.service).toString()
+                   << request.serverOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(request.portConfigInfo).toString();
+        break;
+    case IpcMessageType::CREATE_INTERFACE:
+        sendBuffer << static_cast<uint32_t>(request.interface) << request.nodeName;
+        break;
+    case IpcMessageType::CREATE_NODE:
+    {
+        const NodeProperty nodeProperty(request.nodeName, request.nodeDeviceIdentifier);
+        sendBuffer << static_cast<cxx::Serialization>(nodeProperty).toString();
+        break;
+    }
+    default:
+        break;
+    }
+    return sendBuffer;
 }
 
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
@@ -651,7 +894,11 @@ bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answ
 // this is the callback for the m_keepAliveTimer
 void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 {
-    if (!m_ipcChannelInterface.sendKeepalive())
+    if (m_heartbeat != nullptr)
+    {
+        m_heartbeat->beat();
+    }
+    else if (!m_ipcChannelInterface.sendKeepalive())
     {
         LogWarn() << "Error in sending keep alive";
     }
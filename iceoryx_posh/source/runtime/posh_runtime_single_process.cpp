@@ -33,6 +33,18 @@ PoshRuntime& singleProcessRuntimeFactory(cxx::optional<const RuntimeName_t*>) no
 
 PoshRuntimeSingleProcess::PoshRuntimeSingleProcess(const RuntimeName_t& name) noexcept
     : PoshRuntimeImpl(cxx::make_optional<const RuntimeName_t*>(&name), RuntimeLocation::SAME_PROCESS_LIKE_ROUDI)
+{
+    setAsRuntimeOfProcess();
+}
+
+PoshRuntimeSingleProcess::PoshRuntimeSingleProcess(const RuntimeName_t& name, InProcessRequestHandler& roudi) noexcept
+    : PoshRuntimeImpl(
+        cxx::make_optional<const RuntimeName_t*>(&name), RuntimeLocation::SAME_PROCESS_LIKE_ROUDI, &roudi)
+{
+    setAsRuntimeOfProcess();
+}
+
+void PoshRuntimeSingleProcess::setAsRuntimeOfProcess() noexcept
 {
     auto currentFactory = PoshRuntime::getRuntimeFactory();
     if (currentFactory != nullptr && *currentFactory == PoshRuntime::defaultRuntimeFactory)
@@ -29,11 +29,57 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
-    m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+
+    // the complete registry is always taken to consume the sample but only copied when a change was missed
+    auto serviceRegistrySample = m_serviceRegistrySubscriber.take();
+    serviceRegistrySample.and_then([&](popo::Sample<const roudi::ServiceRegistry>& sample) {
+        this->adoptServiceRegistryIfRequired(*sample);
+    });
+
+    bool hasChange{true};
+    while (hasChange)
+    {
+        hasChange = !m_serviceRegistryChangeSubscriber.take()
+                         .and_then([&](popo::Sample<const roudi::ServiceRegistryChange>& sample) {
+                             this->applyChange(*sample);
+                         })
+                         .has_error();
+    }
+
+    // the changes may have revealed a gap which the complete registry already closes
+    serviceRegistrySample.and_then([&](popo::Sample<const roudi::ServiceRegistry>& sample) {
+        this->adoptServiceRegistryIfRequired(*sample);
     });
 }
 
+void ServiceDiscovery::applyChange(const roudi::ServiceRegistryChange& change) noexcept
+{
+    // the change is already contained in the local registry
+    if (change.generation <= m_serviceRegistry->generation())
+    {
+        return;
+    }
+
+    if (m_isInSync && change.generation == m_serviceRegistry->generation() + 1U)
+    {
+        m_serviceRegistry->apply(change);
+        return;
+    }
+
+    // a change is missing, only a complete registry which contains this change makes the local registry consistent
+    m_isInSync = false;
+    m_requiredGeneration = change.generation;
+}
+
+void ServiceDiscovery::adoptServiceRegistryIfRequired(const roudi::ServiceRegistry& serviceRegistry) noexcept
+{
+    if (!m_isInSync && serviceRegistry.generation() >= m_requiredGeneration)
+    {
+        *m_serviceRegistry = serviceRegistry;
+        m_isInSync = true;
+    }
+}
+
 void ServiceDiscovery::findService(const cxx::optional<capro::IdString_t>& service,
                                    const cxx::optional<capro::IdString_t>& instance,
                                    const cxx::optional<capro::IdString_t>& event,
@@ -80,7 +80,8 @@ class CMqInterfaceStartupRace_test : public Test
 
     void checkRegRequest(const IpcMessage& msg) const
     {
-        ASSERT_THAT(msg.getNumberOfElements(), Eq(6u));
+        // the last element is the binary protocol version of the runtime
+        ASSERT_THAT(msg.getNumberOfElements(), Eq(7u));
 
         std::string cmd = msg.getElementAtIndex(0);
         ASSERT_THAT(cmd.c_str(), StrEq(IpcMessageTypeToString(IpcMessageType::REG)));
@@ -429,6 +429,27 @@ TEST_F(ServiceDescription_test, LessThanOperatorReturnsFalseIfEventStringOfFirst
     EXPECT_FALSE(serviceDescription1 < serviceDescription2);
 }
 
+TEST_F(ServiceDescription_test, HashOfEqualServiceDescriptionsIsEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a6ae4ce-e8f7-4a42-81a4-b666cad8be1e");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent", {1U, 2U, 3U, 4U});
+    ServiceDescription serviceDescription2("TestService", "TestInstance", "TestEvent");
+
+    EXPECT_THAT(serviceDescription1.hash(), Eq(serviceDescription2.hash()));
+}
+
+TEST_F(ServiceDescription_test, HashOfServiceDescriptionsWithShiftedStringsDiffers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "853ea641-27d4-4ed4-b959-c8cf3ef37548");
+    ServiceDescription serviceDescription1("ab", "c", "d");
+    ServiceDescription serviceDescription2("a", "bc", "d");
+    ServiceDescription serviceDescription3("a", "b", "cd");
+
+    EXPECT_THAT(serviceDescription1.hash(), Ne(serviceDescription2.hash()));
+    EXPECT_THAT(serviceDescription2.hash(), Ne(serviceDescription3.hash()));
+    EXPECT_THAT(serviceDescription1.hash(), Ne(serviceDescription3.hash()));
+}
+
 TEST_F(ServiceDescription_test, LogStreamConvertsServiceDescriptionToString)
 {
     ::testing::Test::RecordProperty("TEST_ID", "42bc3f21-d9f4-4cc3-a37e-6508e1f981c1");
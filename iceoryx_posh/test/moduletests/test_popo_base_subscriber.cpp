@@ -61,6 +61,7 @@ class StubbedBaseSubscriber : public iox::popo::BaseSubscriber<port_t>
     using SubscriberParent::enableState;
     using SubscriberParent::takeChunk;
 
+    using SubscriberParent::m_deadline;
     using SubscriberParent::port;
 };
 
@@ -298,6 +299,62 @@ TEST_F(BaseSubscriberTest, DetachingAttachedEventCleansup)
     // ===== Cleanup ===== //
 }
 
+TEST_F(BaseSubscriberTest, AttachedDeadlineMissedEventIsTriggeredWhenNoChunkIsReceivedWithinDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "37cf3605-9e61-4743-8fcd-141952a9dfed");
+    // ===== Setup ===== //
+    iox::popo::ConditionVariableData condVar("Horscht");
+    WaitSetTest waitSet(condVar);
+    std::atomic<uint64_t> numberOfReceivedChunks{0U};
+    sut.m_deadline = iox::units::Duration::fromMilliseconds(10U);
+    EXPECT_CALL(sut.port(), getNumberOfReceivedChunks).WillOnce(ReturnRef(numberOfReceivedChunks));
+    EXPECT_CALL(sut.port(), setConditionVariable(_, _)).Times(0);
+    ASSERT_FALSE(waitSet.attachEvent(sut, iox::popo::SubscriberEvent::DEADLINE_MISSED).has_error());
+    // ===== Test ===== //
+    auto notifications = waitSet.timedWait(iox::units::Duration::fromSeconds(1U));
+    // ===== Verify ===== //
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&sut));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BaseSubscriberTest, DeadlineMissedEventCanBeAttachedInAdditionToDataReceivedEvent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f255d083-3d8a-4a0c-a1c1-11ba06362b7b");
+    // ===== Setup ===== //
+    iox::popo::ConditionVariableData condVar("Horscht");
+    WaitSetTest waitSet(condVar);
+    std::atomic<uint64_t> numberOfReceivedChunks{0U};
+    sut.m_deadline = iox::units::Duration::fromMilliseconds(10U);
+    EXPECT_CALL(sut.port(), getNumberOfReceivedChunks).WillOnce(ReturnRef(numberOfReceivedChunks));
+    EXPECT_CALL(sut.port(), setConditionVariable(_, _)).Times(1);
+    // ===== Test ===== //
+    ASSERT_FALSE(waitSet.attachEvent(sut, iox::popo::SubscriberEvent::DATA_RECEIVED).has_error());
+    ASSERT_FALSE(waitSet.attachEvent(sut, iox::popo::SubscriberEvent::DEADLINE_MISSED).has_error());
+    // ===== Verify ===== //
+    EXPECT_EQ(waitSet.size(), 2U);
+    // ===== Cleanup ===== //
+    EXPECT_CALL(sut.port(), unsetConditionVariable()).Times(1);
+}
+
+TEST_F(BaseSubscriberTest, DetachingDeadlineMissedEventStopsTheDeadlineMonitoring)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d92d868-4064-4703-baf3-02574fc616db");
+    // ===== Setup ===== //
+    iox::popo::ConditionVariableData condVar("Horscht");
+    WaitSetTest waitSet(condVar);
+    std::atomic<uint64_t> numberOfReceivedChunks{0U};
+    sut.m_deadline = iox::units::Duration::fromMilliseconds(1U);
+    EXPECT_CALL(sut.port(), getNumberOfReceivedChunks).WillOnce(ReturnRef(numberOfReceivedChunks));
+    ASSERT_FALSE(waitSet.attachEvent(sut, iox::popo::SubscriberEvent::DEADLINE_MISSED).has_error());
+    // ===== Test ===== //
+    sut.disableEvent(iox::popo::SubscriberEvent::DEADLINE_MISSED);
+    // ===== Verify ===== //
+    EXPECT_EQ(waitSet.size(), 0U);
+    EXPECT_TRUE(waitSet.timedWait(iox::units::Duration::fromMilliseconds(20U)).empty());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BaseSubscriberTest, GetServiceDescriptionCallForwardedToUnderlyingSubscriberPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "93c5087c-2ba4-46fe-95d7-b619b49d3fe8");
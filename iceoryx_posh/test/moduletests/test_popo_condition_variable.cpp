@@ -135,9 +135,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_FALSE(sut.isNotificationActive(i));
     }
 }
 
@@ -150,9 +150,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_FALSE(m_condVarData.isNotificationActive(i));
     }
 }
 
@@ -166,11 +166,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_TRUE(m_condVarData.isNotificationActive(i));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_FALSE(m_condVarData.isNotificationActive(i));
         }
     }
 }
@@ -420,9 +420,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_FALSE(m_condVarData.isNotificationActive(i));
         }
     });
 
@@ -494,4 +494,262 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, PollingListenerReturnsNotificationWhichArrivedBeforeWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f1e2d3c-4b5a-4978-8a6b-5c4d3e2f1a0b");
+    constexpr Type_t EVENT_INDEX = 7U;
+    ConditionListener sut(m_condVarData, WaitOptions{1000U, 10U});
+
+    m_notifiers[EVENT_INDEX].notify();
+    const auto activeNotifications = sut.wait();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(EVENT_INDEX));
+}
+
+TEST_F(ConditionVariable_test, PollingListenerReturnsNotificationWhichArrivedDuringWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a9b8c7d-6e5f-4a3b-9c2d-1e0f9a8b7c6d");
+    constexpr Type_t EVENT_INDEX = 13U;
+    ConditionListener sut(m_condVarData, WaitOptions{1000U, 1000U});
+    Barrier isThreadStarted(1U);
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] {
+        isThreadStarted.notify();
+        activeNotifications = sut.wait();
+    });
+    isThreadStarted.wait();
+
+    m_notifiers[EVENT_INDEX].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(EVENT_INDEX));
+}
+
+TEST_F(ConditionVariable_test, PollingListenerBlocksAfterPollingPhaseUntilNotified)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d4e5f6a-7b8c-4d9e-8f0a-1b2c3d4e5f6a");
+    constexpr Type_t EVENT_INDEX = 1U;
+    ConditionListener sut(m_condVarData, WaitOptions{10U, 10U});
+    std::atomic_bool hasWaitReturned{false};
+
+    std::thread waiter([&] {
+        sut.wait();
+        hasWaitReturned.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(m_timingTestTime.toNanoseconds()));
+    EXPECT_FALSE(hasWaitReturned.load());
+
+    m_notifiers[EVENT_INDEX].notify();
+    waiter.join();
+    EXPECT_TRUE(hasWaitReturned.load());
+}
+
+TEST_F(ConditionVariable_test, PollingListenerTimedWaitWithoutNotificationReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e8d7c6b-5a4f-4e3d-8c2b-1a0f9e8d7c6b");
+    ConditionListener sut(m_condVarData, WaitOptions{100U, 100U});
+
+    const auto activeNotifications = sut.timedWait(1_ms);
+
+    EXPECT_THAT(activeNotifications.size(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, DestroyWakesUpPollingListenerWhichReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b6c7d8e-9f0a-4b1c-8d2e-3f4a5b6c7d8e");
+    ConditionListener sut(m_condVarData, WaitOptions{1000U, 1000U});
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    sut.destroy();
+    waiter.join();
+    EXPECT_THAT(activeNotifications.size(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, NotifyDoesNotPostSemaphoreWhenListenerIsBusyPolling)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2c3b4a59-6d7e-4f80-9a1b-c2d3e4f5a6b7");
+    ConditionListener sut(m_condVarData, WaitOptions{0U, 0U, true});
+
+    m_signaler.notify();
+
+    auto wasPosted = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_FALSE(*wasPosted);
+    EXPECT_TRUE(m_condVarData.isNotificationActive(0U));
+}
+
+TEST_F(ConditionVariable_test, BusyPollingListenerReturnsNotificationWhichArrivedDuringWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a7b6c5d-4e3f-4a2b-9c1d-0e9f8a7b6c5d");
+    constexpr Type_t EVENT_INDEX = 42U;
+    ConditionListener sut(m_condVarData, WaitOptions{0U, 0U, true});
+    Barrier isThreadStarted(1U);
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] {
+        isThreadStarted.notify();
+        activeNotifications = sut.wait();
+    });
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_notifiers[EVENT_INDEX].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(EVENT_INDEX));
+}
+
+TIMING_TEST_F(ConditionVariable_test, BusyPollingListenerTimedWaitReturnsEmptyVectorAfterTimeout, Repeat(3), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "4f5e6d7c-8b9a-4c0d-9e1f-2a3b4c5d6e7f");
+    ConditionListener sut(m_condVarData, WaitOptions{0U, 0U, true});
+
+    auto start = std::chrono::steady_clock::now();
+    const auto activeNotifications = sut.timedWait(m_timingTestTime);
+    auto end = std::chrono::steady_clock::now();
+
+    TIMING_TEST_EXPECT_TRUE(activeNotifications.empty());
+    TIMING_TEST_EXPECT_TRUE(std::chrono::nanoseconds(end - start).count()
+                            >= static_cast<int64_t>(m_timingTestTime.toNanoseconds()));
+})
+
+TEST_F(ConditionVariable_test, DestroyWakesUpBusyPollingListenerWhichReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7a6c5d4-e3f2-4a1b-8c0d-9e8f7a6b5c4d");
+    ConditionListener sut(m_condVarData, WaitOptions{0U, 0U, true});
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    sut.destroy();
+    waiter.join();
+    EXPECT_THAT(activeNotifications.size(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, WaitReturnsNotificationsOfAllWordsOfTheBitmap)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d6c5b4a-3f2e-4d1c-9b0a-8f7e6d5c4b3a");
+    using NotificationIndex_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_NOTIFIERS>;
+    NotificationVector_t expectedNotifications;
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i += ConditionVariableData::NOTIFIERS_PER_WORD - 1U)
+    {
+        m_notifiers[i].notify();
+        expectedNotifications.emplace_back(static_cast<NotificationIndex_t>(i));
+    }
+    m_notifiers[iox::MAX_NUMBER_OF_NOTIFIERS - 1U].notify();
+    if (expectedNotifications.back() != iox::MAX_NUMBER_OF_NOTIFIERS - 1U)
+    {
+        expectedNotifications.emplace_back(static_cast<NotificationIndex_t>(iox::MAX_NUMBER_OF_NOTIFIERS - 1U));
+    }
+
+    const auto activeNotifications = m_waiter.wait();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(expectedNotifications.size()));
+    for (uint64_t i = 0U; i < expectedNotifications.size(); ++i)
+    {
+        EXPECT_THAT(activeNotifications[i], Eq(expectedNotifications[i]));
+    }
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
+    {
+        EXPECT_FALSE(m_condVarData.isNotificationActive(i));
+    }
+}
+
+TEST_F(ConditionVariable_test, WaitReturnsIndexOfExpiredTimer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "254cd1af-2bfe-4570-ad0e-ef79b46a022e");
+    constexpr Type_t TIMER_INDEX = 13U;
+    ASSERT_TRUE(m_waiter.addTimer(TIMER_INDEX, 10_ms));
+
+    auto activeNotifications = m_waiter.wait();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(TIMER_INDEX));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitReturnsIndexOfTimerWhichExpiresBeforeTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "876a19c1-b44c-47bb-a901-d44dfd6d0f4e");
+    constexpr Type_t TIMER_INDEX = 73U;
+    ASSERT_TRUE(m_waiter.addTimer(TIMER_INDEX, 10_ms));
+
+    auto activeNotifications = m_waiter.timedWait(1_s);
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(TIMER_INDEX));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitReturnsEmptyVectorWhenTimerExpiresAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2142f2ff-0e14-46d5-9a0e-2f69f4c57f34");
+    ASSERT_TRUE(m_waiter.addTimer(0U, 1_s));
+
+    EXPECT_TRUE(m_waiter.timedWait(10_ms).empty());
+}
+
+TEST_F(ConditionVariable_test, TimerWithChangingActivityCounterDoesNotExpire)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "790c051a-a510-48b6-a2e6-6508bb71c742");
+    std::atomic<uint64_t> activityCounter{0U};
+    std::atomic_bool keepActive{true};
+    ASSERT_TRUE(m_waiter.addTimer(0U, 50_ms, &activityCounter));
+
+    std::thread activity([&] {
+        while (keepActive.load())
+        {
+            activityCounter.fetch_add(1U);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    EXPECT_TRUE(m_waiter.timedWait(200_ms).empty());
+    keepActive.store(false);
+    activity.join();
+
+    auto activeNotifications = m_waiter.timedWait(1_s);
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, RemovedTimerDoesNotExpire)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8d36d7a-ff83-42fe-ad0f-643ada5fe38a");
+    ASSERT_TRUE(m_waiter.addTimer(0U, 1_ms));
+    m_waiter.removeTimer(0U);
+
+    EXPECT_TRUE(m_waiter.timedWait(20_ms).empty());
+}
+
+TEST_F(ConditionVariable_test, AddingTimerWakesUpBlockingWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90a68dde-c83d-4d8d-97b8-fa270a1221a2");
+    constexpr Type_t TIMER_INDEX = 200U;
+    Barrier isThreadStarted(1U);
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] {
+        isThreadStarted.notify();
+        activeNotifications = m_waiter.wait();
+    });
+    isThreadStarted.wait();
+
+    ASSERT_TRUE(m_waiter.addTimer(TIMER_INDEX, 10_ms));
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(TIMER_INDEX));
+}
+
+TEST_F(ConditionVariable_test, AddingTimerWithZeroPeriodFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "923a1edb-9edd-4a65-be6e-360e7c7ce3e6");
+    EXPECT_FALSE(m_waiter.addTimer(0U, 0_ms));
+}
+
 } // namespace
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class DirtyPortList_test : public Test
+{
+  public:
+    DirtyPortList m_sut;
+};
+
+TEST_F(DirtyPortList_test, PopFromEmptyListReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "74bae81e-219c-436f-967e-6db5a76fa749");
+    EXPECT_FALSE(m_sut.pop().has_value());
+    EXPECT_FALSE(m_sut.checkAndResetOverflow());
+}
+
+TEST_F(DirtyPortList_test, PortsArePoppedInOrderOfPushing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5248802-00ea-4b9d-956a-3e0e180dc99b");
+    m_sut.push({DirtyPortKind::SUBSCRIBER, 13U});
+    m_sut.push({DirtyPortKind::SERVER, 42U});
+
+    auto port = m_sut.pop();
+    ASSERT_TRUE(port.has_value());
+    EXPECT_THAT(port->kind, Eq(DirtyPortKind::SUBSCRIBER));
+    EXPECT_THAT(port->index, Eq(13U));
+
+    port = m_sut.pop();
+    ASSERT_TRUE(port.has_value());
+    EXPECT_THAT(port->kind, Eq(DirtyPortKind::SERVER));
+    EXPECT_THAT(port->index, Eq(42U));
+
+    EXPECT_FALSE(m_sut.pop().has_value());
+}
+
+TEST_F(DirtyPortList_test, PushingIntoFullListRecordsOverflowOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e8e1adc-b243-40f6-ad7e-4cc214839f9f");
+    for (uint64_t i = 0U; i < DirtyPortList::CAPACITY; ++i)
+    {
+        m_sut.push({DirtyPortKind::PUBLISHER, static_cast<uint32_t>(i)});
+    }
+    EXPECT_FALSE(m_sut.checkAndResetOverflow());
+
+    m_sut.push({DirtyPortKind::CLIENT, 0U});
+
+    EXPECT_TRUE(m_sut.checkAndResetOverflow());
+    EXPECT_FALSE(m_sut.checkAndResetOverflow());
+}
+
+} // namespace
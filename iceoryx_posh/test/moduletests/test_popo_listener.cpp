@@ -138,6 +138,11 @@ class TestListener : public Listener
         : Listener(data)
     {
     }
+
+    TestListener(ConditionVariableData& data, const ListenerOptions& options) noexcept
+        : Listener(data, options)
+    {
+    }
 };
 
 struct EventAndSutPair_t
@@ -150,6 +155,7 @@ struct TriggerSourceAndCount
 {
     std::atomic<SimpleEventClass*> m_source{nullptr};
     std::atomic<uint64_t> m_count{0U};
+    std::atomic<uint64_t> m_sequenceNumber{0U};
 };
 
 iox::concurrent::smart_lock<std::vector<EventAndSutPair_t>> g_toBeAttached;
@@ -157,6 +163,12 @@ iox::concurrent::smart_lock<std::vector<EventAndSutPair_t>> g_toBeDetached;
 std::array<TriggerSourceAndCount, iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER> g_triggerCallbackArg;
 uint64_t g_triggerCallbackRuntimeInMs = 0U;
 iox::cxx::optional<iox::posix::UnnamedSemaphore> g_callbackBlocker;
+iox::cxx::optional<iox::posix::UnnamedSemaphore> g_callbackExecuted;
+iox::cxx::optional<iox::posix::UnnamedSemaphore> g_workerCallbackEntered;
+iox::cxx::optional<iox::posix::UnnamedSemaphore> g_workerCallbackBlocker;
+std::atomic<uint64_t> g_callbackSequenceNumber{0U};
+std::atomic<uint64_t> g_concurrentCallbackInvocations{0U};
+std::atomic<uint64_t> g_maxConcurrentCallbackInvocations{0U};
 
 class Listener_test : public Test
 {
@@ -166,7 +178,12 @@ class Listener_test : public Test
     {
         g_triggerCallbackArg[N].m_source = event;
         ++g_triggerCallbackArg[N].m_count;
+        g_triggerCallbackArg[N].m_sequenceNumber = ++g_callbackSequenceNumber;
 
+        if (g_callbackExecuted)
+        {
+            IOX_DISCARD_RESULT(g_callbackExecuted->post());
+        }
         if (g_callbackBlocker)
         {
             IOX_DISCARD_RESULT(g_callbackBlocker->wait());
@@ -174,6 +191,32 @@ class Listener_test : public Test
         std::this_thread::sleep_for(std::chrono::milliseconds(g_triggerCallbackRuntimeInMs));
     }
 
+    static void blockingWorkerCallback(SimpleEventClass* const event) noexcept
+    {
+        auto invocations = ++g_concurrentCallbackInvocations;
+        auto maxInvocations = g_maxConcurrentCallbackInvocations.load();
+        while (invocations > maxInvocations
+               && !g_maxConcurrentCallbackInvocations.compare_exchange_weak(maxInvocations, invocations))
+        {
+        }
+
+        g_triggerCallbackArg[0U].m_source = event;
+        ++g_triggerCallbackArg[0U].m_count;
+        IOX_DISCARD_RESULT(g_workerCallbackEntered->post());
+        IOX_DISCARD_RESULT(g_workerCallbackBlocker->wait());
+        --g_concurrentCallbackInvocations;
+    }
+
+    static void detachingWorkerCallback(SimpleEventClass* const event) noexcept
+    {
+        ++g_triggerCallbackArg[0U].m_count;
+        IOX_DISCARD_RESULT(g_workerCallbackEntered->post());
+        IOX_DISCARD_RESULT(g_workerCallbackBlocker->wait());
+        detachCallback(event);
+        IOX_DISCARD_RESULT(g_workerCallbackEntered->post());
+        IOX_DISCARD_RESULT(g_workerCallbackBlocker->wait());
+    }
+
     static void triggerCallbackWithUserType(SimpleEventClass* const event, uint64_t* userType) noexcept
     {
         g_triggerCallbackArg[0].m_source = event;
@@ -213,18 +256,35 @@ class Listener_test : public Test
     void SetUp()
     {
         g_callbackBlocker.reset();
+        g_callbackExecuted.reset();
+        g_workerCallbackEntered.reset();
+        g_workerCallbackBlocker.reset();
         for (auto& e : g_triggerCallbackArg)
         {
             e.m_source = nullptr;
             e.m_count = 0U;
+            e.m_sequenceNumber = 0U;
         }
         m_sut.emplace(m_condVarData);
         g_invalidateTriggerId = 0U;
         g_triggerCallbackRuntimeInMs = 0U;
+        g_callbackSequenceNumber = 0U;
+        g_concurrentCallbackInvocations = 0U;
+        g_maxConcurrentCallbackInvocations = 0U;
         g_toBeAttached->clear();
         g_toBeDetached->clear();
     };
 
+    static ListenerOptions createOptionsWithWorkers(const uint64_t numberOfWorkers) noexcept
+    {
+        ListenerOptions options;
+        for (uint64_t i = 0U; i < numberOfWorkers; ++i)
+        {
+            options.workers.emplace_back();
+        }
+        return options;
+    }
+
     void activateTriggerCallbackBlocker() noexcept
     {
         iox::posix::UnnamedSemaphoreBuilder()
@@ -234,6 +294,23 @@ class Listener_test : public Test
             .expect("Unable to create callback blocker semaphore");
     }
 
+    static void createSemaphore(iox::cxx::optional<iox::posix::UnnamedSemaphore>& semaphore) noexcept
+    {
+        iox::posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(semaphore)
+            .expect("Unable to create semaphore");
+    }
+
+    /// @brief the callbacks signal their execution and the blockingWorkerCallback blocks until it is unblocked
+    void activateWorkerCallbackSignals() noexcept
+    {
+        createSemaphore(g_callbackExecuted);
+        createSemaphore(g_workerCallbackEntered);
+        createSemaphore(g_workerCallbackBlocker);
+    }
+
     void unblockTriggerCallback(const uint64_t numberOfUnblocks) noexcept
     {
         for (uint64_t i = 0U; i < numberOfUnblocks; ++i)
@@ -1234,6 +1311,219 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &events[1U]);
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
 })
+TIMING_TEST_F(Listener_test, CallbackOfHighPriorityEventIsCalledFirst, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "6a1d4f8c-2e7b-4c9a-b3f5-8d0e2a6c4b91");
+    m_sut.emplace(m_condVarData);
+    constexpr iox::popo::NotificationPriority HIGH_PRIORITY{10U};
+    SimpleEventClass blockingEvent;
+    SimpleEventClass lowPriorityEvent;
+    SimpleEventClass highPriorityEvent;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(blockingEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(lowPriorityEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(highPriorityEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<2U>),
+                                   HIGH_PRIORITY)
+                     .has_error());
+
+    // the blocking callback keeps the listener busy until both other events are triggered, therefore they are
+    // returned by the same wait call
+    activateTriggerCallbackBlocker();
+    blockingEvent.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    lowPriorityEvent.triggerStoepsel();
+    highPriorityEvent.triggerStoepsel();
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(3U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_count == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[2U].m_count == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[2U].m_sequenceNumber < g_triggerCallbackArg[1U].m_sequenceNumber);
+})
+//////////////////////////////////
+// END
+//////////////////////////////////
+
+///////////////////////////////////
+// BEGIN worker pool
+///////////////////////////////////
+TEST_F(Listener_test, SlowCallbackDoesNotDelayOtherCallbacksWhenWorkersAreUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e3b1f6a-2c4d-4a7e-b9f0-6d1c3e5a8b72");
+    m_sut.emplace(m_condVarData, createOptionsWithWorkers(2U));
+    activateWorkerCallbackSignals();
+    SimpleEventClass slowEvent;
+    SimpleEventClass fastEvent;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(slowEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::blockingWorkerCallback))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fastEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    slowEvent.triggerStoepsel();
+    ASSERT_FALSE(g_workerCallbackEntered->wait().has_error());
+    fastEvent.triggerStoepsel();
+    // blocks until the watchdog terminates the test when the fast callback waits for the slow one
+    ASSERT_FALSE(g_callbackExecuted->wait().has_error());
+
+    EXPECT_THAT(g_triggerCallbackArg[1U].m_source.load(), Eq(&fastEvent));
+    EXPECT_THAT(g_triggerCallbackArg[1U].m_count.load(), Eq(1U));
+
+    ASSERT_FALSE(g_workerCallbackBlocker->post().has_error());
+    m_sut.reset();
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_source.load(), Eq(&slowEvent));
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(1U));
+}
+
+TEST_F(Listener_test, CallbackOfAnEventIsNeverExecutedConcurrentlyWhenWorkersAreUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5a9e2d7-4b1f-4e8c-a3d6-0f7b2c9e1a54");
+    constexpr uint64_t NUMBER_OF_WORKERS{4U};
+    constexpr uint64_t NUMBER_OF_TRIGGERS{10U};
+    constexpr NotificationPriority HIGH_PRIORITY{1U};
+    m_sut.emplace(m_condVarData, createOptionsWithWorkers(NUMBER_OF_WORKERS));
+    activateWorkerCallbackSignals();
+    SimpleEventClass fuu;
+    SimpleEventClass fence;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::blockingWorkerCallback),
+                                   HIGH_PRIORITY)
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fence,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    fuu.triggerStoepsel();
+    ASSERT_FALSE(g_workerCallbackEntered->wait().has_error());
+
+    // the notifications of both events are stored in the same word of the bitmap and the fence has the lower
+    // priority, therefore fuu was dispatched again to the idle workers before the fence callback is executed
+    for (uint64_t i = 0U; i < NUMBER_OF_TRIGGERS; ++i)
+    {
+        fuu.triggerStoepsel();
+        fence.triggerStoepsel();
+        ASSERT_FALSE(g_callbackExecuted->wait().has_error());
+    }
+
+    ASSERT_FALSE(g_workerCallbackBlocker->post().has_error());
+    ASSERT_FALSE(g_workerCallbackEntered->wait().has_error());
+    ASSERT_FALSE(g_workerCallbackBlocker->post().has_error());
+    m_sut.reset();
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_source.load(), Eq(&fuu));
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(2U));
+    EXPECT_THAT(g_maxConcurrentCallbackInvocations.load(), Eq(1U));
+}
+
+TEST_F(Listener_test, TriggeringAllEventsCallsAllCallbacksWhenWorkersAreUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f6d8b3a-9e1c-4c5f-8a7d-b4e0c2f1d963");
+    m_sut.emplace(m_condVarData, createOptionsWithWorkers(iox::MAX_NUMBER_OF_LISTENER_WORKERS));
+    activateWorkerCallbackSignals();
+    std::vector<SimpleEventClass> events(iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER);
+
+    AttachEvent<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER - 1U>::doIt(*m_sut, events, SimpleEvent::StoepselBachelorParty);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    for (auto& e : events)
+    {
+        e.triggerStoepsel();
+    }
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; ++i)
+    {
+        ASSERT_FALSE(g_callbackExecuted->wait().has_error());
+    }
+    m_sut.reset();
+
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; ++i)
+    {
+        EXPECT_THAT(g_triggerCallbackArg[i].m_source.load(), Eq(&events[i]));
+        EXPECT_THAT(g_triggerCallbackArg[i].m_count.load(), Eq(1U));
+    }
+}
+
+TEST_F(Listener_test, EventDetachedInItsCallbackKeepsItsIndexUntilTheWorkerHasFinished)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b7e2a91-d3c6-4f08-9e5a-1c8d6f2b7a30");
+    constexpr NotificationPriority HIGH_PRIORITY{1U};
+    m_sut.emplace(m_condVarData, createOptionsWithWorkers(2U));
+    activateWorkerCallbackSignals();
+    SimpleEventClass detachedEvent;
+    SimpleEventClass fence;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(detachedEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::detachingWorkerCallback),
+                                   HIGH_PRIORITY)
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fence,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+    // the index of the detached event is the only one a new event can get
+    for (uint64_t i = 2U; i < m_sut->capacity(); ++i)
+    {
+        ASSERT_FALSE(m_sut
+                         ->attachEvent(m_simpleEvents[i],
+                                       SimpleEvent::StoepselBachelorParty,
+                                       createNotificationCallback(Listener_test::triggerCallback<2U>))
+                         .has_error());
+    }
+    g_toBeDetached->push_back({&detachedEvent, &*m_sut});
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    detachedEvent.triggerStoepsel();
+    ASSERT_FALSE(g_workerCallbackEntered->wait().has_error());
+    detachedEvent.triggerStoepsel();
+    fence.triggerStoepsel();
+    ASSERT_FALSE(g_callbackExecuted->wait().has_error());
+
+    // the callback detaches its event while it fired again, its index must not be reused before the worker has
+    // finished, otherwise the worker would execute the callback of the next attached event
+    ASSERT_FALSE(g_workerCallbackBlocker->post().has_error());
+    ASSERT_FALSE(g_workerCallbackEntered->wait().has_error());
+    EXPECT_THAT(m_sut->size(), Eq(m_sut->capacity()));
+
+    ASSERT_FALSE(g_workerCallbackBlocker->post().has_error());
+    while (m_sut->size() == m_sut->capacity())
+    {
+        std::this_thread::yield();
+    }
+    SimpleEventClass newEvent;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(newEvent,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<3U>))
+                     .has_error());
+    m_sut.reset();
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(1U));
+    EXPECT_THAT(g_triggerCallbackArg[3U].m_count.load(), Eq(0U));
+}
 //////////////////////////////////
 // END
 //////////////////////////////////
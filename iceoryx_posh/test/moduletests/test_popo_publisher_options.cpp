@@ -74,4 +74,39 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
         .or_else([&](auto&) { GTEST_SUCCEED(); });
 }
 
+TEST(PublisherOptions_test, ComparisonOperatorReturnsTrueWhenEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20a8618b-5ff3-4d34-9339-daee8cccd832");
+    iox::popo::PublisherOptions options1;
+    iox::popo::PublisherOptions options2;
+
+    EXPECT_TRUE(options1 == options1);
+    EXPECT_TRUE(options1 == options2);
+    EXPECT_TRUE(options2 == options1);
+}
+
+TEST(PublisherOptions_test, ComparisonOperatorReturnsFalseWhenHistoryCapacityDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1bc85d7-bc57-42b9-9ea7-2baf9246f341");
+    iox::popo::PublisherOptions options1;
+    options1.historyCapacity = 42U;
+    iox::popo::PublisherOptions options2;
+    options2.historyCapacity = 73U;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
+TEST(PublisherOptions_test, ComparisonOperatorReturnsFalseWhenOfferOnCreateDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53096992-378e-4dd1-9c58-ed7018cd19a7");
+    iox::popo::PublisherOptions options1;
+    options1.offerOnCreate = true;
+    iox::popo::PublisherOptions options2;
+    options2.offerOnCreate = false;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -34,6 +34,8 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.subscribeOnCreate = false;
     testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.requiresPublisherHistorySupport = true;
+    testOptions.useShardedQueue = true;
+    testOptions.deadline = iox::units::Duration::fromMilliseconds(13U);
 
     iox::popo::SubscriberOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -53,6 +55,12 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
             EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
             EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
                         Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.useShardedQueue, Ne(defaultOptions.useShardedQueue));
+            EXPECT_THAT(roundTripOptions.useShardedQueue, Eq(testOptions.useShardedQueue));
+
+            EXPECT_THAT(roundTripOptions.deadline, Ne(defaultOptions.deadline));
+            EXPECT_THAT(roundTripOptions.deadline, Eq(testOptions.deadline));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of SubscriberOptions failed!"; });
 }
@@ -82,4 +90,39 @@ TEST(SubscriberOptions_test, DeserializingInvalidQueueFullPolicyFails)
         .or_else([&](auto&) { GTEST_SUCCEED(); });
 }
 
+TEST(SubscriberOptions_test, ComparisonOperatorReturnsTrueWhenEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7ac81ad3-fc6b-4ecb-831d-f3bee8fb89da");
+    iox::popo::SubscriberOptions options1;
+    iox::popo::SubscriberOptions options2;
+
+    EXPECT_TRUE(options1 == options1);
+    EXPECT_TRUE(options1 == options2);
+    EXPECT_TRUE(options2 == options1);
+}
+
+TEST(SubscriberOptions_test, ComparisonOperatorReturnsFalseWhenQueueCapacityDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69296fff-1a7e-489b-a019-fbee3da3f293");
+    iox::popo::SubscriberOptions options1;
+    options1.queueCapacity = 42U;
+    iox::popo::SubscriberOptions options2;
+    options2.queueCapacity = 73U;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
+TEST(SubscriberOptions_test, ComparisonOperatorReturnsFalseWhenDeadlineDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ec43957-17b2-44de-ba2b-8f19c6061695");
+    iox::popo::SubscriberOptions options1;
+    options1.deadline = iox::units::Duration::fromMilliseconds(42U);
+    iox::popo::SubscriberOptions options2;
+    options2.deadline = iox::units::Duration::fromMilliseconds(73U);
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
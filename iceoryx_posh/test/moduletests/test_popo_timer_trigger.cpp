@@ -0,0 +1,175 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public iox::popo::WaitSet<>
+{
+  public:
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class ListenerTest : public iox::popo::Listener
+{
+  public:
+    ListenerTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : Listener(condVarData)
+    {
+    }
+};
+
+class TimerTrigger_test : public Test
+{
+  public:
+    const units::Duration m_period{10_ms};
+    const units::Duration m_timeout{1_s};
+    TimerTrigger m_sut{m_period};
+    ConditionVariableData m_condVar{"Horscht"};
+    ConditionVariableData m_condVar2{"Schnuppi"};
+    WaitSetTest m_waitSet{m_condVar};
+    WaitSetTest m_waitSet2{m_condVar2};
+
+    static std::atomic<uint64_t> m_numberOfCallbacks;
+    static void callback(TimerTrigger*)
+    {
+        ++m_numberOfCallbacks;
+    }
+
+    void SetUp() override
+    {
+        m_numberOfCallbacks = 0U;
+    }
+};
+
+std::atomic<uint64_t> TimerTrigger_test::m_numberOfCallbacks{0U};
+
+TEST_F(TimerTrigger_test, IsNotTriggeredWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9b0b1b8-22fc-4b7d-8535-dad8f26cdf2f");
+    EXPECT_FALSE(m_sut.hasTriggered());
+    EXPECT_THAT(m_sut.getPeriod(), Eq(m_period));
+}
+
+TEST_F(TimerTrigger_test, IsNotTriggeredWhenNotAttached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f57b2143-0fc8-4449-8eab-8092575cce40");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2U * m_period.toMilliseconds()));
+    EXPECT_FALSE(m_sut.hasTriggered());
+}
+
+TEST_F(TimerTrigger_test, TriggersWaitSetPeriodically)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f378e140-6009-4234-bd80-be77c7659dad");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut, 0U, createNotificationCallback(callback)).has_error());
+
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        auto notifications = m_waitSet.timedWait(m_timeout);
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_TRUE(notifications[0]->doesOriginateFrom(&m_sut));
+        (*notifications[0])();
+    }
+    EXPECT_THAT(m_numberOfCallbacks.load(), Eq(3U));
+}
+
+TEST_F(TimerTrigger_test, TriggersListenerPeriodically)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "285564af-5c43-4cf0-bdc5-7243d52986d7");
+    ConditionVariableData condVar{"Hypnotoad"};
+    ListenerTest listener{condVar};
+    ASSERT_FALSE(listener.attachEvent(m_sut, createNotificationCallback(callback)).has_error());
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(m_timeout.toNanoseconds());
+    while (m_numberOfCallbacks.load() < 3U && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_THAT(m_numberOfCallbacks.load(), Ge(3U));
+    listener.detachEvent(m_sut);
+}
+
+TEST_F(TimerTrigger_test, TimerTriggerGoesOutOfScopeCleansupAtWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2224e4f7-3f14-42fe-8ba3-9d80f0ef911e");
+    {
+        TimerTrigger sut{m_period};
+        ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    }
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    EXPECT_TRUE(m_waitSet.timedWait(m_period * 2U).empty());
+}
+
+TEST_F(TimerTrigger_test, AttachingToAnotherWaitSetCleansupFirstWaitset)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ff80c42-4d4f-40d5-835e-ac8b639bd6b4");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    ASSERT_FALSE(m_waitSet2.attachEvent(m_sut).has_error());
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    EXPECT_THAT(m_waitSet2.size(), Eq(1U));
+    EXPECT_TRUE(m_waitSet.timedWait(m_period * 2U).empty());
+    EXPECT_THAT(m_waitSet2.timedWait(m_timeout).size(), Eq(1U));
+}
+
+TEST_F(TimerTrigger_test, DetachingFromWaitSetStopsTheTimer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97f869b0-8bce-4131-a3ad-e84cb078409c");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_waitSet.detachEvent(m_sut);
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    EXPECT_TRUE(m_waitSet.timedWait(m_period * 2U).empty());
+}
+
+TEST_F(TimerTrigger_test, SettingPeriodToZeroStopsTheTimer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "82f927f8-39b7-4696-ac6d-2e55ba6d6930");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.setPeriod(0_ms);
+
+    EXPECT_TRUE(m_waitSet.timedWait(m_period * 2U).empty());
+}
+
+TEST_F(TimerTrigger_test, SettingPeriodRestartsAttachedTimerWithNewPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4cd71baf-9dae-42c3-8172-b7220507ffa2");
+    TimerTrigger sut{1_s * 100U};
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.setPeriod(m_period);
+
+    EXPECT_THAT(sut.getPeriod(), Eq(m_period));
+    EXPECT_THAT(m_waitSet.timedWait(m_timeout).size(), Eq(1U));
+}
+
+} // namespace
@@ -0,0 +1,171 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/timer_wheel.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class TimerWheel_test : public Test
+{
+  public:
+    using ExpiredIndices_t = iox::cxx::vector<uint64_t, TimerWheel::CAPACITY>;
+
+    ExpiredIndices_t advanceTo(const iox::units::Duration now)
+    {
+        ExpiredIndices_t expiredIndices;
+        m_sut.advance(now, [&](const uint64_t index) { expiredIndices.emplace_back(index); });
+        return expiredIndices;
+    }
+
+    const iox::units::Duration m_start{1000_s};
+    TimerWheel m_sut{1_ms};
+};
+
+TEST_F(TimerWheel_test, IsEmptyAfterConstruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0bc7e242-00e6-4405-bce0-a3886b5839d3");
+    EXPECT_TRUE(m_sut.empty());
+    EXPECT_FALSE(m_sut.timeUntilNextExpiry(m_start).has_value());
+}
+
+TEST_F(TimerWheel_test, AddingTimerWithInvalidArgumentsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d09a567f-607f-4930-b779-771ec702f171");
+    EXPECT_FALSE(m_sut.add(TimerWheel::CAPACITY, 10_ms, m_start));
+    EXPECT_FALSE(m_sut.add(0U, 0_ms, m_start));
+    EXPECT_TRUE(m_sut.empty());
+}
+
+TEST_F(TimerWheel_test, TimerDoesNotExpireBeforeItsPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "683cca7e-bdc4-4400-aab6-6a9150675be1");
+    ASSERT_TRUE(m_sut.add(5U, 10_ms, m_start));
+
+    EXPECT_TRUE(advanceTo(m_start + 9_ms).empty());
+    ASSERT_TRUE(m_sut.timeUntilNextExpiry(m_start + 9_ms).has_value());
+    EXPECT_THAT(*m_sut.timeUntilNextExpiry(m_start + 9_ms), Eq(1_ms));
+}
+
+TEST_F(TimerWheel_test, TimerExpiresPeriodically)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1fe9275b-f9a9-4fb1-aa80-6e37637e6d68");
+    constexpr uint64_t INDEX{42U};
+    ASSERT_TRUE(m_sut.add(INDEX, 10_ms, m_start));
+
+    for (uint64_t period = 1U; period <= 5U; ++period)
+    {
+        auto expiredIndices = advanceTo(m_start + iox::units::Duration::fromMilliseconds(10U * period));
+        ASSERT_THAT(expiredIndices.size(), Eq(1U));
+        EXPECT_THAT(expiredIndices[0], Eq(INDEX));
+    }
+}
+
+TEST_F(TimerWheel_test, TimerWithPeriodLongerThanOneRotationExpiresOnlyAfterItsPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92a15919-1e68-4ca0-9c6e-2edbb639caf7");
+    const auto period = iox::units::Duration::fromMilliseconds(3U * TimerWheel::NUMBER_OF_SLOTS + 7U);
+    ASSERT_TRUE(m_sut.add(0U, period, m_start));
+
+    for (auto now = m_start + 1_ms; now < m_start + period; now = now + 1_ms)
+    {
+        ASSERT_TRUE(advanceTo(now).empty());
+    }
+    EXPECT_THAT(*m_sut.timeUntilNextExpiry(m_start + period - 1_ms), Eq(1_ms));
+    EXPECT_THAT(advanceTo(m_start + period).size(), Eq(1U));
+}
+
+TEST_F(TimerWheel_test, MissedPeriodsExpireTheTimerOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b3529a3-57bc-41a2-93c5-c94838cdd570");
+    ASSERT_TRUE(m_sut.add(0U, 10_ms, m_start));
+
+    EXPECT_THAT(advanceTo(m_start + 10_s).size(), Eq(1U));
+    EXPECT_TRUE(advanceTo(m_start + 10_s + 9_ms).empty());
+    EXPECT_THAT(advanceTo(m_start + 10_s + 10_ms).size(), Eq(1U));
+}
+
+TEST_F(TimerWheel_test, AllTimersWhichAreDueExpire)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3dfb9281-dfa8-4eb0-8eed-bff7aa6c4af5");
+    for (uint64_t index = 0U; index < TimerWheel::CAPACITY; ++index)
+    {
+        ASSERT_TRUE(m_sut.add(index, iox::units::Duration::fromMilliseconds(index + 1U), m_start));
+    }
+
+    EXPECT_THAT(advanceTo(m_start + 10_ms).size(), Eq(10U));
+    EXPECT_THAT(*m_sut.timeUntilNextExpiry(m_start + 10_ms), Eq(1_ms));
+}
+
+TEST_F(TimerWheel_test, RemovedTimerDoesNotExpire)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6118a025-19b8-4b0f-a382-309c3cf48aeb");
+    ASSERT_TRUE(m_sut.add(0U, 10_ms, m_start));
+    ASSERT_TRUE(m_sut.add(1U, 10_ms, m_start));
+    m_sut.remove(0U);
+
+    auto expiredIndices = advanceTo(m_start + 10_ms);
+    ASSERT_THAT(expiredIndices.size(), Eq(1U));
+    EXPECT_THAT(expiredIndices[0], Eq(1U));
+
+    m_sut.remove(1U);
+    EXPECT_TRUE(m_sut.empty());
+}
+
+TEST_F(TimerWheel_test, AddingTimerOfArmedIndexReplacesIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07db5914-31ec-4f84-81fc-a6e8ddd334e3");
+    ASSERT_TRUE(m_sut.add(0U, 10_ms, m_start));
+    ASSERT_TRUE(m_sut.add(0U, 20_ms, m_start));
+
+    EXPECT_TRUE(advanceTo(m_start + 10_ms).empty());
+    EXPECT_THAT(advanceTo(m_start + 20_ms).size(), Eq(1U));
+}
+
+TEST_F(TimerWheel_test, AddingTimerWithZeroPeriodDisarmsArmedTimer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f5a20b0-8da5-4168-9802-d3a07d107944");
+    ASSERT_TRUE(m_sut.add(0U, 10_ms, m_start));
+    EXPECT_FALSE(m_sut.add(0U, 0_ms, m_start));
+
+    EXPECT_TRUE(m_sut.empty());
+    EXPECT_TRUE(advanceTo(m_start + 10_ms).empty());
+}
+
+TEST_F(TimerWheel_test, TimerWithActivityCounterExpiresOnlyWithoutActivity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c978e6f-8025-4a73-9f32-b33cde09cee5");
+    std::atomic<uint64_t> activityCounter{0U};
+    ASSERT_TRUE(m_sut.add(0U, 10_ms, m_start, &activityCounter));
+
+    activityCounter.fetch_add(1U);
+    EXPECT_TRUE(advanceTo(m_start + 10_ms).empty());
+
+    EXPECT_THAT(advanceTo(m_start + 20_ms).size(), Eq(1U));
+
+    activityCounter.fetch_add(1U);
+    EXPECT_TRUE(advanceTo(m_start + 30_ms).empty());
+}
+
+} // namespace
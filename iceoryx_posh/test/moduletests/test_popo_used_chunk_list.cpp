@@ -318,4 +318,25 @@ TEST_F(UsedChunkList_test, CallingCleanupReleasesAllChunks)
     EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
     checkIfEmpty();
 }
+
+TEST_F(UsedChunkList_test, ForEachStorageSlotVisitsAllSlotsAndTheStoredChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd5b5f9b-a834-43e8-8e74-d0ed03dc6b80");
+    auto chunk = getChunkFromMemoryManager();
+    auto chunkHeader = chunk.getChunkHeader();
+    sut.insert(chunk);
+
+    uint32_t numberOfSlots{0U};
+    uint32_t numberOfFoundChunks{0U};
+    sut.forEachStorageSlot([&](const ShmSafeUnmanagedChunk& slot) {
+        ++numberOfSlots;
+        if (slot.getChunkHeader() == chunkHeader)
+        {
+            ++numberOfFoundChunks;
+        }
+    });
+
+    EXPECT_THAT(numberOfSlots, Eq(USED_CHUNK_LIST_CAPACITY));
+    EXPECT_THAT(numberOfFoundChunks, Eq(1U));
+}
 } // namespace
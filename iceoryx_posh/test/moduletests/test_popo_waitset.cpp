@@ -44,6 +44,11 @@ class WaitSetTest : public iox::popo::WaitSet<>
         : WaitSet(condVarData)
     {
     }
+
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData, const iox::popo::WaitOptions& waitOptions) noexcept
+        : WaitSet(condVarData, waitOptions)
+    {
+    }
 };
 
 enum class SimpleEvent1 : iox::popo::EventEnumIdentifier
@@ -977,6 +982,41 @@ TEST_F(WaitSet_test, TimedWaitReturnsTheOneTriggeredCondition)
     WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->timedWait(10_ms); });
 }
 
+TEST_F(WaitSet_test, PollingWaitReturnsTheOneTriggeredCondition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1d2e3f4-a5b6-4c7d-8e9f-0a1b2c3d4e5f");
+    m_sut.reset();
+    m_sut.emplace(m_condVarData, WaitOptions{1000U, 100U});
+    WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->wait(); });
+}
+
+TEST_F(WaitSet_test, PollingTimedWaitReturnsTheOneTriggeredCondition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5e4d3c2-b1a0-4f9e-8d7c-6b5a4f3e2d1c");
+    m_sut.reset();
+    m_sut.emplace(m_condVarData, WaitOptions{1000U, 100U});
+    WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->timedWait(10_ms); });
+}
+
+TEST_F(WaitSet_test, BusyPollingWaitReturnsTheOneTriggeredCondition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1f2a3b4-c5d6-4e7f-8a9b-0c1d2e3f4a5b");
+    m_sut.reset();
+    m_sut.emplace(m_condVarData, WaitOptions{0U, 0U, true});
+    WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->wait(); });
+}
+
+TEST_F(WaitSet_test, BusyPollingTimedWaitReturnsNothingWhenNothingTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a4b3c2d-1e0f-4a9b-8c7d-6e5f4a3b2c1d");
+    m_sut.reset();
+    m_sut.emplace(m_condVarData, WaitOptions{0U, 0U, true});
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 5U).has_error());
+
+    auto triggerVector = m_sut->timedWait(10_ms);
+    EXPECT_THAT(triggerVector.size(), Eq(0U));
+}
+
 void WaitReturnsAllTriggeredConditionWhenMultipleAreTriggered(
     WaitSet_test* test, const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -1228,6 +1268,37 @@ TEST_F(WaitSet_test, NonResetStatesAreReturnedAgainInWait)
     NonResetStatesAreReturnedAgain(this, [&] { return m_sut->wait(); });
 }
 
+void StatesWhichHoldWhenTheyAreAttachedAreReturned(WaitSet_test* test,
+                                                   const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
+{
+    // the states hold without a notification of their origin, like a subscriber which received samples before
+    test->m_simpleEvents[3].m_autoResetTrigger = false;
+    test->m_simpleEvents[3].m_hasTriggered.store(true);
+    test->m_simpleEvents[5].m_autoResetTrigger = false;
+    test->m_simpleEvents[5].m_hasTriggered.store(true);
+
+    test->attachAllStates();
+
+    auto eventVector = waitCall();
+
+    ASSERT_THAT(eventVector.size(), Eq(2U));
+    EXPECT_TRUE(test->doesNotificationInfoVectorContain(eventVector, 3U, test->m_simpleEvents[3]));
+    EXPECT_TRUE(test->doesNotificationInfoVectorContain(eventVector, 5U, test->m_simpleEvents[5]));
+}
+
+TEST_F(WaitSet_test, StatesWhichHoldWhenTheyAreAttachedAreReturnedInTimedWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "75089604-a7df-44ee-beb7-ed094636b74d");
+    StatesWhichHoldWhenTheyAreAttachedAreReturned(
+        this, [&] { return m_sut->timedWait(iox::units::Duration::fromMilliseconds(100)); });
+}
+
+TEST_F(WaitSet_test, StatesWhichHoldWhenTheyAreAttachedAreReturnedInWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "caea1141-8e27-4089-bed3-a17fea930a0d");
+    StatesWhichHoldWhenTheyAreAttachedAreReturned(this, [&] { return m_sut->wait(); });
+}
+
 void TriggeredEventsAreNotReturnedTwice(WaitSet_test* test,
                                         const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -1535,4 +1606,45 @@ TEST_F(WaitSet_test, TimedWaitUnblocksAfterMarkForDestructionCall)
     t.join();
 }
 
+TEST_F(WaitSet_test, WaitReturnsTriggeredEventsOrderedByDescendingPriority)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b7e9c1d-5a2f-4d8e-b6c0-9f1a4e7d2c58");
+    constexpr uint64_t NUMBER_OF_EVENTS{5U};
+    const iox::popo::NotificationPriority priorities[NUMBER_OF_EVENTS]{0U, 4U, 1U, 3U, 2U};
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], i, {}, priorities[i]).has_error());
+        m_simpleEvents[i].trigger();
+    }
+
+    auto triggerVector = m_sut->wait();
+
+    ASSERT_THAT(triggerVector.size(), Eq(NUMBER_OF_EVENTS));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(1U));
+    EXPECT_THAT(triggerVector[1U]->getNotificationId(), Eq(3U));
+    EXPECT_THAT(triggerVector[2U]->getNotificationId(), Eq(4U));
+    EXPECT_THAT(triggerVector[3U]->getNotificationId(), Eq(2U));
+    EXPECT_THAT(triggerVector[4U]->getNotificationId(), Eq(0U));
+}
+
+TEST_F(WaitSet_test, HighPriorityStateIsReturnedBeforeLowPriorityEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4c8a2f6-1d9b-4f3e-8a7c-2b5d0e9f6a13");
+    constexpr uint64_t HIGH_PRIORITY_ID{1337U};
+    constexpr iox::popo::NotificationPriority HIGH_PRIORITY{200U};
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], i).has_error());
+        m_simpleEvents[i].trigger();
+    }
+    ASSERT_FALSE(m_sut->attachState(m_simpleEvents[3U], HIGH_PRIORITY_ID, {}, HIGH_PRIORITY).has_error());
+    m_simpleEvents[3U].trigger();
+
+    auto triggerVector = m_sut->wait();
+
+    ASSERT_THAT(triggerVector.size(), Eq(4U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(HIGH_PRIORITY_ID));
+    EXPECT_TRUE(triggerVector[0U]->doesOriginateFrom(&m_simpleEvents[3U]));
+}
+
 } // namespace
@@ -20,11 +20,13 @@
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_port_request.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/popo/untyped_client.hpp"
 #include "iceoryx_posh/popo/untyped_server.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/runtime/service_discovery.hpp"
 #include "iceoryx_posh/testing/mocks/posh_runtime_mock.hpp"
 #include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
 #include "test.hpp"
@@ -264,6 +266,190 @@ TEST_F(PoshRuntime_test, SendRequestToRouDiInvalidMessage)
     EXPECT_FALSE(successfullySent);
 }
 
+TEST_F(PoshRuntime_test, SendBinaryRequestWithMultiplePortRequestsToRouDiReturnsOneResponsePerRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "86c68790-57e0-47de-ba63-c66324197b98");
+    IpcPortRequest publisherRequest;
+    publisherRequest.type = IpcMessageType::CREATE_PUBLISHER;
+    publisherRequest.service = ServiceDescription("Batch", "Publisher", "Request");
+    IpcPortRequest subscriberRequest;
+    subscriberRequest.type = IpcMessageType::CREATE_SUBSCRIBER;
+    subscriberRequest.service = ServiceDescription("Batch", "Subscriber", "Request");
+    IpcPortRequest conditionVariableRequest;
+    conditionVariableRequest.type = IpcMessageType::CREATE_CONDITION_VARIABLE;
+
+    IpcBinaryFrame requests;
+    requests << IPC_BINARY_PROTOCOL_VERSION << m_runtimeName << static_cast<uint16_t>(3U) << publisherRequest
+             << subscriberRequest << conditionVariableRequest;
+    ASSERT_TRUE(requests.encode(m_sendBuffer));
+
+    ASSERT_TRUE(m_runtime->sendRequestToRouDi(m_sendBuffer, m_receiveBuffer));
+
+    IpcBinaryFrame responses;
+    ASSERT_TRUE(responses.decode(m_receiveBuffer));
+    uint16_t version{0U};
+    uint16_t numberOfResponses{0U};
+    IpcPortResponse publisherResponse;
+    IpcPortResponse subscriberResponse;
+    IpcPortResponse conditionVariableResponse;
+    responses >> version >> numberOfResponses >> publisherResponse >> subscriberResponse >> conditionVariableResponse;
+    ASSERT_TRUE(responses.isValid());
+    EXPECT_THAT(version, Eq(IPC_BINARY_PROTOCOL_VERSION));
+    EXPECT_THAT(numberOfResponses, Eq(3U));
+    EXPECT_THAT(publisherResponse.type, Eq(IpcMessageType::CREATE_PUBLISHER_ACK));
+    EXPECT_THAT(subscriberResponse.type, Eq(IpcMessageType::CREATE_SUBSCRIBER_ACK));
+    EXPECT_THAT(conditionVariableResponse.type, Eq(IpcMessageType::CREATE_CONDITION_VARIABLE_ACK));
+
+    auto publisherPort = static_cast<PublisherPortData*>(iox::memory::UntypedRelativePointer::getPtr(
+        iox::memory::segment_id_t{publisherResponse.segmentId}, publisherResponse.offset));
+    ASSERT_THAT(publisherPort, Ne(nullptr));
+    EXPECT_EQ(publisherRequest.service, publisherPort->m_serviceDescription);
+}
+
+TEST_F(PoshRuntime_test, SendBinaryRequestWithTooManyPortRequestsToRouDiReturnsNoResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26684664-0883-4dd2-889a-e6f6984adf0c");
+    IpcBinaryFrame requests;
+    requests << IPC_BINARY_PROTOCOL_VERSION << m_runtimeName
+             << static_cast<uint16_t>(MAX_PORT_REQUESTS_PER_FRAME + 1U);
+    ASSERT_TRUE(requests.encode(m_sendBuffer));
+
+    ASSERT_TRUE(m_runtime->sendRequestToRouDi(m_sendBuffer, m_receiveBuffer));
+
+    IpcBinaryFrame responses;
+    ASSERT_TRUE(responses.decode(m_receiveBuffer));
+    uint16_t version{0U};
+    uint16_t numberOfResponses{1U};
+    responses >> version >> numberOfResponses;
+    ASSERT_TRUE(responses.isValid());
+    EXPECT_THAT(numberOfResponses, Eq(0U));
+}
+
+TEST_F(PoshRuntime_test, CreatePortsOfBatchCreatesAllPortsAndReservesThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "adc36137-f65e-4625-83ac-13d1240083af");
+    // more requests than fit into one message
+    constexpr uint64_t NUMBER_OF_PUBLISHERS{2U * MAX_PORT_REQUESTS_PER_FRAME + 1U};
+    PortCreationBatch<NUMBER_OF_PUBLISHERS + 3U> batch;
+    for (uint64_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        ASSERT_TRUE(batch.addPublisher(
+            ServiceDescription("Batch", "Publisher", IdString_t(TruncateToCapacity, convert::toString(i)))));
+    }
+    ASSERT_TRUE(batch.addSubscriber(ServiceDescription("Batch", "Subscriber", "Port")));
+    ASSERT_TRUE(batch.addClient(ServiceDescription("Batch", "Client", "Port")));
+    ASSERT_TRUE(batch.addServer(ServiceDescription("Batch", "Server", "Port")));
+
+    EXPECT_THAT(m_runtime->createPorts(batch), Eq(NUMBER_OF_PUBLISHERS + 3U));
+    EXPECT_THAT(batch.numberOfReservedPorts(), Eq(NUMBER_OF_PUBLISHERS + 3U));
+}
+
+TEST_F(PoshRuntime_test, AddingToBatchAfterCreatingThePortsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7124cfcd-9333-4832-8e72-55adb46ec8b2");
+    PortCreationBatch<2U> batch;
+    ASSERT_TRUE(batch.addPublisher(ServiceDescription("Batch", "Publisher", "Port")));
+    m_runtime->createPorts(batch);
+
+    EXPECT_FALSE(batch.addSubscriber(ServiceDescription("Batch", "Subscriber", "Port")));
+    EXPECT_THAT(batch.size(), Eq(1U));
+}
+
+TEST_F(PoshRuntime_test, AddingToFullBatchFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29b3b846-417b-4b61-8394-8b6782f762f6");
+    PortCreationBatch<1U> batch;
+    ASSERT_TRUE(batch.addPublisher(ServiceDescription("Batch", "Publisher", "Port")));
+
+    EXPECT_FALSE(batch.addPublisher(ServiceDescription("Batch", "Publisher", "Other")));
+    EXPECT_THAT(batch.size(), Eq(1U));
+    EXPECT_THAT(batch.capacity(), Eq(1U));
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsWithArgumentsOfBatchTakesTheReservedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b674db46-1040-4c3c-a870-83d403782804");
+    const ServiceDescription publisherService("Batch", "Publisher", "Port");
+    const ServiceDescription subscriberService("Batch", "Subscriber", "Port");
+    const ServiceDescription clientService("Batch", "Client", "Port");
+    const ServiceDescription serverService("Batch", "Server", "Port");
+    PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 3U;
+    SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 7U;
+
+    PortCreationBatch<4U> batch;
+    batch.addPublisher(publisherService, publisherOptions);
+    batch.addSubscriber(subscriberService, subscriberOptions);
+    batch.addClient(clientService);
+    batch.addServer(serverService);
+    ASSERT_THAT(m_runtime->createPorts(batch), Eq(4U));
+
+    auto publisherPort = m_runtime->getMiddlewarePublisher(publisherService, publisherOptions);
+    auto subscriberPort = m_runtime->getMiddlewareSubscriber(subscriberService, subscriberOptions);
+    auto clientPort = m_runtime->getMiddlewareClient(clientService);
+    auto serverPort = m_runtime->getMiddlewareServer(serverService);
+
+    EXPECT_THAT(batch.numberOfReservedPorts(), Eq(0U));
+    ASSERT_THAT(publisherPort, Ne(nullptr));
+    EXPECT_EQ(publisherService, publisherPort->m_serviceDescription);
+    EXPECT_EQ(publisherOptions.historyCapacity, publisherPort->m_chunkSenderData.m_historyCapacity);
+    ASSERT_THAT(subscriberPort, Ne(nullptr));
+    EXPECT_EQ(subscriberService, subscriberPort->m_serviceDescription);
+    EXPECT_EQ(subscriberOptions.queueCapacity, subscriberPort->m_chunkReceiverData.m_queue.capacity());
+    ASSERT_THAT(clientPort, Ne(nullptr));
+    EXPECT_EQ(clientService, clientPort->m_serviceDescription);
+    ASSERT_THAT(serverPort, Ne(nullptr));
+    EXPECT_EQ(serverService, serverPort->m_serviceDescription);
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithOtherOptionsThanBatchDoesNotTakeTheReservedPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65469edc-b4b2-4582-aeaa-f97c8d288cdf");
+    const ServiceDescription service("Batch", "Publisher", "Port");
+    PortCreationBatch<1U> batch;
+    batch.addPublisher(service);
+    ASSERT_THAT(m_runtime->createPorts(batch), Eq(1U));
+
+    PublisherOptions publisherOptions;
+    publisherOptions.offerOnCreate = false;
+    auto publisherPort = m_runtime->getMiddlewarePublisher(service, publisherOptions);
+
+    ASSERT_THAT(publisherPort, Ne(nullptr));
+    EXPECT_FALSE(publisherPort->m_offeringRequested);
+    EXPECT_THAT(batch.numberOfReservedPorts(), Eq(1U));
+}
+
+TEST_F(PoshRuntime_test, PortsOfBatchWhichWereNotTakenAreDestroyedWithTheBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "91e4048c-8e05-48fe-84a2-73119b6b6fbf");
+    const ServiceDescription takenService("Batch", "Publisher", "Taken");
+    PublisherPortData* takenPort{nullptr};
+    {
+        PortCreationBatch<2U> batch;
+        batch.addPublisher(takenService);
+        batch.addPublisher(ServiceDescription("Batch", "Publisher", "Reserved"));
+        ASSERT_THAT(m_runtime->createPorts(batch), Eq(2U));
+
+        takenPort = m_runtime->getMiddlewarePublisher(takenService);
+    }
+    ASSERT_THAT(takenPort, Ne(nullptr));
+    EXPECT_FALSE(takenPort->m_toBeDestroyed);
+
+    m_roudiEnv.InterOpWait();
+    ServiceDiscovery serviceDiscovery;
+    std::vector<ServiceDescription> foundServices;
+    serviceDiscovery.findService(
+        IdString_t("Batch"),
+        IdString_t("Publisher"),
+        Wildcard,
+        [&](const ServiceDescription& service) { foundServices.emplace_back(service); },
+        MessagingPattern::PUB_SUB);
+
+    ASSERT_THAT(foundServices.size(), Eq(1U));
+    EXPECT_THAT(foundServices[0U], Eq(takenService));
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewarePublisherIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2cb2e64b-8f21-4049-a35a-dbd7a1d6cbf4");
@@ -383,9 +569,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::cxx::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryChange{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                               iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                               iox::SERVICE_DISCOVERY_CHANGE_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryChange);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -394,6 +584,9 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     internalServices.push_back(iox::roudi::IntrospectionMempoolService);
     internalServices.push_back(iox::roudi::IntrospectionProcessService);
 
+    // Added by RouDi
+    internalServices.push_back(iox::roudi::IntrospectionRuntimeMessageService);
+
     for (auto& service : internalServices)
     {
         const auto publisherPort = m_runtime->getMiddlewarePublisher(
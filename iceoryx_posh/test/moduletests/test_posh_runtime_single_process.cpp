@@ -15,6 +15,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
 #include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
 
@@ -81,4 +83,82 @@ TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessMultipl
     EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__RUNTIME_IS_CREATED_MULTIPLE_TIMES));
 }
 
+TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessWithInProcessRouDiIsSuccess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d0b5a3e-0c59-4a41-9b53-2f6e8a1c7d90");
+    iox::RouDiConfig_t defaultRouDiConfig = iox::RouDiConfig_t().setDefaults();
+    std::unique_ptr<IceOryxRouDiComponents> roudiComponents{new IceOryxRouDiComponents(defaultRouDiConfig)};
+
+    std::unique_ptr<RouDi> roudi{
+        new RouDi(roudiComponents->rouDiMemoryManager,
+                  roudiComponents->portManager,
+                  RouDi::RoudiStartupParameters{
+                      iox::roudi::MonitoringMode::OFF, false, RouDi::RuntimeMessagesThreadStart::NONE})};
+
+    const RuntimeName_t runtimeName{"App"};
+
+    EXPECT_NO_FATAL_FAILURE(
+        { std::unique_ptr<PoshRuntimeSingleProcess> sut{new PoshRuntimeSingleProcess(runtimeName, *roudi)}; });
+}
+
+TEST_F(PoshRuntimeSingleProcess_test, PortsOfInProcessRuntimeAreConnectedWhenTheyAreCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e3c2a1-6f4d-4e8b-a5c9-0d1f2e3a4b5c");
+    iox::RouDiConfig_t defaultRouDiConfig = iox::RouDiConfig_t().setDefaults();
+    std::unique_ptr<IceOryxRouDiComponents> roudiComponents{new IceOryxRouDiComponents(defaultRouDiConfig)};
+
+    std::unique_ptr<RouDi> roudi{
+        new RouDi(roudiComponents->rouDiMemoryManager,
+                  roudiComponents->portManager,
+                  RouDi::RoudiStartupParameters{
+                      iox::roudi::MonitoringMode::OFF, false, RouDi::RuntimeMessagesThreadStart::NONE})};
+
+    PoshRuntimeSingleProcess sut{"App", *roudi};
+
+    const iox::capro::ServiceDescription serviceDescription{"Radar", "FrontLeft", "Object"};
+    iox::popo::Subscriber<uint64_t> subscriber{serviceDescription};
+    iox::popo::Publisher<uint64_t> publisher{serviceDescription};
+
+    // no discovery loop is involved, the publisher is connected to the subscriber by its creation
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    EXPECT_TRUE(publisher.hasSubscribers());
+
+    constexpr uint64_t DATA{73U};
+    ASSERT_FALSE(publisher.publishCopyOf(DATA).has_error());
+    auto sample = subscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(*sample.value(), Eq(DATA));
+}
+
+TEST_F(PoshRuntimeSingleProcess_test, InProcessRuntimeCanBeCreatedAgainAfterItWasDestroyed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1a9f6d2-3c8b-47a5-9e0f-5b6c7d8e9f01");
+    iox::RouDiConfig_t defaultRouDiConfig = iox::RouDiConfig_t().setDefaults();
+    std::unique_ptr<IceOryxRouDiComponents> roudiComponents{new IceOryxRouDiComponents(defaultRouDiConfig)};
+
+    std::unique_ptr<RouDi> roudi{
+        new RouDi(roudiComponents->rouDiMemoryManager,
+                  roudiComponents->portManager,
+                  RouDi::RoudiStartupParameters{
+                      iox::roudi::MonitoringMode::OFF, false, RouDi::RuntimeMessagesThreadStart::NONE})};
+
+    const RuntimeName_t runtimeName{"App"};
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    {
+        PoshRuntimeSingleProcess sut{runtimeName, *roudi};
+        iox::popo::Publisher<uint64_t> publisher{{"Radar", "FrontLeft", "Object"}};
+    }
+    {
+        PoshRuntimeSingleProcess sut{runtimeName, *roudi};
+        iox::popo::Publisher<uint64_t> publisher{{"Radar", "FrontLeft", "Object"}};
+        EXPECT_TRUE(publisher.isOffered());
+    }
+
+    EXPECT_FALSE(detectedError.has_value());
+}
+
 } // namespace
@@ -0,0 +1,308 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_transfer_tracker.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/internal/roudi/chunk_garbage_collector.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::mepoo::ShmSafeUnmanagedChunk;
+using iox::popo::ChunkTransferTracker;
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES = 1U;
+    static constexpr uint64_t MAX_HISTORY_CAPACITY = 1U;
+};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = 1U;
+};
+
+class ChunkGarbageCollector_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        iox::mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        m_memoryManager.configureMemoryManager(mempoolConfig, m_allocator, m_allocator);
+        ASSERT_TRUE(m_sut.addMemoryManager(m_memoryManager));
+    }
+
+    ShmSafeUnmanagedChunk getChunk()
+    {
+        auto chunkSettings = iox::mepoo::ChunkSettings::create(CHUNK_SIZE / 2U).value();
+        return ShmSafeUnmanagedChunk(m_memoryManager.getChunk(chunkSettings).value());
+    }
+
+    iox::cxx::optional<uint64_t> collect(const std::vector<ShmSafeUnmanagedChunk>& referencedChunks = {})
+    {
+        m_sut.beginCollection();
+        m_sut.recordTransfers(m_transferTracker);
+        for (const auto& chunk : referencedChunks)
+        {
+            m_sut.markReferenced(chunk);
+        }
+        m_sut.endMarking();
+        m_sut.recordTransfers(m_transferTracker);
+        return m_sut.finishCollection();
+    }
+
+    uint32_t usedChunks()
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    uint32_t reclaimedChunks()
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_reclaimedChunks;
+    }
+
+    static constexpr uint32_t CHUNK_SIZE{128U};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
+    static constexpr uint64_t MEMORY_SIZE{100000U};
+
+    // the management memory of RouDi is zero initialized shared memory
+    std::unique_ptr<uint8_t[]> m_memory{new uint8_t[MEMORY_SIZE]()};
+    iox::posix::Allocator m_allocator{m_memory.get(), MEMORY_SIZE};
+    iox::mepoo::MemoryManager m_memoryManager;
+    ChunkTransferTracker m_transferTracker;
+    ChunkGarbageCollector m_sut;
+};
+
+constexpr uint32_t ChunkGarbageCollector_test::CHUNK_SIZE;
+constexpr uint32_t ChunkGarbageCollector_test::NUMBER_OF_CHUNKS;
+constexpr uint64_t ChunkGarbageCollector_test::MEMORY_SIZE;
+
+TEST_F(ChunkGarbageCollector_test, LeakedChunkIsReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e709e919-c630-44b3-a37b-0c46d666342d");
+    // the reference is dropped without releasing the chunk, like it happens when a process terminates
+    getChunk();
+    ASSERT_THAT(usedChunks(), Eq(1U));
+
+    auto numberOfReclaimedChunks = collect();
+    ASSERT_TRUE(numberOfReclaimedChunks.has_value());
+    EXPECT_THAT(numberOfReclaimedChunks.value(), Eq(1U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(reclaimedChunks(), Eq(1U));
+}
+
+TEST_F(ChunkGarbageCollector_test, ReferencedChunkIsNotReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9583784a-1bf3-47ac-91bd-4d0f65f06a58");
+    std::vector<ShmSafeUnmanagedChunk> chunks{getChunk(), getChunk()};
+
+    EXPECT_THAT(collect(chunks), Eq(iox::cxx::optional<uint64_t>(0U)));
+    EXPECT_THAT(collect(chunks), Eq(iox::cxx::optional<uint64_t>(0U)));
+
+    EXPECT_THAT(usedChunks(), Eq(2U));
+    EXPECT_THAT(reclaimedChunks(), Eq(0U));
+    for (auto& chunk : chunks)
+    {
+        chunk.releaseToSharedChunk();
+    }
+}
+
+TEST_F(ChunkGarbageCollector_test, CollectionIsDiscardedWhenATransferIsInProgress)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46c5cd26-25f4-4530-a695-0969a5272a47");
+    std::vector<ShmSafeUnmanagedChunk> chunks{getChunk()};
+
+    {
+        // e.g. the chunk was taken from the queue but is not yet stored in the used chunk list
+        ChunkTransferTracker::Transfer transfer(m_transferTracker);
+        EXPECT_FALSE(collect().has_value());
+    }
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    EXPECT_THAT(reclaimedChunks(), Eq(0U));
+
+    EXPECT_THAT(collect(chunks), Eq(iox::cxx::optional<uint64_t>(0U)));
+    chunks.front().releaseToSharedChunk();
+}
+
+TEST_F(ChunkGarbageCollector_test, CollectionIsDiscardedWhenATransferIsStartedDuringTheMarking)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e02ef11d-1192-41d3-b38f-bf35f9cc1021");
+    auto chunk = getChunk();
+
+    m_sut.beginCollection();
+    m_sut.recordTransfers(m_transferTracker);
+    {
+        // the chunk was moved to a port which was already inspected
+        ChunkTransferTracker::Transfer transfer(m_transferTracker);
+    }
+    m_sut.endMarking();
+    m_sut.recordTransfers(m_transferTracker);
+    EXPECT_FALSE(m_sut.finishCollection().has_value());
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    EXPECT_THAT(reclaimedChunks(), Eq(0U));
+    chunk.releaseToSharedChunk();
+}
+
+TEST_F(ChunkGarbageCollector_test, ChunkObtainedAfterTheTransfersWereRecordedIsNotReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d2b8e41-7c3a-4f96-a0e8-1b6f9d4c2a73");
+    // the released chunk leaves a ChunkManagement behind which is used again for the new chunk
+    getChunk().releaseToSharedChunk();
+
+    m_sut.beginCollection();
+    m_sut.recordTransfers(m_transferTracker);
+    m_sut.endMarking();
+    m_sut.recordTransfers(m_transferTracker);
+    // a publisher allocates a chunk after its port was inspected
+    auto chunk = getChunk();
+    EXPECT_THAT(m_sut.finishCollection(), Eq(iox::cxx::optional<uint64_t>(0U)));
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    EXPECT_THAT(reclaimedChunks(), Eq(0U));
+    chunk.releaseToSharedChunk();
+}
+
+TEST_F(ChunkGarbageCollector_test, ChunkObtainedDuringACollectionIsReclaimedByTheNextCollectionWhenItIsLeaked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8f3c6d2-0e7b-4b19-8d54-3c9e2f7a1b60");
+    m_sut.beginCollection();
+    m_sut.recordTransfers(m_transferTracker);
+    m_sut.endMarking();
+    m_sut.recordTransfers(m_transferTracker);
+    getChunk();
+    EXPECT_THAT(m_sut.finishCollection(), Eq(iox::cxx::optional<uint64_t>(0U)));
+
+    EXPECT_THAT(collect(), Eq(iox::cxx::optional<uint64_t>(1U)));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(reclaimedChunks(), Eq(1U));
+}
+
+TEST_F(ChunkGarbageCollector_test, ReleasedChunkIsNotReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c17a9039-29a3-4622-9252-2ac9c1585128");
+    std::vector<ShmSafeUnmanagedChunk> releasedChunks{getChunk()};
+    releasedChunks.front().releaseToSharedChunk();
+    ASSERT_THAT(usedChunks(), Eq(0U));
+
+    EXPECT_THAT(collect(), Eq(iox::cxx::optional<uint64_t>(0U)));
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(reclaimedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkGarbageCollector_test, OnlyTheUnreferencedChunkIsReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e6ddc69-2d61-431f-a046-04081b69cdaf");
+    auto referencedChunk = getChunk();
+    getChunk();
+
+    m_sut.beginCollection();
+    m_sut.markReferenced(referencedChunk);
+    m_sut.markReferenced(ShmSafeUnmanagedChunk());
+    m_sut.endMarking();
+    EXPECT_THAT(m_sut.finishCollection(), Eq(iox::cxx::optional<uint64_t>(1U)));
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    referencedChunk.releaseToSharedChunk();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkGarbageCollector_test, ChunkOfPublisherBlockedInDeliveryIsNotReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee2fd5c5-5e88-4a78-8cdf-306a60cbe874");
+    using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using ChunkReceiverData_t = iox::popo::ChunkReceiverData<1U, ChunkQueueData_t>;
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<ChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t = iox::popo::ChunkSenderData<2U, ChunkDistributorData_t>;
+
+    ChunkSenderData_t senderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER};
+    ChunkReceiverData_t receiverData{iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                     iox::popo::QueueFullPolicy::BLOCK_PRODUCER};
+    iox::popo::ChunkSender<ChunkSenderData_t> sender(&senderData);
+    iox::popo::ChunkReceiver<ChunkReceiverData_t> receiver(&receiverData);
+    ASSERT_FALSE(sender.tryAddQueue(&receiverData).has_error());
+
+    constexpr uint64_t DATA{0x1CE0};
+    auto allocate = [&](const uint64_t data) {
+        auto chunkHeader = sender
+                               .tryAllocate(iox::popo::UniquePortId(),
+                                            sizeof(uint64_t),
+                                            alignof(uint64_t),
+                                            iox::CHUNK_NO_USER_HEADER_SIZE,
+                                            iox::CHUNK_NO_USER_HEADER_ALIGNMENT)
+                               .value();
+        *static_cast<uint64_t*>(chunkHeader->userPayload()) = data;
+        return chunkHeader;
+    };
+
+    // the first chunk fills the queue, the publisher is blocked in the delivery of the second one
+    sender.send(allocate(0U));
+    auto blockedChunkHeader = allocate(DATA);
+    std::thread publisher([&] { sender.send(blockedChunkHeader); });
+    while (senderData.m_transferTracker.getNumberOfStartedTransfers().has_value())
+    {
+        std::this_thread::yield();
+    }
+
+    m_sut.beginCollection();
+    m_sut.recordTransfers(senderData.m_transferTracker);
+    m_sut.recordTransfers(receiverData.m_transferTracker);
+    m_sut.markChunksOfSender(senderData);
+    m_sut.markChunksOfReceiver(receiverData);
+    m_sut.endMarking();
+    m_sut.recordTransfers(senderData.m_transferTracker);
+    m_sut.recordTransfers(receiverData.m_transferTracker);
+    EXPECT_FALSE(m_sut.finishCollection().has_value());
+    EXPECT_THAT(usedChunks(), Eq(2U));
+    EXPECT_THAT(reclaimedChunks(), Eq(0U));
+
+    auto firstChunkHeader = receiver.tryGet();
+    ASSERT_FALSE(firstChunkHeader.has_error());
+    receiver.release(firstChunkHeader.value());
+    publisher.join();
+
+    auto deliveredChunkHeader = receiver.tryGet();
+    ASSERT_FALSE(deliveredChunkHeader.has_error());
+    EXPECT_THAT(*static_cast<const uint64_t*>(deliveredChunkHeader.value()->userPayload()), Eq(DATA));
+    receiver.release(deliveredChunkHeader.value());
+    sender.releaseAll();
+    receiver.releaseAll();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(reclaimedChunks(), Eq(0U));
+}
+
+} // namespace
@@ -37,7 +37,8 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
     return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.logLevel == rhs.logLevel)
            && (lhs.compatibilityCheckLevel == rhs.compatibilityCheckLevel)
            && (lhs.processKillDelay == rhs.processKillDelay) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
-           && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath);
+           && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath)
+           && (lhs.runtimeMessagesThreadCount == rhs.runtimeMessagesThreadCount);
 }
 } // namespace config
 } // namespace iox
@@ -346,6 +347,84 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToProgrammNotRunning)
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessagesThreadsLongOptionLeadsToCorrectThreadCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93ea98b9-e31e-4512-9c52-e2ddebde4043");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-messages-threads";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().runtimeMessagesThreadCount, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessagesThreadsShortOptionLeadsToCorrectThreadCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db3a750e-bdfb-4660-b505-08b3f0b7c9d8");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-t";
+    char value[] = "2";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().runtimeMessagesThreadCount, 2U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, ZeroRuntimeMessagesThreadsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97ea4acf-9d34-4f8d-ade2-f02efc33664f");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-messages-threads";
+    char value[] = "0";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, OutOfBoundsRuntimeMessagesThreadsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "faef9180-c899-4e22-83a4-64bb4d4285f8");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-messages-threads";
+    char value[] = "17"; // MAX_RUNTIME_MESSAGES_THREAD_COUNT + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
@@ -55,6 +55,50 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParseDefaultConfigIsSuccessful)
     EXPECT_FALSE(result.has_error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsePortsSectionSetsTheNumberOfPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d5093b5-e106-405f-ab90-f40059ec9761");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_ports.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value().m_maxNumberOfPublishers, Eq(42U));
+    EXPECT_THAT(result.value().m_maxNumberOfSubscribers, Eq(73U));
+    EXPECT_THAT(result.value().m_maxNumberOfClients, Eq(13U));
+    EXPECT_THAT(result.value().m_maxNumberOfServers, Eq(iox::MAX_SERVERS));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConnectionSectionsSetsTheStaticTopology)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "123fe5ad-88ca-4f13-8946-e25f1798ac64");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_static_topology.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& staticConnections = result.value().m_staticConnections;
+    ASSERT_THAT(staticConnections.size(), Eq(2U));
+
+    EXPECT_THAT(staticConnections[0].m_service, Eq(iox::capro::ServiceDescription("Radar", "FrontLeft", "Object")));
+    EXPECT_THAT(staticConnections[0].m_publisherRuntimeName, Eq(iox::RuntimeName_t("radar")));
+    ASSERT_THAT(staticConnections[0].m_subscriberRuntimeNames.size(), Eq(2U));
+    EXPECT_THAT(staticConnections[0].m_subscriberRuntimeNames[0], Eq(iox::RuntimeName_t("fusion")));
+    EXPECT_THAT(staticConnections[0].m_subscriberRuntimeNames[1], Eq(iox::RuntimeName_t("logger")));
+    EXPECT_THAT(staticConnections[0].m_historyCapacity, Eq(1U));
+    EXPECT_THAT(staticConnections[0].m_queueCapacity, Eq(4U));
+
+    EXPECT_THAT(staticConnections[1].m_service, Eq(iox::capro::ServiceDescription("Fusion", "Front", "Objects")));
+    EXPECT_THAT(staticConnections[1].m_publisherRuntimeName, Eq(iox::RuntimeName_t("fusion")));
+    EXPECT_TRUE(staticConnections[1].m_subscriberRuntimeNames.empty());
+    EXPECT_THAT(staticConnections[1].m_historyCapacity, Eq(0U));
+    EXPECT_THAT(staticConnections[1].m_queueCapacity, Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParseAllMalformedInputConfigFiles,
     RoudiConfigTomlFileProvider_test,
@@ -74,6 +118,16 @@ INSTANTIATE_TEST_SUITE_P(
                                  "roudi_config_error_mempool_without_chunk_size.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  "roudi_config_error_mempool_without_chunk_count.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_PORTS_EXCEEDED,
+                                 "roudi_config_error_max_ports_exceeded.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::STATIC_CONNECTION_WITHOUT_SERVICE_DESCRIPTION,
+                                 "roudi_config_error_static_connection_without_service_description.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::STATIC_CONNECTION_WITH_INVALID_RUNTIME_NAME,
+                                 "roudi_config_error_static_connection_with_invalid_runtime_name.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_STATIC_CONNECTIONS_EXCEEDED,
+                                 "roudi_config_error_max_static_connections_exceeded.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::STATIC_CONNECTION_WITH_TOO_MANY_SUBSCRIBERS,
+                                 "roudi_config_error_static_connection_with_too_many_subscribers.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  "toml_parser_exception.toml"}));
 
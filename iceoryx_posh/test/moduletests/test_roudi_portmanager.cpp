@@ -57,6 +57,92 @@ TEST_F(PortManager_test, DoDiscoveryWithSingleShotPublisherFirst)
     EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, WaitForDiscoveryRequestTimesOutWithoutStateChangeOfPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c17210d-7704-42c7-a3ea-ccb7c9b72662");
+    m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero());
+
+    EXPECT_FALSE(m_portManager->waitForDiscoveryRequest(iox::units::Duration::fromMilliseconds(1U)));
+}
+
+TEST_F(PortManager_test, OfferAndStopOfferOfPublisherRequestDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd0c3fe9-073f-4399-bfd9-21a210cf8eb1");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero());
+
+    publisher.offer();
+    EXPECT_TRUE(m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero()));
+
+    publisher.stopOffer();
+    EXPECT_TRUE(m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero()));
+}
+
+TEST_F(PortManager_test, SubscribeAndUnsubscribeOfSubscriberRequestDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ea1a00b7-2e6f-4d7c-9e2b-67268f3c3d35");
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_TRUE(subscriber);
+    m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero());
+
+    subscriber.subscribe();
+    EXPECT_TRUE(m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero()));
+
+    subscriber.unsubscribe();
+    EXPECT_TRUE(m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero()));
+}
+
+TEST_F(PortManager_test, RequestDiscoveryWakesUpWaitForDiscoveryRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff8b3ecf-3c40-463e-984b-dcd5780bd05c");
+    m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero());
+
+    m_portManager->requestDiscovery();
+
+    EXPECT_TRUE(m_portManager->waitForDiscoveryRequest(iox::units::Duration::zero()));
+}
+
+TEST_F(PortManager_test, DoDiscoveryConnectsPortsWhenDirtyPortListOverflowed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0b8a3e-6f0e-4a1c-9d57-3b2e8f4c61a9");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    // fill the dirty port list with ports which do not exist, the state changes below do not fit into the list anymore
+    auto& dirtyPortList = m_roudiMemoryManager->portPool().value()->getDirtyPortList();
+    for (uint64_t i = 0U; i < iox::popo::DirtyPortList::CAPACITY; ++i)
+    {
+        dirtyPortList.push({iox::popo::DirtyPortKind::PUBLISHER, std::numeric_limits<uint32_t>::max()});
+    }
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_TRUE(subscriber);
+
+    publisher.offer();
+    subscriber.subscribe();
+    m_portManager->doDiscovery();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, DoDiscoveryWithSingleShotSubscriberFirst)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bef1fc7f-3661-4dcc-98dd-fbf951ed275c");
@@ -735,6 +821,39 @@ TEST_F(PortManager_test, DeleteNodePortfromMaximumNumberandAddOneIsSuccessful)
 }
 
 
+TEST_F(PortManager_test, DeletePortsOfProcessDeletesOnlyTheDataOfThisProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67ed9656-ad97-4eba-8d15-f0d9e09209c8");
+    const iox::RuntimeName_t runtimeToDelete{"Rincewind"};
+    const iox::RuntimeName_t runtimeToKeep{"Twoflower"};
+    auto portPool = m_roudiMemoryManager->portPool().value();
+
+    for (const auto& runtimeName : {runtimeToDelete, runtimeToKeep})
+    {
+        ASSERT_FALSE(m_portManager->acquireNodeData(runtimeName, "node").has_error());
+        ASSERT_FALSE(m_portManager->acquireConditionVariableData(runtimeName).has_error());
+        ASSERT_FALSE(m_portManager->acquireHeartbeat(runtimeName).has_error());
+        ASSERT_THAT(m_portManager->acquireInterfacePortData(iox::capro::Interfaces::INTERNAL, runtimeName),
+                    Ne(nullptr));
+    }
+
+    m_portManager->deletePortsOfProcess(runtimeToDelete);
+
+    auto nodes = portPool->getNodeDataList();
+    ASSERT_THAT(nodes.size(), Eq(1U));
+    EXPECT_THAT(nodes[0]->m_runtimeName, Eq(runtimeToKeep));
+    auto conditionVariables = portPool->getConditionVariableDataList();
+    ASSERT_THAT(conditionVariables.size(), Eq(1U));
+    EXPECT_THAT(conditionVariables[0]->m_runtimeName, Eq(runtimeToKeep));
+    auto heartbeats = portPool->getHeartbeatList();
+    ASSERT_THAT(heartbeats.size(), Eq(1U));
+    EXPECT_THAT(heartbeats[0]->m_runtimeName, Eq(runtimeToKeep));
+    auto interfaces = portPool->getInterfacePortDataList();
+    ASSERT_THAT(interfaces.size(), Eq(1U));
+    EXPECT_THAT(interfaces[0]->m_runtimeName, Eq(runtimeToKeep));
+}
+
+
 TEST_F(PortManager_test, AcquireNodeDataAfterDestroyingPreviouslyAcquiredOnesIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c2d64fbb-6aa5-42bc-aaea-3d8776da70ed");
@@ -1000,4 +1119,185 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+iox::config::RouDiConfig::StaticConnections_t createStaticTopology(const iox::capro::ServiceDescription& service)
+{
+    iox::config::StaticConnection connection;
+    connection.m_service = service;
+    connection.m_publisherRuntimeName = "radar";
+    connection.m_subscriberRuntimeNames.emplace_back("fusion");
+    connection.m_subscriberRuntimeNames.emplace_back("logger");
+
+    iox::config::RouDiConfig::StaticConnections_t staticConnections;
+    staticConnections.push_back(connection);
+    return staticConnections;
+}
+
+TEST_F(PortManager_test, PortsOfStaticTopologyAreConnectedWhenTheRuntimesTakeThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34174aa6-37c0-4c19-afed-6e74cf79063d");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(service, {}, "radar", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData = m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value();
+
+    // no discovery run is required, the ports were connected before the runtimes requested them
+    PublisherPortUser publisher(publisherData);
+    SubscriberPortUser subscriber(subscriberData);
+    EXPECT_TRUE(publisher.isOffered());
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, PortOfStaticTopologyIsTakenOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1fd5c5f-a0a9-47fb-b6ab-ff8accf81912");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+
+    auto subscriberData1 = m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value();
+    auto subscriberData2 = m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value();
+
+    EXPECT_THAT(subscriberData1, Ne(subscriberData2));
+    EXPECT_THAT(SubscriberPortUser(subscriberData2).getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, PortOfStaticTopologyIsNotTakenByOtherRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "03abddc6-0c06-4009-8643-b045c2443700");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+
+    auto otherSubscriberData =
+        m_portManager->acquireSubscriberPortData(service, {}, "otherApp", PortConfigInfo()).value();
+    auto subscriberData = m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value();
+
+    EXPECT_THAT(otherSubscriberData, Ne(subscriberData));
+    EXPECT_THAT(otherSubscriberData->m_runtimeName, Eq(iox::RuntimeName_t("otherApp")));
+}
+
+TEST_F(PortManager_test, PortsOfStaticTopologyAreRestoredWhenTheRuntimeTerminates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58d3f83a-6c8c-4d1b-b0df-37a2adf6fe3c");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(service, {}, "radar", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    IOX_DISCARD_RESULT(m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value());
+
+    m_portManager->deletePortsOfProcess("fusion");
+
+    auto subscriberData = m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value();
+
+    EXPECT_TRUE(PublisherPortUser(publisherData).hasSubscribers());
+    EXPECT_THAT(SubscriberPortUser(subscriberData).getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, StaticPublisherPortIsNotOfferedWhenTheRuntimeDoesNotOfferOnCreate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5137d46e-066d-4dd0-8851-ae6ecd022164");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+
+    PublisherOptions publisherOptions;
+    publisherOptions.offerOnCreate = false;
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                service, publisherOptions, "radar", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+
+    PublisherPortUser publisher(publisherData);
+    EXPECT_FALSE(publisher.isOffered());
+    EXPECT_FALSE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, StaticPublisherPortInOtherSegmentIsReplacedByNewPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8d59694-b836-412e-abf3-6201108552f6");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+    auto otherMemoryManager = m_roudiMemoryManager->introspectionMemoryManager().value();
+
+    auto publisherData =
+        m_portManager->acquirePublisherPortData(service, {}, "radar", otherMemoryManager, PortConfigInfo()).value();
+    auto subscriberData = m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value();
+
+    EXPECT_THAT(publisherData->m_chunkSenderData.m_memoryMgr.get(), Eq(otherMemoryManager));
+    EXPECT_TRUE(PublisherPortUser(publisherData).hasSubscribers());
+    EXPECT_THAT(SubscriberPortUser(subscriberData).getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, StaticPublisherPortWithOtherOptionsIsReplacedByNewPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "761aad81-24af-46e7-8701-61c3576b80f0");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+
+    PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 3U;
+    publisherOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                service, publisherOptions, "radar", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData = m_portManager->acquireSubscriberPortData(service, {}, "fusion", PortConfigInfo()).value();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(publisherData->m_options, Eq(publisherOptions));
+    EXPECT_THAT(m_roudiMemoryManager->portPool().value()->getPublisherPortDataList().size(), Eq(1U));
+    EXPECT_TRUE(PublisherPortUser(publisherData).hasSubscribers());
+    EXPECT_THAT(SubscriberPortUser(subscriberData).getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, StaticSubscriberPortWithOtherOptionsIsReplacedByNewPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "375dadff-12e3-4efb-b86e-6814c3c75aed");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+
+    SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 2U;
+    subscriberOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    subscriberOptions.nodeName = "fusionNode";
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData(service, subscriberOptions, "fusion", PortConfigInfo()).value();
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(service, {}, "radar", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(subscriberData->m_options, Eq(subscriberOptions));
+    EXPECT_THAT(subscriberData->m_chunkReceiverData.m_queue.capacity(), Eq(2U));
+    // the static subscriber port of "logger" remains, the one of "fusion" was destroyed
+    EXPECT_THAT(m_roudiMemoryManager->portPool().value()->getSubscriberPortDataList().size(), Eq(2U));
+    EXPECT_TRUE(PublisherPortUser(publisherData).hasSubscribers());
+    EXPECT_THAT(SubscriberPortUser(subscriberData).getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, StaticSubscriberPortWithOtherPortConfigInfoIsReplacedByNewPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b485496-9cd7-4c45-8770-587f8f9a1eef");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    m_portManager->createStaticTopology(createStaticTopology(service));
+    constexpr uint32_t DEVICE_ID{13U};
+
+    auto subscriberData =
+        m_portManager
+            ->acquireSubscriberPortData(
+                service, {}, "fusion", PortConfigInfo(PortConfigInfo::DEFAULT_PORT_TYPE, DEVICE_ID))
+            .value();
+
+    EXPECT_THAT(subscriberData->m_chunkReceiverData.m_memoryInfo.deviceId, Eq(DEVICE_ID));
+    EXPECT_THAT(m_roudiMemoryManager->portPool().value()->getSubscriberPortDataList().size(), Eq(2U));
+}
+
 } // namespace iox_test_roudi_portmanager
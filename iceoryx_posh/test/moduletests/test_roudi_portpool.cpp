@@ -21,8 +21,11 @@
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/port_pool.hpp"
+#include "iceoryx_posh/roudi/roudi_config.hpp"
 #include "test.hpp"
 
+#include <memory>
+
 namespace
 {
 using namespace ::testing;
@@ -82,7 +85,12 @@ class PortPool_test : public Test
     }
 
   public:
-    roudi::PortPoolData m_portPoolData;
+    config::RouDiConfig m_config;
+    // the port data of RouDi is allocated from zero initialized shared memory
+    std::unique_ptr<uint8_t[]> m_arenaMemory{
+        new uint8_t[roudi::PortPoolData::requiredArenaMemorySize(m_config)]()};
+    posix::Allocator m_arenaAllocator{m_arenaMemory.get(), roudi::PortPoolData::requiredArenaMemorySize(m_config)};
+    roudi::PortPoolData m_portPoolData{m_config, m_arenaAllocator};
     roudi::PortPool sut{m_portPoolData};
 
     ServiceDescription m_serviceDescription{"service1", "instance1", "event1"};
@@ -270,6 +278,64 @@ TEST_F(PortPool_test, AddPublisherPortWhenPublisherListOverflowsReturnsError)
     EXPECT_EQ(error, PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW);
 }
 
+TEST_F(PortPool_test, AddPublisherPortWhenConfiguredNumberOfPublishersIsExceededReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7063954d-eb53-4ce0-9543-d5893c8b15f8");
+    constexpr uint32_t NUMBER_OF_PUBLISHERS{2U};
+    config::RouDiConfig config;
+    config.m_maxNumberOfPublishers = NUMBER_OF_PUBLISHERS;
+    const auto arenaMemorySize = roudi::PortPoolData::requiredArenaMemorySize(config);
+    EXPECT_THAT(arenaMemorySize, Lt(roudi::PortPoolData::requiredArenaMemorySize(m_config)));
+
+    std::unique_ptr<uint8_t[]> arenaMemory{new uint8_t[arenaMemorySize]()};
+    posix::Allocator arenaAllocator{arenaMemory.get(), arenaMemorySize};
+    roudi::PortPoolData portPoolData{config, arenaAllocator};
+    roudi::PortPool portPool{portPoolData};
+
+    for (uint32_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        RuntimeName_t applicationName = {cxx::TruncateToCapacity, "AppName" + cxx::convert::toString(i)};
+        EXPECT_FALSE(portPool
+                         .addPublisherPort(
+                             m_serviceDescription, &m_memoryManager, applicationName, m_publisherOptions, m_memoryInfo)
+                         .has_error());
+    }
+
+    auto errorHandlerCalled{false};
+    PoshError error{PoshError::NO_ERROR};
+    auto errorHandlerGuard =
+        ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>([&](const auto e, const ErrorLevel) {
+            error = e;
+            errorHandlerCalled = true;
+        });
+
+    auto publisherPort = portPool.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+
+    ASSERT_TRUE(publisherPort.has_error());
+    EXPECT_THAT(publisherPort.get_error(), Eq(roudi::PortPoolError::PUBLISHER_PORT_LIST_FULL));
+    ASSERT_TRUE(errorHandlerCalled);
+    EXPECT_EQ(error, PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW);
+}
+
+TEST_F(PortPool_test, RemovedPublisherPortFreesItsPositionForTheNextPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "897a90e7-044f-42b9-b876-51ee981a4179");
+    auto firstPublisherPort = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    ASSERT_FALSE(firstPublisherPort.has_error());
+    auto* firstPortData = firstPublisherPort.value();
+
+    sut.removePublisherPort(firstPortData);
+    EXPECT_THAT(sut.getPublisherPortDataList().size(), Eq(0U));
+
+    auto secondPublisherPort = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    ASSERT_FALSE(secondPublisherPort.has_error());
+    EXPECT_THAT(secondPublisherPort.value(), Eq(firstPortData));
+    EXPECT_THAT(sut.getPublisherPortDataList().size(), Eq(1U));
+}
+
 TEST_F(PortPool_test, GetPublisherPortDataListIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1650a6e0-8079-4ac4-ad03-723a7fc70217");
@@ -844,6 +910,134 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
     ASSERT_EQ(condtionalVariableData.size(), 0U);
 }
 
+TEST_F(PortPool_test, AddedPortsReferenceTheDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f5f361e-8a6e-4e82-9dd7-c0c8aed6faf5");
+    auto discoveryConditionVariableData = &sut.getDiscoveryConditionVariableData();
+
+    auto publisherPort = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    ASSERT_FALSE(publisherPort.has_error());
+    EXPECT_THAT(publisherPort.value()->m_discoveryConditionVariableDataPtr.get(), Eq(discoveryConditionVariableData));
+
+    auto subscriberPort =
+        sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions, m_memoryInfo);
+    ASSERT_FALSE(subscriberPort.has_error());
+    EXPECT_THAT(subscriberPort.value()->m_discoveryConditionVariableDataPtr.get(), Eq(discoveryConditionVariableData));
+
+    auto clientPort =
+        sut.addClientPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_clientOptions, m_memoryInfo);
+    ASSERT_FALSE(clientPort.has_error());
+    EXPECT_THAT(clientPort.value()->m_discoveryConditionVariableDataPtr.get(), Eq(discoveryConditionVariableData));
+
+    auto serverPort =
+        sut.addServerPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_serverOptions, m_memoryInfo);
+    ASSERT_FALSE(serverPort.has_error());
+    EXPECT_THAT(serverPort.value()->m_discoveryConditionVariableDataPtr.get(), Eq(discoveryConditionVariableData));
+}
+
 // END ConditionVariable tests
 
+// BEGIN Heartbeat tests
+
+TEST_F(PortPool_test, AddHeartbeatIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e99500e1-a937-4bab-8dbb-e3ddaa87af02");
+    auto heartbeat = sut.addHeartbeat(m_applicationName);
+
+    ASSERT_THAT(heartbeat.has_error(), Eq(false));
+    EXPECT_EQ(heartbeat.value()->m_runtimeName, m_applicationName);
+    EXPECT_EQ(heartbeat.value()->counter(), 0U);
+}
+
+TEST_F(PortPool_test, AddHeartbeatWhenContainerIsFullReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d63c2c98-51a2-4a77-847d-cce213e994ef");
+    for (uint32_t i = 0U; i < MAX_PROCESS_NUMBER; ++i)
+    {
+        EXPECT_FALSE(sut.addHeartbeat(m_applicationName).has_error());
+    }
+
+    auto errorHandlerCalled{false};
+    PoshError error{PoshError::NO_ERROR};
+    auto errorHandlerGuard =
+        ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>([&](const auto e, const ErrorLevel) {
+            error = e;
+            errorHandlerCalled = true;
+        });
+    auto heartbeat = sut.addHeartbeat(m_applicationName);
+
+    ASSERT_TRUE(heartbeat.has_error());
+    EXPECT_EQ(heartbeat.get_error(), iox::roudi::PortPoolError::HEARTBEAT_LIST_FULL);
+    ASSERT_TRUE(errorHandlerCalled);
+    EXPECT_EQ(error, PoshError::PORT_POOL__HEARTBEAT_LIST_OVERFLOW);
+}
+
+TEST_F(PortPool_test, RemoveHeartbeatIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a283a12e-866c-4da7-b921-a60f2bf6e5d0");
+    auto heartbeat = sut.addHeartbeat(m_applicationName);
+    ASSERT_FALSE(heartbeat.has_error());
+    ASSERT_EQ(sut.getHeartbeatList().size(), 1U);
+
+    sut.removeHeartbeat(heartbeat.value());
+
+    EXPECT_EQ(sut.getHeartbeatList().size(), 0U);
+}
+
+// END Heartbeat tests
+
+// BEGIN CommandChannel tests
+
+TEST_F(PortPool_test, AddCommandChannelOpensChannelForRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff815d5f-c4db-4d6c-a25c-d73ba949835a");
+    auto commandChannel = sut.addCommandChannel(m_applicationName);
+
+    ASSERT_FALSE(commandChannel.has_error());
+    EXPECT_TRUE(commandChannel.value()->isOpen());
+    EXPECT_EQ(commandChannel.value()->runtimeName(), m_applicationName);
+    EXPECT_EQ(sut.getCommandChannel(0U), commandChannel.value());
+}
+
+TEST_F(PortPool_test, AddCommandChannelWhenAllChannelsAreOpenReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1695ffb7-f111-4964-aea3-27c5f2188e8f");
+    for (uint32_t i = 0U; i < MAX_PROCESS_NUMBER; ++i)
+    {
+        EXPECT_FALSE(sut.addCommandChannel(m_applicationName).has_error());
+    }
+
+    auto errorHandlerCalled{false};
+    PoshError error{PoshError::NO_ERROR};
+    auto errorHandlerGuard =
+        ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>([&](const auto e, const ErrorLevel) {
+            error = e;
+            errorHandlerCalled = true;
+        });
+    auto commandChannel = sut.addCommandChannel(m_applicationName);
+
+    ASSERT_TRUE(commandChannel.has_error());
+    EXPECT_EQ(commandChannel.get_error(), iox::roudi::PortPoolError::COMMAND_CHANNEL_LIST_FULL);
+    ASSERT_TRUE(errorHandlerCalled);
+    EXPECT_EQ(error, PoshError::PORT_POOL__COMMAND_CHANNEL_LIST_OVERFLOW);
+}
+
+TEST_F(PortPool_test, RemovedCommandChannelIsReusedForNextRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "360ebbb9-f8a8-4ea3-9946-c22c596e1814");
+    auto commandChannel = sut.addCommandChannel(m_applicationName);
+    ASSERT_FALSE(commandChannel.has_error());
+
+    sut.removeCommandChannel(commandChannel.value());
+    EXPECT_FALSE(commandChannel.value()->isOpen());
+
+    auto nextCommandChannel = sut.addCommandChannel("nextApp");
+    ASSERT_FALSE(nextCommandChannel.has_error());
+    EXPECT_EQ(nextCommandChannel.value(), commandChannel.value());
+    EXPECT_EQ(nextCommandChannel.value()->runtimeName(), RuntimeName_t("nextApp"));
+}
+
+// END CommandChannel tests
+
 } // namespace
@@ -119,4 +119,46 @@ TEST_F(Process_test, TimeStamp)
     EXPECT_THAT(roudiproc.getTimestamp(), Eq(timestmp));
 }
 
+TEST_F(Process_test, TimeStampIsUpdatedWhenHeartbeatChanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f61d6675-1aa1-41e7-916e-3c0d4c0c1cf6");
+    Heartbeat heartbeat{processname};
+    Process roudiproc(processname, pid, user, isMonitored, sessionId, &heartbeat);
+    auto initialTimestamp = roudiproc.getTimestamp();
+    auto laterTimestamp = initialTimestamp + std::chrono::milliseconds(100);
+
+    heartbeat.beat();
+    roudiproc.updateTimestampFromHeartbeat(laterTimestamp);
+
+    EXPECT_THAT(roudiproc.getHeartbeat(), Eq(&heartbeat));
+    EXPECT_THAT(roudiproc.getTimestamp(), Eq(laterTimestamp));
+}
+
+TEST_F(Process_test, TimeStampIsNotUpdatedWhenHeartbeatDidNotChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "738080dc-e83a-4eb9-8a84-76115388fba9");
+    Heartbeat heartbeat{processname};
+    Process roudiproc(processname, pid, user, isMonitored, sessionId, &heartbeat);
+    auto firstTimestamp = roudiproc.getTimestamp() + std::chrono::milliseconds(100);
+    auto secondTimestamp = firstTimestamp + std::chrono::milliseconds(100);
+
+    heartbeat.beat();
+    roudiproc.updateTimestampFromHeartbeat(firstTimestamp);
+    roudiproc.updateTimestampFromHeartbeat(secondTimestamp);
+
+    EXPECT_THAT(roudiproc.getTimestamp(), Eq(firstTimestamp));
+}
+
+TEST_F(Process_test, TimeStampIsNotUpdatedWithoutHeartbeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "98a05653-9df2-4397-8f0f-9e76595bc33d");
+    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    auto initialTimestamp = roudiproc.getTimestamp();
+
+    roudiproc.updateTimestampFromHeartbeat(initialTimestamp + std::chrono::milliseconds(100));
+
+    EXPECT_THAT(roudiproc.getHeartbeat(), Eq(nullptr));
+    EXPECT_THAT(roudiproc.getTimestamp(), Eq(initialTimestamp));
+}
+
 } // namespace
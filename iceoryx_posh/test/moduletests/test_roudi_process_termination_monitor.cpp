@@ -0,0 +1,107 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using namespace iox::units::duration_literals;
+
+class ProcessTerminationMonitor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        if (!sut.isSupported())
+        {
+            GTEST_SKIP() << "pidfds are not supported on this platform or kernel";
+        }
+    }
+
+    ProcessTerminationMonitor sut;
+};
+
+TEST_F(ProcessTerminationMonitor_test, IsSupportedOnPlatformsWithPidfds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ebde1dc-fc11-4edc-aa91-13a6daa5422d");
+    EXPECT_TRUE(iox::platform::IOX_SUPPORT_PIDFD);
+}
+
+TEST_F(ProcessTerminationMonitor_test, RunningProcessIsNotReportedAsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "389ac2b3-a13c-4761-9847-9e8d161c4887");
+    auto pidfd = sut.watch(static_cast<uint32_t>(getpid()));
+    ASSERT_TRUE(pidfd.has_value());
+
+    EXPECT_FALSE(sut.waitForTermination(10_ms));
+    EXPECT_FALSE(ProcessTerminationMonitor::hasTerminated(pidfd.value()));
+
+    ProcessTerminationMonitor::closePidfd(pidfd.value());
+}
+
+TEST_F(ProcessTerminationMonitor_test, TerminatedProcessIsDetected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4976a34b-ed79-4373-b82d-f6fa24b70388");
+    auto child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0)
+    {
+        _exit(0);
+    }
+
+    auto pidfd = sut.watch(static_cast<uint32_t>(child));
+    ASSERT_TRUE(pidfd.has_value());
+
+    EXPECT_TRUE(sut.waitForTermination(5_s));
+    EXPECT_TRUE(ProcessTerminationMonitor::hasTerminated(pidfd.value()));
+
+    ProcessTerminationMonitor::closePidfd(pidfd.value());
+    EXPECT_THAT(waitpid(child, nullptr, 0), Eq(child));
+}
+
+TEST_F(ProcessTerminationMonitor_test, ClosedPidfdIsNoLongerWatched)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8fc181b5-a84e-48d0-ae0f-84a24994ddf2");
+    auto child = fork();
+    ASSERT_NE(child, -1);
+    if (child == 0)
+    {
+        _exit(0);
+    }
+
+    auto pidfd = sut.watch(static_cast<uint32_t>(child));
+    ASSERT_TRUE(pidfd.has_value());
+    ProcessTerminationMonitor::closePidfd(pidfd.value());
+    EXPECT_THAT(waitpid(child, nullptr, 0), Eq(child));
+
+    EXPECT_FALSE(sut.waitForTermination(10_ms));
+}
+
+TEST_F(ProcessTerminationMonitor_test, InvalidPidfdIsNotReportedAsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e72246a6-4c18-4d02-a248-6a75a8386053");
+    EXPECT_FALSE(ProcessTerminationMonitor::hasTerminated(ProcessTerminationMonitor::INVALID_PIDFD));
+}
+
+} // namespace
@@ -0,0 +1,163 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/introspection/runtime_message_introspection.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "mocks/publisher_mock.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::runtime::IpcMessageType;
+
+class RuntimeMessageIntrospectionAccess : public iox::roudi::RuntimeMessageIntrospection<MockPublisherPortUser>
+{
+  public:
+    using iox::roudi::RuntimeMessageIntrospection<MockPublisherPortUser>::send;
+
+    iox::cxx::optional<MockPublisherPortUser>& getPublisherPort()
+    {
+        return this->m_publisherPort;
+    }
+};
+
+class RuntimeMessageIntrospection_test : public Test
+{
+  public:
+    using Topic = iox::roudi::RuntimeMessageIntrospectionFieldTopic;
+
+    void SetUp() override
+    {
+        sut.registerPublisherPort(MockPublisherPortUser());
+        EXPECT_CALL(sut.getPublisherPort().value(), stopOffer()).Times(1);
+    }
+
+    ChunkMock<Topic>* createMemoryChunkAndSend()
+    {
+        EXPECT_CALL(sut.getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+            .WillOnce(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+                m_chunk.get()->chunkHeader())));
+
+        bool chunkWasSent = false;
+        EXPECT_CALL(sut.getPublisherPort().value(), sendChunk(_)).WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) {
+            chunkWasSent = true;
+        }));
+
+        sut.send();
+
+        return chunkWasSent ? m_chunk.get() : nullptr;
+    }
+
+    const iox::roudi::RuntimeMessageIntrospectionData* findMessageType(const Topic& topic, const char* messageType)
+    {
+        for (const auto& data : topic.m_messageList)
+        {
+            if (data.m_messageType == iox::cxx::string<iox::roudi::MAX_RUNTIME_MESSAGE_TYPE_NAME_LENGTH>(
+                    iox::cxx::TruncateToCapacity, messageType))
+            {
+                return &data;
+            }
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<ChunkMock<Topic>> m_chunk{new ChunkMock<Topic>()};
+    RuntimeMessageIntrospectionAccess sut;
+};
+
+TEST_F(RuntimeMessageIntrospection_test, InitialSampleContainsNoMessages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44ba2e1f-7f00-4c62-8d18-ef0842dd8b8b");
+    auto chunk = createMemoryChunkAndSend();
+
+    ASSERT_THAT(chunk, Ne(nullptr));
+    EXPECT_THAT(chunk->sample()->m_messageList.size(), Eq(0U));
+}
+
+TEST_F(RuntimeMessageIntrospection_test, NothingIsSentWithoutNewMessages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "832a5c9c-4cde-412b-80b7-2c9081cf1ad4");
+    ASSERT_THAT(createMemoryChunkAndSend(), Ne(nullptr));
+
+    EXPECT_CALL(sut.getPublisherPort().value(), tryAllocateChunk(_, _, _, _)).Times(0);
+    sut.send();
+}
+
+TEST_F(RuntimeMessageIntrospection_test, MessagesAreCountedPerMessageType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9aa6c72c-e919-4595-801d-cdc741354204");
+    sut.addMessage(IpcMessageType::REG, 10_us);
+    sut.addMessage(IpcMessageType::CREATE_PUBLISHER, 20_us);
+    sut.addMessage(IpcMessageType::CREATE_PUBLISHER, 40_us);
+
+    auto chunk = createMemoryChunkAndSend();
+
+    ASSERT_THAT(chunk, Ne(nullptr));
+    EXPECT_THAT(chunk->sample()->m_messageList.size(), Eq(2U));
+    auto reg = findMessageType(*chunk->sample(), "REG");
+    ASSERT_THAT(reg, Ne(nullptr));
+    EXPECT_THAT(reg->m_numberOfMessages, Eq(1U));
+    auto createPublisher = findMessageType(*chunk->sample(), "CREATE_PUBLISHER");
+    ASSERT_THAT(createPublisher, Ne(nullptr));
+    EXPECT_THAT(createPublisher->m_numberOfMessages, Eq(2U));
+}
+
+TEST_F(RuntimeMessageIntrospection_test, TotalAndMaxProcessingTimeAreReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "50f8f773-91ed-492f-8265-52edd872f417");
+    sut.addMessage(IpcMessageType::CREATE_SUBSCRIBER, 30_us);
+    sut.addMessage(IpcMessageType::CREATE_SUBSCRIBER, 50_us);
+    sut.addMessage(IpcMessageType::CREATE_SUBSCRIBER, 10_us);
+
+    auto chunk = createMemoryChunkAndSend();
+
+    ASSERT_THAT(chunk, Ne(nullptr));
+    auto createSubscriber = findMessageType(*chunk->sample(), "CREATE_SUBSCRIBER");
+    ASSERT_THAT(createSubscriber, Ne(nullptr));
+    EXPECT_THAT(createSubscriber->m_totalProcessingTime_ns, Eq((90_us).toNanoseconds()));
+    EXPECT_THAT(createSubscriber->m_maxProcessingTime_ns, Eq((50_us).toNanoseconds()));
+}
+
+TEST_F(RuntimeMessageIntrospection_test, BinaryMessagesAreReportedSeparately)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f01df30-101f-4333-bb93-ed0d4ea73781");
+    sut.addBinaryMessage(100_us);
+
+    auto chunk = createMemoryChunkAndSend();
+
+    ASSERT_THAT(chunk, Ne(nullptr));
+    auto binaryPortRequests = findMessageType(*chunk->sample(), "BINARY_PORT_REQUESTS");
+    ASSERT_THAT(binaryPortRequests, Ne(nullptr));
+    EXPECT_THAT(binaryPortRequests->m_numberOfMessages, Eq(1U));
+}
+
+TEST_F(RuntimeMessageIntrospection_test, UnknownMessageTypesAreReportedAsUnknown)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71780fc1-a21f-4581-88ef-2bf35e981612");
+    sut.addMessage(IpcMessageType::NOTYPE, 1_us);
+
+    auto chunk = createMemoryChunkAndSend();
+
+    ASSERT_THAT(chunk, Ne(nullptr));
+    auto unknown = findMessageType(*chunk->sample(), "UNKNOWN");
+    ASSERT_THAT(unknown, Ne(nullptr));
+    EXPECT_THAT(unknown->m_numberOfMessages, Eq(1U));
+}
+
+} // namespace
@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_name_index.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::RuntimeName_t;
+
+struct Element
+{
+    RuntimeName_t m_runtimeName;
+};
+
+class RuntimeNameIndex_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{4U};
+    using Sut_t = RuntimeNameIndex<Element, CAPACITY>;
+    using Elements_t = iox::cxx::vector<Element*, CAPACITY>;
+
+    Elements_t lookup(const RuntimeName_t& runtimeName)
+    {
+        Elements_t elements;
+        m_sut.forEach(runtimeName, [&](Element* element) { elements.emplace_back(element); });
+        return elements;
+    }
+
+    Element m_elements[CAPACITY] = {{"vimes"}, {"vetinari"}, {"vimes"}, {"vime"}};
+    Sut_t m_sut;
+};
+
+constexpr uint64_t RuntimeNameIndex_test::CAPACITY;
+
+TEST_F(RuntimeNameIndex_test, EqualRuntimeNamesHaveEqualHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23c1db00-597f-4cd6-8fea-89c681696669");
+    EXPECT_THAT(hashRuntimeName("vimes"), Eq(hashRuntimeName(RuntimeName_t("vimes"))));
+    EXPECT_THAT(hashRuntimeName("vimes"), Ne(hashRuntimeName("vime")));
+    EXPECT_THAT(hashRuntimeName(""), Ne(hashRuntimeName("vimes")));
+}
+
+TEST_F(RuntimeNameIndex_test, LookupReturnsOnlyElementsOfTheRuntimeInOrderOfAdding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "004d8415-74ea-4be7-8cc9-a0ce850a2569");
+    for (auto& element : m_elements)
+    {
+        ASSERT_TRUE(m_sut.add(&element));
+    }
+
+    auto elements = lookup("vimes");
+    ASSERT_THAT(elements.size(), Eq(2U));
+    EXPECT_THAT(elements[0], Eq(&m_elements[0]));
+    EXPECT_THAT(elements[1], Eq(&m_elements[2]));
+
+    elements = lookup("vime");
+    ASSERT_THAT(elements.size(), Eq(1U));
+    EXPECT_THAT(elements[0], Eq(&m_elements[3]));
+
+    EXPECT_TRUE(lookup("nobby").empty());
+}
+
+TEST_F(RuntimeNameIndex_test, AllElementsOfARuntimeCanBeRemovedWhileIteratingOverThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f036a9b3-0785-45fd-adc5-47e0822fc707");
+    for (auto& element : m_elements)
+    {
+        ASSERT_TRUE(m_sut.add(&element));
+    }
+
+    m_sut.forEach("vimes", [&](Element* element) { m_sut.remove(element); });
+
+    EXPECT_THAT(m_sut.size(), Eq(2U));
+    EXPECT_TRUE(lookup("vimes").empty());
+    EXPECT_THAT(lookup("vetinari").size(), Eq(1U));
+    EXPECT_THAT(lookup("vime").size(), Eq(1U));
+}
+
+} // namespace
@@ -0,0 +1,151 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/internal/roudi/service_description_index.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+
+struct Element
+{
+    ServiceDescription m_serviceDescription;
+};
+
+class ServiceDescriptionIndex_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{8U};
+    using Sut_t = ServiceDescriptionIndex<Element, CAPACITY>;
+    using Elements_t = iox::cxx::vector<Element*, CAPACITY>;
+
+    Elements_t lookup(const ServiceDescription& service)
+    {
+        Elements_t elements;
+        m_sut.forEach(service, [&](Element* element) { elements.emplace_back(element); });
+        return elements;
+    }
+
+    Element m_elements[CAPACITY + 1U] = {{{"a", "a", "a"}},
+                                         {{"b", "b", "b"}},
+                                         {{"a", "a", "a"}},
+                                         {{"c", "c", "c"}},
+                                         {{"a", "a", "b"}},
+                                         {{"a", "a", "a"}},
+                                         {{"d", "d", "d"}},
+                                         {{"e", "e", "e"}},
+                                         {{"f", "f", "f"}}};
+    Sut_t m_sut;
+};
+
+constexpr uint64_t ServiceDescriptionIndex_test::CAPACITY;
+
+TEST_F(ServiceDescriptionIndex_test, IsEmptyAfterConstruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7a27e8b-1a1f-4e23-b12c-d831e76547ac");
+    EXPECT_THAT(m_sut.size(), Eq(0U));
+    EXPECT_TRUE(lookup({"a", "a", "a"}).empty());
+}
+
+TEST_F(ServiceDescriptionIndex_test, LookupReturnsOnlyElementsWithEqualServiceDescriptionInOrderOfAdding)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d4808410-ff14-47ec-a2dd-18576c73f658");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_elements[i]));
+    }
+
+    auto elements = lookup({"a", "a", "a"});
+    ASSERT_THAT(elements.size(), Eq(3U));
+    EXPECT_THAT(elements[0], Eq(&m_elements[0]));
+    EXPECT_THAT(elements[1], Eq(&m_elements[2]));
+    EXPECT_THAT(elements[2], Eq(&m_elements[5]));
+
+    elements = lookup({"a", "a", "b"});
+    ASSERT_THAT(elements.size(), Eq(1U));
+    EXPECT_THAT(elements[0], Eq(&m_elements[4]));
+
+    EXPECT_TRUE(lookup({"x", "y", "z"}).empty());
+}
+
+TEST_F(ServiceDescriptionIndex_test, AddingMoreElementsThanCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2d3069e-4adb-4ddf-b53c-f541ce2801c8");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_elements[i]));
+    }
+
+    EXPECT_FALSE(m_sut.add(&m_elements[CAPACITY]));
+    EXPECT_THAT(m_sut.size(), Eq(CAPACITY));
+    EXPECT_TRUE(lookup(m_elements[CAPACITY].m_serviceDescription).empty());
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovedElementIsNotFoundAnymoreAndFreesItsSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd3975ef-5561-432c-a67a-88e8825ac527");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_elements[i]));
+    }
+
+    m_sut.remove(&m_elements[2]);
+
+    auto elements = lookup({"a", "a", "a"});
+    ASSERT_THAT(elements.size(), Eq(2U));
+    EXPECT_THAT(elements[0], Eq(&m_elements[0]));
+    EXPECT_THAT(elements[1], Eq(&m_elements[5]));
+
+    EXPECT_TRUE(m_sut.add(&m_elements[CAPACITY]));
+    EXPECT_THAT(lookup(m_elements[CAPACITY].m_serviceDescription).size(), Eq(1U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovingElementWhichIsNotContainedDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce4c4025-8e4e-4898-9cc8-ea45350c77e7");
+    ASSERT_TRUE(m_sut.add(&m_elements[0]));
+
+    m_sut.remove(&m_elements[2]);
+
+    EXPECT_THAT(m_sut.size(), Eq(1U));
+    EXPECT_THAT(lookup({"a", "a", "a"}).size(), Eq(1U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, ElementCanBeRemovedWhileIteratingOverIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd896a96-1e16-4f1a-9398-f4533e2a8c55");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut.add(&m_elements[i]));
+    }
+
+    uint64_t numberOfVisitedElements{0U};
+    m_sut.forEach({"a", "a", "a"}, [&](Element* element) {
+        ++numberOfVisitedElements;
+        m_sut.remove(element);
+    });
+
+    EXPECT_THAT(numberOfVisitedElements, Eq(3U));
+    EXPECT_TRUE(lookup({"a", "a", "a"}).empty());
+    EXPECT_THAT(m_sut.size(), Eq(CAPACITY - 3U));
+}
+
+} // namespace
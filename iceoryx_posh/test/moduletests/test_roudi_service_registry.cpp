@@ -710,4 +710,163 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
+
+TYPED_TEST(ServiceRegistry_test, SearchWithEveryCombinationOfWildcardsFindsAllMatchingServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a6b3f1d2-7c84-4e0f-9b15-2d9e6c3a8f47");
+    // every service description differs from the searched one in one string, only "a", "b", "c" matches all strings
+    iox::capro::ServiceDescription matching("a", "b", "c");
+    ASSERT_FALSE(this->sut.add(matching).has_error());
+    ASSERT_FALSE(this->sut.add({"x", "b", "c"}).has_error());
+    ASSERT_FALSE(this->sut.add({"a", "x", "c"}).has_error());
+    ASSERT_FALSE(this->sut.add({"a", "b", "x"}).has_error());
+
+    const optional<IdString_t> service{IdString_t("a")};
+    const optional<IdString_t> instance{IdString_t("b")};
+    const optional<IdString_t> event{IdString_t("c")};
+    const optional<IdString_t> wildcard{iox::capro::Wildcard};
+
+    struct Search
+    {
+        optional<IdString_t> service;
+        optional<IdString_t> instance;
+        optional<IdString_t> event;
+        uint64_t expectedNumberOfMatches;
+    };
+    const Search searches[] = {{service, instance, event, 1U},
+                               {service, instance, wildcard, 2U},
+                               {service, wildcard, event, 2U},
+                               {wildcard, instance, event, 2U},
+                               {service, wildcard, wildcard, 3U},
+                               {wildcard, instance, wildcard, 3U},
+                               {wildcard, wildcard, event, 3U},
+                               {wildcard, wildcard, wildcard, 4U}};
+
+    for (const auto& search : searches)
+    {
+        this->find(search.service, search.instance, search.event);
+        EXPECT_THAT(this->searchResult.size(), Eq(search.expectedNumberOfMatches));
+    }
+
+    this->find(service, instance, event);
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(matching));
+}
+
+TYPED_TEST(ServiceRegistry_test, ServiceDescriptionAddedToSlotOfRemovedOneIsFoundAndRemovedOneIsNot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f2c9e71-0b8d-4a63-8e5f-b1d7a24c6e90");
+    iox::capro::ServiceDescription removed("a", "a", "a");
+    iox::capro::ServiceDescription kept("b", "b", "b");
+    iox::capro::ServiceDescription added("c", "c", "c");
+
+    ASSERT_FALSE(this->sut.add(removed).has_error());
+    ASSERT_FALSE(this->sut.add(kept).has_error());
+    this->sut.remove(removed);
+    ASSERT_FALSE(this->sut.add(added).has_error());
+
+    this->find(IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(0U));
+
+    this->find(IdString_t("c"), IdString_t("c"), IdString_t("c"));
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(added));
+    EXPECT_THAT(this->countServices(), Eq(2U));
+}
+
+TYPED_TEST(ServiceRegistry_test, GenerationIsIncrementedByEveryModification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3e0f5a2-6d1c-4e8b-9a47-2c5d8e1f0b63");
+    iox::capro::ServiceDescription service("a", "b", "c");
+    EXPECT_THAT(this->sut->generation(), Eq(0U));
+
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    EXPECT_THAT(this->sut->generation(), Eq(1U));
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    EXPECT_THAT(this->sut->generation(), Eq(2U));
+    ASSERT_FALSE(this->sut.otherAdd(service).has_error());
+    EXPECT_THAT(this->sut->generation(), Eq(3U));
+    this->sut.remove(service);
+    EXPECT_THAT(this->sut->generation(), Eq(4U));
+    this->sut->purge(service);
+    EXPECT_THAT(this->sut->generation(), Eq(5U));
+}
+
+TYPED_TEST(ServiceRegistry_test, RemovingServiceWhichIsNotContainedDoesNotChangeGeneration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a91c4d8-2e5f-4b36-8c0a-d4f6e3b21957");
+    iox::capro::ServiceDescription service("a", "b", "c");
+    iox::capro::ServiceDescription otherService("x", "y", "z");
+    ASSERT_FALSE(this->sut.otherAdd(service).has_error());
+    const auto generation = this->sut->generation();
+
+    this->sut.remove(service);
+    this->sut.remove(otherService);
+    this->sut->purge(otherService);
+
+    EXPECT_THAT(this->sut->generation(), Eq(generation));
+}
+
+TEST(ServiceRegistryChange_test, ApplyingAllChangesOfRegistryResultsInSameEntriesAndGeneration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2d84b1f-59c3-4a7e-b06d-18f3c9a5e742");
+    using Type = ServiceRegistryChange::Type;
+    ServiceRegistry source;
+    ServiceRegistry sut;
+
+    std::vector<ServiceRegistryChange> changes;
+    auto modify = [&](const Type type, const ServiceDescription& service) {
+        switch (type)
+        {
+        case Type::ADD_PUBLISHER:
+            ASSERT_FALSE(source.addPublisher(service).has_error());
+            break;
+        case Type::REMOVE_PUBLISHER:
+            source.removePublisher(service);
+            break;
+        case Type::ADD_SERVER:
+            ASSERT_FALSE(source.addServer(service).has_error());
+            break;
+        case Type::REMOVE_SERVER:
+            source.removeServer(service);
+            break;
+        }
+        ServiceRegistryChange change;
+        change.generation = source.generation();
+        change.type = type;
+        change.serviceDescription = service;
+        changes.push_back(change);
+    };
+
+    const ServiceDescription a("a", "a", "a");
+    const ServiceDescription b("b", "b", "b");
+    const ServiceDescription c("c", "c", "c");
+    modify(Type::ADD_PUBLISHER, a);
+    modify(Type::ADD_PUBLISHER, a);
+    modify(Type::ADD_SERVER, b);
+    modify(Type::ADD_PUBLISHER, b);
+    modify(Type::REMOVE_PUBLISHER, a);
+    modify(Type::ADD_SERVER, c);
+    modify(Type::REMOVE_SERVER, b);
+
+    for (const auto& change : changes)
+    {
+        sut.apply(change);
+    }
+
+    SearchResult_t expected;
+    source.forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) { expected.push_back(entry); });
+    SearchResult_t result;
+    sut.forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) { result.push_back(entry); });
+
+    EXPECT_THAT(sut.generation(), Eq(source.generation()));
+    ASSERT_THAT(result.size(), Eq(expected.size()));
+    for (uint64_t i = 0U; i < result.size(); ++i)
+    {
+        EXPECT_THAT(result[i].serviceDescription, Eq(expected[i].serviceDescription));
+        EXPECT_THAT(result[i].publisherCount, Eq(expected[i].publisherCount));
+        EXPECT_THAT(result[i].serverCount, Eq(expected[i].serverCount));
+    }
+}
+
 } // namespace
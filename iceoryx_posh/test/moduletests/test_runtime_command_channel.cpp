@@ -0,0 +1,171 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/internal/runtime/command_channel.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+class CommandChannel_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        sut.open(m_runtimeName, m_queue, CHANNEL_INDEX);
+    }
+
+    /// @brief takes the request of the sut like the runtime messages thread of RouDi
+    std::thread answerRequest(const IpcMessage& response)
+    {
+        return std::thread([this, response] {
+            auto index = m_queue.timedPop(units::Duration::fromSeconds(10U));
+            ASSERT_TRUE(index.has_value());
+            EXPECT_EQ(index.value(), CHANNEL_INDEX);
+            ASSERT_TRUE(sut.takeRequest(m_takenRequest));
+            EXPECT_TRUE(sut.sendResponse(response));
+        });
+    }
+
+    static constexpr uint32_t CHANNEL_INDEX{3U};
+    RuntimeName_t m_runtimeName{"Calvin"};
+    CommandChannelQueue m_queue;
+    IpcMessage m_takenRequest;
+    CommandChannel sut;
+};
+
+constexpr uint32_t CommandChannel_test::CHANNEL_INDEX;
+
+TEST_F(CommandChannel_test, QueueReturnsIndicesInOrderOfPush)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "165c0eaf-4cee-406b-aaa8-44d4ec8c3657");
+    EXPECT_TRUE(m_queue.push(1U));
+    EXPECT_TRUE(m_queue.push(2U));
+
+    auto first = m_queue.timedPop(1_ms);
+    auto second = m_queue.timedPop(1_ms);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first.value(), 1U);
+    EXPECT_EQ(second.value(), 2U);
+}
+
+TEST_F(CommandChannel_test, QueueReturnsNulloptWhenNothingWasPushedWithinTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4fead591-1653-4095-9e88-d2c785b9c5d3");
+    EXPECT_FALSE(m_queue.timedPop(1_ms).has_value());
+}
+
+TEST_F(CommandChannel_test, QueuePushFailsWhenFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "03f45a58-6385-47a3-95f4-4512922f1b53");
+    for (uint32_t i = 0U; i < CommandChannelQueue::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(m_queue.push(i));
+    }
+
+    EXPECT_FALSE(m_queue.push(0U));
+}
+
+TEST_F(CommandChannel_test, OpenedChannelHasRuntimeName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "357bc164-c187-4b7b-b0ae-0a03cb0599bf");
+    EXPECT_TRUE(sut.isOpen());
+    EXPECT_EQ(sut.runtimeName(), m_runtimeName);
+}
+
+TEST_F(CommandChannel_test, SendRequestOnClosedChannelFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "383c72eb-5450-41f0-b26b-80760b1052ca");
+    sut.close();
+    IpcMessage response;
+
+    auto result = sut.sendRequest(IpcMessage({"Hypnotoad"}), response);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.get_error(), CommandChannelError::CHANNEL_CLOSED);
+    EXPECT_FALSE(m_queue.timedPop(1_ms).has_value());
+}
+
+TEST_F(CommandChannel_test, SendInvalidRequestFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ed857e32-4343-4442-8223-8efa599a9f34");
+    IpcMessage request;
+    request << "Hypno,toad";
+    ASSERT_FALSE(request.isValid());
+    IpcMessage response;
+
+    auto result = sut.sendRequest(request, response);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.get_error(), CommandChannelError::INVALID_MESSAGE);
+}
+
+TEST_F(CommandChannel_test, TakeRequestFailsWhenNoRequestIsPending)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d70de1ed-5ef1-4391-8ff1-5a6f02124038");
+    IpcMessage request;
+    EXPECT_FALSE(sut.takeRequest(request));
+}
+
+TEST_F(CommandChannel_test, SendResponseFailsWhenNoRequestWasTaken)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6efc2f5-f6c2-4d4b-96b1-82d655ae3917");
+    EXPECT_FALSE(sut.sendResponse(IpcMessage({"Hypnotoad"})));
+}
+
+TEST_F(CommandChannel_test, RequestIsAnsweredWithResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b913096a-24dc-4b57-92f9-a50323af2221");
+    const IpcMessage request({"all", "glory", "to"});
+    const IpcMessage expectedResponse({"the", "hypnotoad"});
+    auto roudi = answerRequest(expectedResponse);
+
+    IpcMessage response;
+    auto result = sut.sendRequest(request, response);
+    roudi.join();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(m_takenRequest.getMessage(), request.getMessage());
+    EXPECT_EQ(response.getMessage(), expectedResponse.getMessage());
+}
+
+TEST_F(CommandChannel_test, ChannelIsReusableAfterResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae248a06-8791-43ab-86b8-f536112288bd");
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        const IpcMessage expectedResponse({"response", cxx::convert::toString(i)});
+        auto roudi = answerRequest(expectedResponse);
+
+        IpcMessage response;
+        EXPECT_FALSE(sut.sendRequest(IpcMessage({"request"}), response).has_error());
+        roudi.join();
+
+        EXPECT_EQ(response.getMessage(), expectedResponse.getMessage());
+    }
+}
+
+} // namespace
@@ -0,0 +1,381 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_frame.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_port_request.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+class IpcBinaryFrame_test : public Test
+{
+  public:
+    IpcBinaryFrame encodeAndDecode(const IpcBinaryFrame& frame)
+    {
+        IpcMessage message;
+        EXPECT_TRUE(frame.encode(message));
+        EXPECT_TRUE(message.isBinaryFrame());
+        EXPECT_EQ(std::strlen(message.getMessage().c_str()), message.getMessage().size());
+
+        IpcBinaryFrame decodedFrame;
+        EXPECT_TRUE(decodedFrame.decode(message));
+        return decodedFrame;
+    }
+
+    IpcPortRequest roundtrip(const IpcPortRequest& request)
+    {
+        IpcBinaryFrame frame;
+        frame << request;
+        EXPECT_TRUE(frame.isValid());
+
+        auto decodedFrame = encodeAndDecode(frame);
+        IpcPortRequest decodedRequest;
+        decodedFrame >> decodedRequest;
+        EXPECT_TRUE(decodedFrame.isValid());
+        return decodedRequest;
+    }
+};
+
+TEST_F(IpcBinaryFrame_test, WrittenValuesAreReadInTheSameOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70762ef3-21ef-463b-a5bb-90e1cc821126");
+    constexpr int32_t SIGNED_VALUE{-42};
+    constexpr uint64_t LARGE_VALUE{0xFF00FF00FF00FF00U};
+    IpcBinaryFrame sut;
+    sut << static_cast<uint8_t>(13U) << static_cast<uint16_t>(0U) << SIGNED_VALUE << LARGE_VALUE << true
+        << IpcMessageType::CREATE_NODE << RuntimeName_t("hypnotoad");
+
+    uint8_t u8{0U};
+    uint16_t u16{1U};
+    int32_t i32{0};
+    uint64_t u64{0U};
+    bool flag{false};
+    IpcMessageType type{IpcMessageType::NOTYPE};
+    RuntimeName_t name;
+    sut >> u8 >> u16 >> i32 >> u64 >> flag >> type >> name;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(u8, Eq(13U));
+    EXPECT_THAT(u16, Eq(0U));
+    EXPECT_THAT(i32, Eq(SIGNED_VALUE));
+    EXPECT_THAT(u64, Eq(LARGE_VALUE));
+    EXPECT_TRUE(flag);
+    EXPECT_THAT(type, Eq(IpcMessageType::CREATE_NODE));
+    EXPECT_THAT(name, Eq(RuntimeName_t("hypnotoad")));
+}
+
+TEST_F(IpcBinaryFrame_test, WritingBeyondTheCapacityInvalidatesTheFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c1c095f-220b-4885-872f-dc0273ce978b");
+    IpcBinaryFrame sut;
+    for (uint64_t i = 0U; i < IpcBinaryFrame::CAPACITY; ++i)
+    {
+        sut << static_cast<uint8_t>(i);
+    }
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(sut.size(), Eq(IpcBinaryFrame::CAPACITY));
+
+    sut << static_cast<uint8_t>(0U);
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(sut.size(), Eq(IpcBinaryFrame::CAPACITY));
+
+    IpcMessage message;
+    EXPECT_FALSE(sut.encode(message));
+}
+
+TEST_F(IpcBinaryFrame_test, ReadingBeyondTheSizeInvalidatesTheFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e69c83b-24bb-47e1-a1ab-567a77347db8");
+    IpcBinaryFrame sut;
+    sut << static_cast<uint16_t>(73U);
+
+    uint32_t value{42U};
+    sut >> value;
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(value, Eq(42U));
+}
+
+TEST_F(IpcBinaryFrame_test, ReadingABoolWhichIsNeitherZeroNorOneInvalidatesTheFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f34a51db-75ad-4a2a-81eb-e1a1adc12363");
+    IpcBinaryFrame sut;
+    sut << static_cast<uint8_t>(2U);
+
+    bool value{false};
+    sut >> value;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryFrame_test, ReadingAStringWhichExceedsTheCapacityInvalidatesTheFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a492196-aee1-471c-be60-d2bbf39eb233");
+    IpcBinaryFrame sut;
+    sut << cxx::string<10>("0123456789");
+
+    cxx::string<5> value("abc");
+    sut >> value;
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(value, Eq(cxx::string<5>("abc")));
+}
+
+TEST_F(IpcBinaryFrame_test, FrameWithZerosIsEncodedWithoutZerosAndDecodedCorrectly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d2473c19-aa55-4b5e-8ad6-9c1068e6280d");
+    constexpr uint64_t ZERO{0U};
+    constexpr uint32_t VALUE_WITH_ZEROS{0x00FF0000U};
+    IpcBinaryFrame sut;
+    sut << ZERO << VALUE_WITH_ZEROS << static_cast<uint8_t>(0U);
+
+    auto decoded = encodeAndDecode(sut);
+
+    EXPECT_THAT(decoded.size(), Eq(sut.size()));
+    uint64_t u64{1U};
+    uint32_t u32{0U};
+    uint8_t u8{1U};
+    decoded >> u64 >> u32 >> u8;
+    ASSERT_TRUE(decoded.isValid());
+    EXPECT_THAT(u64, Eq(0U));
+    EXPECT_THAT(u32, Eq(VALUE_WITH_ZEROS));
+    EXPECT_THAT(u8, Eq(0U));
+}
+
+TEST_F(IpcBinaryFrame_test, FrameWithLongRunsOfNonZeroBytesIsDecodedCorrectly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25bf8b0e-11c0-4a19-9dd9-9c2b8a96fd8c");
+    IpcBinaryFrame sut;
+    for (uint64_t i = 0U; i < IpcBinaryFrame::CAPACITY; ++i)
+    {
+        // a single zero after 254 non-zero bytes and a full block at the end of the frame
+        sut << static_cast<uint8_t>((i == 254U) ? 0U : (i % 255U) + 1U);
+    }
+
+    auto decoded = encodeAndDecode(sut);
+
+    ASSERT_THAT(decoded.size(), Eq(IpcBinaryFrame::CAPACITY));
+    for (uint64_t i = 0U; i < IpcBinaryFrame::CAPACITY; ++i)
+    {
+        uint8_t value{0U};
+        decoded >> value;
+        EXPECT_THAT(value, Eq((i == 254U) ? 0U : (i % 255U) + 1U));
+    }
+    EXPECT_TRUE(decoded.isValid());
+}
+
+TEST_F(IpcBinaryFrame_test, EmptyFrameIsDecodedCorrectly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "393f407b-5115-4164-a56f-b4e44f57dac5");
+    IpcBinaryFrame sut;
+
+    auto decoded = encodeAndDecode(sut);
+
+    EXPECT_THAT(decoded.size(), Eq(0U));
+}
+
+TEST_F(IpcBinaryFrame_test, DecodingAStringMessageFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e8876e2-acb3-472a-8d87-f4f2e6c79a11");
+    IpcMessage message;
+    message << IpcMessageTypeToString(IpcMessageType::CREATE_NODE) << "hypnotoad";
+
+    IpcBinaryFrame sut;
+
+    EXPECT_FALSE(message.isBinaryFrame());
+    EXPECT_FALSE(sut.decode(message));
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryFrame_test, DecodingAMessageWithATruncatedBlockFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0fb7eceb-c5d8-45df-a0d6-ee827eed047c");
+    IpcMessage message(std::string(1U, IpcMessage::BINARY_FRAME_MARKER) + "\x05" + "ab");
+
+    IpcBinaryFrame sut;
+
+    EXPECT_TRUE(message.isBinaryFrame());
+    EXPECT_FALSE(sut.decode(message));
+}
+
+TEST_F(IpcBinaryFrame_test, PublisherRequestRoundtrip)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11980e4b-9bf0-4622-bb36-012ba3ed7df7");
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_PUBLISHER;
+    request.service = capro::ServiceDescription("Radar", "FrontLeft", "Objects");
+    request.publisherOptions.historyCapacity = 7U;
+    request.publisherOptions.nodeName = "node";
+    request.publisherOptions.offerOnCreate = false;
+    request.publisherOptions.subscriberTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    request.portConfigInfo = PortConfigInfo(11U, 22U, 33U);
+
+    auto decoded = roundtrip(request);
+
+    EXPECT_THAT(decoded.type, Eq(request.type));
+    EXPECT_THAT(decoded.service, Eq(request.service));
+    EXPECT_THAT(decoded.publisherOptions.historyCapacity, Eq(7U));
+    EXPECT_THAT(decoded.publisherOptions.nodeName, Eq(NodeName_t("node")));
+    EXPECT_FALSE(decoded.publisherOptions.offerOnCreate);
+    EXPECT_THAT(decoded.publisherOptions.subscriberTooSlowPolicy, Eq(popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER));
+    EXPECT_TRUE(decoded.portConfigInfo == request.portConfigInfo);
+}
+
+TEST_F(IpcBinaryFrame_test, SubscriberRequestRoundtrip)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41e4c406-447f-4838-9a19-45037f7c9862");
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_SUBSCRIBER;
+    request.service = capro::ServiceDescription("Radar", "FrontLeft", "Objects");
+    request.service.setLocal();
+    request.subscriberOptions.queueCapacity = 5U;
+    request.subscriberOptions.historyRequest = 3U;
+    request.subscriberOptions.subscribeOnCreate = false;
+    request.subscriberOptions.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    request.subscriberOptions.requiresPublisherHistorySupport = true;
+
+    auto decoded = roundtrip(request);
+
+    EXPECT_THAT(decoded.service, Eq(request.service));
+    EXPECT_THAT(decoded.service.getScope(), Eq(capro::Scope::LOCAL));
+    EXPECT_THAT(decoded.subscriberOptions.queueCapacity, Eq(5U));
+    EXPECT_THAT(decoded.subscriberOptions.historyRequest, Eq(3U));
+    EXPECT_FALSE(decoded.subscriberOptions.subscribeOnCreate);
+    EXPECT_THAT(decoded.subscriberOptions.queueFullPolicy, Eq(popo::QueueFullPolicy::BLOCK_PRODUCER));
+    EXPECT_TRUE(decoded.subscriberOptions.requiresPublisherHistorySupport);
+}
+
+TEST_F(IpcBinaryFrame_test, ClientAndServerRequestRoundtrip)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7b06f88-66b5-4a72-a934-1d406b1f1dba");
+    IpcPortRequest clientRequest;
+    clientRequest.type = IpcMessageType::CREATE_CLIENT;
+    clientRequest.clientOptions.responseQueueCapacity = 9U;
+    clientRequest.clientOptions.connectOnCreate = false;
+    clientRequest.clientOptions.serverTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    IpcPortRequest serverRequest;
+    serverRequest.type = IpcMessageType::CREATE_SERVER;
+    serverRequest.serverOptions.requestQueueCapacity = 8U;
+    serverRequest.serverOptions.requestQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+
+    auto decodedClient = roundtrip(clientRequest);
+    auto decodedServer = roundtrip(serverRequest);
+
+    EXPECT_THAT(decodedClient.clientOptions.responseQueueCapacity, Eq(9U));
+    EXPECT_FALSE(decodedClient.clientOptions.connectOnCreate);
+    EXPECT_THAT(decodedClient.clientOptions.serverTooSlowPolicy, Eq(popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER));
+    EXPECT_THAT(decodedServer.serverOptions.requestQueueCapacity, Eq(8U));
+    EXPECT_THAT(decodedServer.serverOptions.requestQueueFullPolicy, Eq(popo::QueueFullPolicy::BLOCK_PRODUCER));
+}
+
+TEST_F(IpcBinaryFrame_test, InterfaceNodeAndConditionVariableRequestRoundtrip)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1dc71fd8-3d34-4653-abeb-d4f207432d42");
+    IpcPortRequest interfaceRequest;
+    interfaceRequest.type = IpcMessageType::CREATE_INTERFACE;
+    interfaceRequest.interface = capro::Interfaces::DDS;
+    interfaceRequest.nodeName = "gateway";
+    IpcPortRequest nodeRequest;
+    nodeRequest.type = IpcMessageType::CREATE_NODE;
+    nodeRequest.nodeName = "node";
+    nodeRequest.nodeDeviceIdentifier = 1337U;
+    IpcPortRequest conditionVariableRequest;
+    conditionVariableRequest.type = IpcMessageType::CREATE_CONDITION_VARIABLE;
+
+    auto decodedInterface = roundtrip(interfaceRequest);
+    auto decodedNode = roundtrip(nodeRequest);
+    auto decodedConditionVariable = roundtrip(conditionVariableRequest);
+
+    EXPECT_THAT(decodedInterface.interface, Eq(capro::Interfaces::DDS));
+    EXPECT_THAT(decodedInterface.nodeName, Eq(NodeName_t("gateway")));
+    EXPECT_THAT(decodedNode.nodeName, Eq(NodeName_t("node")));
+    EXPECT_THAT(decodedNode.nodeDeviceIdentifier, Eq(1337U));
+    EXPECT_THAT(decodedConditionVariable.type, Eq(IpcMessageType::CREATE_CONDITION_VARIABLE));
+}
+
+TEST_F(IpcBinaryFrame_test, RequestWithUnsupportedTypeInvalidatesTheFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "95c5e255-0f79-45ba-8255-cd0657f41d2f");
+    IpcBinaryFrame sut;
+    sut << IpcMessageType::REG;
+
+    IpcPortRequest request;
+    sut >> request;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryFrame_test, RequestWithOutOfRangePolicyInvalidatesTheFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36a40a86-515c-42b3-b7ef-ac05af50be74");
+    IpcPortRequest request;
+    request.type = IpcMessageType::CREATE_SUBSCRIBER;
+    request.subscriberOptions.queueFullPolicy = static_cast<popo::QueueFullPolicy>(73);
+    IpcBinaryFrame sut;
+    sut << request;
+
+    IpcPortRequest decodedRequest;
+    sut >> decodedRequest;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryFrame_test, ResponseRoundtrip)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "221ead16-956f-4919-8c83-17e9da5cf4c5");
+    IpcPortResponse response;
+    response.type = IpcMessageType::ERROR;
+    response.error = IpcMessageErrorType::PUBLISHER_LIST_FULL;
+    response.offset = 4711U;
+    response.segmentId = 2U;
+    IpcBinaryFrame sut;
+    sut << response;
+
+    auto decoded = encodeAndDecode(sut);
+    IpcPortResponse decodedResponse;
+    decoded >> decodedResponse;
+
+    ASSERT_TRUE(decoded.isValid());
+    EXPECT_THAT(decodedResponse.type, Eq(IpcMessageType::ERROR));
+    EXPECT_THAT(decodedResponse.error, Eq(IpcMessageErrorType::PUBLISHER_LIST_FULL));
+    EXPECT_THAT(decodedResponse.offset, Eq(4711U));
+    EXPECT_THAT(decodedResponse.segmentId, Eq(2U));
+}
+
+TEST_F(IpcBinaryFrame_test, MaximumNumberOfResponsesFitIntoOneFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ac546b7-de7c-4ceb-a059-f91b821dbb91");
+    IpcBinaryFrame sut;
+    sut << IPC_BINARY_PROTOCOL_VERSION << MAX_PORT_REQUESTS_PER_FRAME;
+    for (uint16_t i = 0U; i < MAX_PORT_REQUESTS_PER_FRAME; ++i)
+    {
+        sut << IpcPortResponse();
+    }
+    EXPECT_TRUE(sut.isValid());
+
+    sut << IpcPortResponse();
+    EXPECT_FALSE(sut.isValid());
+}
+
+} // namespace
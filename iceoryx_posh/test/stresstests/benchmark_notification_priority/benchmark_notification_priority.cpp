@@ -0,0 +1,128 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_BULK_TRIGGERS{64U};
+constexpr uint64_t NUMBER_OF_ROUNDS{1000U};
+constexpr std::chrono::microseconds BULK_PROCESSING_TIME{5};
+constexpr uint64_t CRITICAL_NOTIFICATION_ID{NUMBER_OF_BULK_TRIGGERS};
+constexpr iox::popo::NotificationPriority CRITICAL_PRIORITY{std::numeric_limits<iox::popo::NotificationPriority>::max()};
+
+/// @brief the benchmark uses its own condition variable and therefore does not require a running RouDi
+class BenchmarkWaitSet : public iox::popo::WaitSet<>
+{
+  public:
+    explicit BenchmarkWaitSet(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+struct Statistics
+{
+    std::chrono::nanoseconds min{std::chrono::nanoseconds::max()};
+    std::chrono::nanoseconds max{0};
+    std::chrono::nanoseconds sum{0};
+};
+
+void simulateProcessing()
+{
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < BULK_PROCESSING_TIME)
+    {
+    }
+}
+
+/// @brief All bulk triggers and the critical trigger fire in every round. The notifications are processed in the
+///        order returned by the WaitSet where every bulk notification costs BULK_PROCESSING_TIME. The latency of the
+///        critical trigger is the time from firing the triggers until its notification is processed.
+Statistics measureCriticalLatency(const iox::popo::NotificationPriority criticalPriority)
+{
+    iox::popo::ConditionVariableData condVarData{"benchmark"};
+    BenchmarkWaitSet waitSet{condVarData};
+
+    iox::popo::UserTrigger bulkTriggers[NUMBER_OF_BULK_TRIGGERS];
+    for (uint64_t i = 0U; i < NUMBER_OF_BULK_TRIGGERS; ++i)
+    {
+        waitSet.attachEvent(bulkTriggers[i], i).expect("unable to attach bulk trigger");
+    }
+    // the critical trigger is attached last, without a priority its notification is returned after all bulk
+    // notifications which were attached before
+    iox::popo::UserTrigger criticalTrigger;
+    waitSet.attachEvent(criticalTrigger, CRITICAL_NOTIFICATION_ID, {}, criticalPriority)
+        .expect("unable to attach critical trigger");
+
+    Statistics statistics;
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        for (auto& trigger : bulkTriggers)
+        {
+            trigger.trigger();
+        }
+        criticalTrigger.trigger();
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto& notification : waitSet.wait())
+        {
+            if (notification->getNotificationId() == CRITICAL_NOTIFICATION_ID)
+            {
+                auto latency = std::chrono::steady_clock::now() - start;
+                statistics.min = std::min(statistics.min, latency);
+                statistics.max = std::max(statistics.max, latency);
+                statistics.sum += latency;
+            }
+            else
+            {
+                simulateProcessing();
+            }
+        }
+    }
+
+    return statistics;
+}
+
+void printStatistics(const char* name, const Statistics& statistics)
+{
+    std::cout << std::setw(20) << name << " | " << std::setw(10) << statistics.min.count() / 1000 << " | "
+              << std::setw(10) << statistics.sum.count() / static_cast<int64_t>(NUMBER_OF_ROUNDS) / 1000 << " | "
+              << std::setw(10) << statistics.max.count() / 1000 << std::endl;
+}
+} // namespace
+
+int main()
+{
+    std::cout << "latency of the critical trigger with " << NUMBER_OF_BULK_TRIGGERS << " bulk triggers which take "
+              << BULK_PROCESSING_TIME.count() << "us each, " << NUMBER_OF_ROUNDS << " rounds" << std::endl
+              << std::endl;
+    std::cout << std::setw(20) << "priority" << " | " << std::setw(10) << "min [us]" << " | " << std::setw(10)
+              << "avg [us]" << " | " << std::setw(10) << "max [us]" << std::endl;
+
+    printStatistics("default", measureCriticalLatency(iox::popo::DEFAULT_NOTIFICATION_PRIORITY));
+    printStatistics("critical", measureCriticalLatency(CRITICAL_PRIORITY));
+
+    return 0;
+}
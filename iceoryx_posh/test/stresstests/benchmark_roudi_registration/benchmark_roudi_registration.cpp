@@ -0,0 +1,135 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIMES{100U};
+
+/// @brief the runtimes are started in child processes which wait until all of them are forked, then register at the
+///        running RouDi, report the registration to the parent and stay alive until all runtimes are registered
+[[noreturn]] void runRuntime(const uint32_t index, const int startPipe, const int registeredPipe, const int exitPipe)
+{
+    char byte{0};
+    // blocks until the parent closes the write end of the start pipe, this releases all runtimes at once
+    while (read(startPipe, &byte, 1U) > 0)
+    {
+    }
+
+    iox::RuntimeName_t name{"iox-bm-registration-"};
+    name.append(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(index));
+    iox::runtime::PoshRuntime::initRuntime(name);
+
+    if (write(registeredPipe, &byte, 1U) != 1)
+    {
+        std::exit(EXIT_FAILURE);
+    }
+
+    // a terminating runtime unregisters at RouDi, this must not interfere with the registration of the others
+    while (read(exitPipe, &byte, 1U) > 0)
+    {
+    }
+    std::exit(EXIT_SUCCESS);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    uint32_t numberOfRuntimes{DEFAULT_NUMBER_OF_RUNTIMES};
+    if (argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfRuntimes))
+    {
+        std::cerr << "Usage: " << argv[0] << " [number of runtimes]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (numberOfRuntimes == 0U || numberOfRuntimes >= iox::MAX_PROCESS_NUMBER)
+    {
+        std::cerr << "The number of runtimes must be in the range of [1, " << iox::MAX_PROCESS_NUMBER - 1U << "]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int startPipe[2];
+    int registeredPipe[2];
+    int exitPipe[2];
+    if (pipe(startPipe) != 0 || pipe(registeredPipe) != 0 || pipe(exitPipe) != 0)
+    {
+        std::cerr << "Could not create the pipes" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // the children are forked before any thread is started, therefore they can safely create their runtime
+    std::vector<pid_t> children;
+    for (uint32_t i = 0U; i < numberOfRuntimes; ++i)
+    {
+        const auto pid = fork();
+        if (pid == -1)
+        {
+            std::cerr << "Could not fork runtime " << i << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (pid == 0)
+        {
+            close(startPipe[1]);
+            close(registeredPipe[0]);
+            close(exitPipe[1]);
+            runRuntime(i, startPipe[0], registeredPipe[1], exitPipe[0]);
+        }
+        children.push_back(pid);
+    }
+    close(startPipe[0]);
+    close(registeredPipe[1]);
+    close(exitPipe[0]);
+
+    const auto start = std::chrono::steady_clock::now();
+    close(startPipe[1]);
+
+    uint32_t numberOfRegisteredRuntimes{0U};
+    char byte{0};
+    while (numberOfRegisteredRuntimes < numberOfRuntimes && read(registeredPipe[0], &byte, 1U) == 1)
+    {
+        ++numberOfRegisteredRuntimes;
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    close(exitPipe[1]);
+    for (auto pid : children)
+    {
+        waitpid(pid, nullptr, 0);
+    }
+
+    if (numberOfRegisteredRuntimes != numberOfRuntimes)
+    {
+        std::cerr << "Only " << numberOfRegisteredRuntimes << " of " << numberOfRuntimes << " runtimes registered"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::cout << "Time until " << numberOfRuntimes << " runtimes are registered: " << duration / 1000 << " ms ("
+              << duration / numberOfRuntimes << " us per runtime)" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,149 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+using iox::capro::IdString_t;
+using iox::cxx::optional;
+using iox::roudi::ServiceRegistry;
+
+constexpr uint64_t NUMBER_OF_REQUESTED_SERVICES{10000U};
+constexpr uint64_t NUMBER_OF_SERVICES{std::min<uint64_t>(NUMBER_OF_REQUESTED_SERVICES, ServiceRegistry::CAPACITY)};
+constexpr uint64_t NUMBER_OF_INSTANCES{10U};
+constexpr uint64_t NUMBER_OF_EVENTS{10U};
+constexpr uint64_t NUMBER_OF_ROUNDS{1000U};
+
+IdString_t toIdString(const uint64_t value)
+{
+    return IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(value));
+}
+
+/// @brief the search of the ServiceRegistry before it had hash indices, every entry is compared
+void linearFind(const ServiceRegistry& registry,
+                const optional<IdString_t>& service,
+                const optional<IdString_t>& instance,
+                const optional<IdString_t>& event,
+                iox::cxx::function_ref<void(const ServiceRegistry::ServiceDescriptionEntry&)> callable)
+{
+    registry.forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+        if (match)
+        {
+            callable(entry);
+        }
+    });
+}
+
+struct Search
+{
+    const char* name;
+    optional<IdString_t> service;
+    optional<IdString_t> instance;
+    optional<IdString_t> event;
+};
+
+/// @brief returns the average time of a search in nanoseconds, the number of matches is written to numberOfMatches
+template <typename Find>
+int64_t measure(const Search& search, const Find& find, uint64_t& numberOfMatches)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        numberOfMatches = 0U;
+        find(search.service,
+             search.instance,
+             search.event,
+             [&](const ServiceRegistry::ServiceDescriptionEntry&) { ++numberOfMatches; });
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return duration.count() / static_cast<int64_t>(NUMBER_OF_ROUNDS);
+}
+} // namespace
+
+int main()
+{
+    // the registry has the size of SERVICE_REGISTRY_CAPACITY entries and is therefore not placed on the stack
+    auto registry = std::make_unique<ServiceRegistry>();
+
+    // service "i / (instances * events)", instance "i / events % instances", event "i % events"
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        registry
+            ->addPublisher({toIdString(i / (NUMBER_OF_INSTANCES * NUMBER_OF_EVENTS)),
+                            toIdString(i / NUMBER_OF_EVENTS % NUMBER_OF_INSTANCES),
+                            toIdString(i % NUMBER_OF_EVENTS)})
+            .expect("the registry has space for all services");
+    }
+
+    const optional<IdString_t> wildcard{iox::capro::Wildcard};
+    const Search searches[] = {
+        {"service/instance/event", toIdString(7U), toIdString(3U), toIdString(5U)},
+        {"service/instance/*", toIdString(7U), toIdString(3U), wildcard},
+        {"service/*/*", toIdString(7U), wildcard, wildcard},
+        {"*/instance/event", wildcard, toIdString(3U), toIdString(5U)},
+        {"*/*/event", wildcard, wildcard, toIdString(5U)},
+        {"*/*/*", wildcard, wildcard, wildcard},
+    };
+
+    std::cout << "average search time with " << NUMBER_OF_SERVICES << " registered services (capacity "
+              << ServiceRegistry::CAPACITY << "), " << NUMBER_OF_ROUNDS << " rounds" << std::endl
+              << std::endl;
+    std::cout << std::setw(24) << "search" << " | " << std::setw(8) << "matches" << " | " << std::setw(12)
+              << "linear [ns]" << " | " << std::setw(12) << "indexed [ns]" << std::endl;
+
+    for (const auto& search : searches)
+    {
+        uint64_t linearMatches{0U};
+        auto linearTime = measure(
+            search,
+            [&](const auto& service, const auto& instance, const auto& event, const auto& callable) {
+                linearFind(*registry, service, instance, event, callable);
+            },
+            linearMatches);
+
+        uint64_t indexedMatches{0U};
+        auto indexedTime = measure(
+            search,
+            [&](const auto& service, const auto& instance, const auto& event, const auto& callable) {
+                registry->find(service, instance, event, callable);
+            },
+            indexedMatches);
+
+        if (linearMatches != indexedMatches)
+        {
+            std::cerr << "the searches found a different number of services for " << search.name << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << std::setw(24) << search.name << " | " << std::setw(8) << indexedMatches << " | "
+                  << std::setw(12) << linearTime << " | " << std::setw(12) << indexedTime << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
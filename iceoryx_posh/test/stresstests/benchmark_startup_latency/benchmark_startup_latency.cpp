@@ -0,0 +1,299 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIMES{10U};
+constexpr uint32_t DEFAULT_NUMBER_OF_PORTS_PER_RUNTIME{10U};
+constexpr std::chrono::seconds TIMEOUT{10};
+constexpr std::chrono::microseconds POLLING_INTERVAL{100};
+
+using Clock_t = std::chrono::steady_clock;
+using Sample_t = int64_t;
+
+/// @brief the durations of the startup phases of one runtime in microseconds, sent from the child to the parent
+struct StartupResult
+{
+    int64_t registration{0};
+    int64_t portCreation{0};
+    int64_t discovery{0};
+    int64_t firstSample{0};
+    bool success{false};
+};
+
+int64_t toMicroseconds(const Clock_t::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+iox::capro::ServiceDescription serviceOfPort(const uint32_t runtimeIndex, const uint32_t portIndex)
+{
+    return {"StartupLatency",
+            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(runtimeIndex)),
+            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(portIndex))};
+}
+
+bool waitUntil(const Clock_t::time_point deadline, const std::function<bool()>& condition)
+{
+    while (!condition())
+    {
+        if (Clock_t::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(POLLING_INTERVAL);
+    }
+    return true;
+}
+
+/// @brief Every runtime publishes M topics and subscribes to the M topics of the next runtime. The phases are measured
+///        one after another: the registration at RouDi, the creation of all ports, the discovery until all ports of
+///        the runtime are connected and the latency of the first sample which is sent on each topic.
+StartupResult measureStartup(const uint32_t runtimeIndex, const uint32_t numberOfRuntimes, const uint32_t numberOfPorts)
+{
+    StartupResult result;
+
+    iox::RuntimeName_t name{"iox-bm-startup-"};
+    name.append(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(runtimeIndex));
+
+    const auto registrationStart = Clock_t::now();
+    iox::runtime::PoshRuntime::initRuntime(name);
+    const auto portCreationStart = Clock_t::now();
+    result.registration = toMicroseconds(portCreationStart - registrationStart);
+
+    const auto peerIndex = (runtimeIndex + 1U) % numberOfRuntimes;
+    std::vector<std::unique_ptr<iox::popo::Publisher<Sample_t>>> publishers;
+    std::vector<std::unique_ptr<iox::popo::Subscriber<Sample_t>>> subscribers;
+    for (uint32_t i = 0U; i < numberOfPorts; ++i)
+    {
+        publishers.emplace_back(new iox::popo::Publisher<Sample_t>(serviceOfPort(runtimeIndex, i)));
+        subscribers.emplace_back(new iox::popo::Subscriber<Sample_t>(serviceOfPort(peerIndex, i)));
+    }
+    const auto discoveryStart = Clock_t::now();
+    result.portCreation = toMicroseconds(discoveryStart - portCreationStart);
+
+    const auto deadline = discoveryStart + TIMEOUT;
+    const bool isConnected = waitUntil(deadline, [&] {
+        return std::all_of(subscribers.begin(),
+                           subscribers.end(),
+                           [](auto& subscriber) {
+                               return subscriber->getSubscriptionState() == iox::SubscribeState::SUBSCRIBED;
+                           })
+               && std::all_of(
+                   publishers.begin(), publishers.end(), [](auto& publisher) { return publisher->hasSubscribers(); });
+    });
+    if (!isConnected)
+    {
+        std::cerr << "The ports of runtime " << runtimeIndex << " were not connected within the timeout" << std::endl;
+        return result;
+    }
+    result.discovery = toMicroseconds(Clock_t::now() - discoveryStart);
+
+    // the clock is system wide, therefore the timestamp of the peer can be compared with the own one
+    for (auto& publisher : publishers)
+    {
+        publisher->publishCopyOf(Clock_t::now().time_since_epoch().count()).or_else([](auto) {
+            std::cerr << "Could not publish the first sample" << std::endl;
+        });
+    }
+
+    std::vector<bool> hasReceivedSample(numberOfPorts, false);
+    uint32_t numberOfReceivedSamples{0U};
+    const bool hasReceivedAllSamples = waitUntil(deadline, [&] {
+        for (uint32_t i = 0U; i < numberOfPorts; ++i)
+        {
+            if (hasReceivedSample[i])
+            {
+                continue;
+            }
+            subscribers[i]->take().and_then([&](auto& sample) {
+                const Clock_t::duration latency{Clock_t::now().time_since_epoch().count() - *sample};
+                result.firstSample = std::max(result.firstSample, toMicroseconds(latency));
+                hasReceivedSample[i] = true;
+                ++numberOfReceivedSamples;
+            });
+        }
+        return numberOfReceivedSamples == numberOfPorts;
+    });
+    if (!hasReceivedAllSamples)
+    {
+        std::cerr << "Runtime " << runtimeIndex << " did not receive all samples within the timeout" << std::endl;
+        return result;
+    }
+
+    result.success = true;
+    return result;
+}
+
+/// @brief the runtimes are started in child processes which wait until all of them are forked, then measure their
+///        startup, report the result to the parent and stay alive until all runtimes are done
+[[noreturn]] void runRuntime(const uint32_t index,
+                             const uint32_t numberOfRuntimes,
+                             const uint32_t numberOfPorts,
+                             const int startPipe,
+                             const int resultPipe,
+                             const int exitPipe)
+{
+    char byte{0};
+    // blocks until the parent closes the write end of the start pipe, this releases all runtimes at once
+    while (read(startPipe, &byte, 1U) > 0)
+    {
+    }
+
+    const auto result = measureStartup(index, numberOfRuntimes, numberOfPorts);
+
+    // the result is smaller than PIPE_BUF, therefore it is written atomically
+    if (write(resultPipe, &result, sizeof(result)) != static_cast<ssize_t>(sizeof(result)))
+    {
+        std::exit(EXIT_FAILURE);
+    }
+
+    // a terminating runtime removes its ports, this must not disconnect the ports of the others
+    while (read(exitPipe, &byte, 1U) > 0)
+    {
+    }
+    std::exit(EXIT_SUCCESS);
+}
+
+void printPhase(const char* phase, const std::vector<StartupResult>& results, int64_t StartupResult::*duration)
+{
+    int64_t min{results.front().*duration};
+    int64_t max{results.front().*duration};
+    int64_t sum{0};
+    for (const auto& result : results)
+    {
+        min = std::min(min, result.*duration);
+        max = std::max(max, result.*duration);
+        sum += result.*duration;
+    }
+    const auto average = sum / static_cast<int64_t>(results.size());
+
+    std::cout << "| " << std::left << std::setw(22) << phase << std::right << " | " << std::setw(10) << min << " | "
+              << std::setw(10) << average << " | " << std::setw(10) << max << " |" << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    uint32_t numberOfRuntimes{DEFAULT_NUMBER_OF_RUNTIMES};
+    uint32_t numberOfPorts{DEFAULT_NUMBER_OF_PORTS_PER_RUNTIME};
+    if ((argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfRuntimes))
+        || (argc > 2 && !iox::cxx::convert::fromString(argv[2], numberOfPorts)))
+    {
+        std::cerr << "Usage: " << argv[0] << " [number of runtimes] [number of ports per runtime]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (numberOfRuntimes == 0U || numberOfRuntimes >= iox::MAX_PROCESS_NUMBER)
+    {
+        std::cerr << "The number of runtimes must be in the range of [1, " << iox::MAX_PROCESS_NUMBER - 1U << "]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    const auto maxNumberOfPorts =
+        std::min(iox::MAX_PUBLISHERS - iox::NUMBER_OF_INTERNAL_PUBLISHERS, iox::MAX_SUBSCRIBERS) / numberOfRuntimes;
+    if (numberOfPorts == 0U || numberOfPorts > maxNumberOfPorts)
+    {
+        std::cerr << "The number of ports per runtime must be in the range of [1, " << maxNumberOfPorts << "]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int startPipe[2];
+    int resultPipe[2];
+    int exitPipe[2];
+    if (pipe(startPipe) != 0 || pipe(resultPipe) != 0 || pipe(exitPipe) != 0)
+    {
+        std::cerr << "Could not create the pipes" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // the children are forked before any thread is started, therefore they can safely create their runtime
+    std::vector<pid_t> children;
+    for (uint32_t i = 0U; i < numberOfRuntimes; ++i)
+    {
+        const auto pid = fork();
+        if (pid == -1)
+        {
+            std::cerr << "Could not fork runtime " << i << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (pid == 0)
+        {
+            close(startPipe[1]);
+            close(resultPipe[0]);
+            close(exitPipe[1]);
+            runRuntime(i, numberOfRuntimes, numberOfPorts, startPipe[0], resultPipe[1], exitPipe[0]);
+        }
+        children.push_back(pid);
+    }
+    close(startPipe[0]);
+    close(resultPipe[1]);
+    close(exitPipe[0]);
+
+    close(startPipe[1]);
+
+    std::vector<StartupResult> results;
+    StartupResult result;
+    while (results.size() < numberOfRuntimes && read(resultPipe[0], &result, sizeof(result)) == sizeof(result))
+    {
+        results.push_back(result);
+    }
+
+    close(exitPipe[1]);
+    for (auto pid : children)
+    {
+        waitpid(pid, nullptr, 0);
+    }
+
+    const auto numberOfSuccessfulRuntimes =
+        std::count_if(results.begin(), results.end(), [](const auto& result) { return result.success; });
+    if (numberOfSuccessfulRuntimes != static_cast<int64_t>(numberOfRuntimes))
+    {
+        std::cerr << "Only " << numberOfSuccessfulRuntimes << " of " << numberOfRuntimes
+                  << " runtimes completed the startup" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Startup of " << numberOfRuntimes << " runtimes with " << numberOfPorts
+              << " publishers and subscribers each" << std::endl
+              << std::endl;
+    std::cout << "| phase                  |   min [us] |   avg [us] |   max [us] |" << std::endl;
+    std::cout << "|------------------------|-----------:|-----------:|-----------:|" << std::endl;
+    printPhase("registration", results, &StartupResult::registration);
+    printPhase("port creation", results, &StartupResult::portCreation);
+    printPhase("discovery", results, &StartupResult::discovery);
+    printPhase("first sample latency", results, &StartupResult::firstSample);
+
+    return EXIT_SUCCESS;
+}
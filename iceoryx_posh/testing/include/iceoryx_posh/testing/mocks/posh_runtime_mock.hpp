@@ -79,6 +79,8 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                 (noexcept, override));
     MOCK_METHOD(iox::popo::ConditionVariableData*, getMiddlewareConditionVariable, (), (noexcept, override));
     MOCK_METHOD(iox::runtime::NodeData*, createNode, (const iox::runtime::NodeProperty&), (noexcept, override));
+    MOCK_METHOD(uint64_t, createPorts, (iox::runtime::PortCreationBatchBase&), (noexcept, override));
+    MOCK_METHOD(void, releasePorts, (iox::runtime::PortCreationBatchBase&), (noexcept, override));
     MOCK_METHOD(bool,
                 sendRequestToRouDi,
                 (const iox::runtime::IpcMessage&, iox::runtime::IpcMessage&),
@@ -36,6 +36,7 @@ static constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                          {"mempool", no_argument, nullptr, 0},
                                          {"port", no_argument, nullptr, 0},
                                          {"process", no_argument, nullptr, 0},
+                                         {"runtime-messages", no_argument, nullptr, 0},
                                          {"all", no_argument, nullptr, 0},
                                          {nullptr, 0, nullptr, 0}};
 
@@ -129,6 +130,10 @@ class IntrospectionApp
     /// @brief prints active process IDs and names
     void printProcessIntrospectionData(const ProcessIntrospectionFieldTopic* processIntrospectionField);
 
+    /// @brief prints table showing the number and processing time of the runtime messages RouDi processed
+    void printRuntimeMessageIntrospectionData(
+        const RuntimeMessageIntrospectionFieldTopic* runtimeMessageIntrospectionField);
+
     /// @brief prints table showing current mempool usage
     void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
 
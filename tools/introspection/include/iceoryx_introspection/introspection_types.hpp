@@ -43,6 +43,7 @@ struct IntrospectionSelection
     bool mempool{false};
     bool process{false};
     bool port{false};
+    bool runtimeMessages{false};
 };
 
 /// @note this contains just pointer to the real data, therefore pay attention to the lifetime of the original data
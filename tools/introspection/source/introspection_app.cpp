@@ -67,6 +67,8 @@ void IntrospectionApp::printHelp() noexcept
                  "  --mempool         Subscribe to mempool introspection data.\n"
                  "  --port            Subscribe to port introspection data.\n"
                  "  --process         Subscribe to process introspection data.\n"
+                 "  --runtime-messages\n"
+                 "                    Subscribe to introspection data of the runtime messages processed by RouDi.\n"
               << std::endl;
 }
 
@@ -118,7 +120,8 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
 
             if (strcmp(longOptions[index].name, "all") == 0)
             {
-                introspectionSelection.mempool = introspectionSelection.port = introspectionSelection.process = true;
+                introspectionSelection.mempool = introspectionSelection.port = introspectionSelection.process =
+                    introspectionSelection.runtimeMessages = true;
                 doIntrospection = true;
             }
             else if (strcmp(longOptions[index].name, "port") == 0)
@@ -136,6 +139,11 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
                 introspectionSelection.mempool = true;
                 doIntrospection = true;
             }
+            else if (strcmp(longOptions[index].name, "runtime-messages") == 0)
+            {
+                introspectionSelection.runtimeMessages = true;
+                doIntrospection = true;
+            }
 
             break;
 
@@ -256,6 +264,35 @@ void IntrospectionApp::printProcessIntrospectionData(const ProcessIntrospectionF
     wprintw(pad, "\n");
 }
 
+void IntrospectionApp::printRuntimeMessageIntrospectionData(
+    const RuntimeMessageIntrospectionFieldTopic* runtimeMessageIntrospectionField)
+{
+    constexpr int32_t messageTypeWidth{-26};
+    constexpr int32_t numberOfMessagesWidth{10};
+    constexpr int32_t averageTimeWidth{14};
+    constexpr int32_t maxTimeWidth{14};
+    constexpr unsigned long long NANOSECONDS_PER_MICROSECOND{1000U};
+
+    wprintw(pad, "%*s |", messageTypeWidth, "Message Type");
+    wprintw(pad, "%*s |", numberOfMessagesWidth, "Messages");
+    wprintw(pad, "%*s |", averageTimeWidth, "Avg Time [us]");
+    wprintw(pad, "%*s\n", maxTimeWidth, "Max Time [us]");
+    wprintw(pad, "-----------------------------------------------------------------------\n");
+
+    for (auto& data : runtimeMessageIntrospectionField->m_messageList)
+    {
+        const auto numberOfMessages = static_cast<unsigned long long>(data.m_numberOfMessages);
+        const auto totalTime_ns = static_cast<unsigned long long>(data.m_totalProcessingTime_ns);
+        const auto maxTime_ns = static_cast<unsigned long long>(data.m_maxProcessingTime_ns);
+
+        wprintw(pad, "%*s |", messageTypeWidth, data.m_messageType.c_str());
+        wprintw(pad, "%*llu |", numberOfMessagesWidth, numberOfMessages);
+        wprintw(pad, "%*llu |", averageTimeWidth, totalTime_ns / numberOfMessages / NANOSECONDS_PER_MICROSECOND);
+        wprintw(pad, "%*llu\n", maxTimeWidth, maxTime_ns / NANOSECONDS_PER_MICROSECOND);
+    }
+    wprintw(pad, "\n");
+}
+
 void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo)
 {
     wprintw(pad, "Segment ID: %d\n", introspectionInfo.m_id);
@@ -274,14 +311,16 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t reclaimedChunksWidth{9};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s\n", reclaimedChunksWidth, "Reclaimed");
+    wprintw(pad, "--------------------------------------------------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -293,7 +332,8 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d\n", reclaimedChunksWidth, info.m_reclaimedChunks);
         }
     }
     wprintw(pad, "\n");
@@ -641,6 +681,20 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         }
     }
 
+    // runtime messages
+    iox::popo::Subscriber<RuntimeMessageIntrospectionFieldTopic> runtimeMessageSubscriber(
+        IntrospectionRuntimeMessageService, subscriberOptions);
+    if (introspectionSelection.runtimeMessages == true)
+    {
+        runtimeMessageSubscriber.subscribe();
+
+        if (waitForSubscription(runtimeMessageSubscriber) == false)
+        {
+            prettyPrint("Timeout while waiting for subscription for runtime message introspection data!\n",
+                        PrettyOptions::error);
+        }
+    }
+
     // port
     iox::popo::Subscriber<PortIntrospectionFieldTopic> portSubscriber(IntrospectionPortService, subscriberOptions);
     iox::popo::Subscriber<PortThroughputIntrospectionFieldTopic> portThroughputSubscriber(
@@ -675,6 +729,7 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
 
     cxx::optional<popo::Sample<const MemPoolIntrospectionInfoContainer>> memPoolSample;
     cxx::optional<popo::Sample<const ProcessIntrospectionFieldTopic>> processSample;
+    cxx::optional<popo::Sample<const RuntimeMessageIntrospectionFieldTopic>> runtimeMessageSample;
     cxx::optional<popo::Sample<const PortIntrospectionFieldTopic>> portSample;
     cxx::optional<popo::Sample<const PortThroughputIntrospectionFieldTopic>> portThroughputSample;
     cxx::optional<popo::Sample<const SubscriberPortChangingIntrospectionFieldTopic>> subscriberPortChangingDataSamples;
@@ -726,6 +781,22 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
             }
         }
 
+        // print runtime message information
+        if (introspectionSelection.runtimeMessages == true)
+        {
+            prettyPrint("### Runtime Messages ###\n\n", PrettyOptions::highlight);
+            runtimeMessageSubscriber.take().and_then([&](auto& sample) { runtimeMessageSample = sample; });
+
+            if (runtimeMessageSample)
+            {
+                printRuntimeMessageIntrospectionData(runtimeMessageSample.value().get());
+            }
+            else
+            {
+                prettyPrint("Waiting for runtime message introspection data ...\n");
+            }
+        }
+
         // print port information
         if (introspectionSelection.port == true)
         {